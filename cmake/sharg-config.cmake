@@ -53,8 +53,26 @@
 #                                  target_compile_options(target $SHARG_CXX_FLAGS)
 #                              for a target.
 #
+#   sharg::sharg_compiled -- optional static library that links sharg::sharg and additionally provides
+#                            precompiled instantiations of the help page formats and common validators.
+#                            It is only built if a target links against it.
+#
+#   sharg::sharg_module   -- optional static library providing the `sharg` C++20 module (`import sharg;`).
+#                            Requires CMake >= 3.28 and is only built if a target links against it.
+#
 #   [IMPORTED]: https://cmake.org/cmake/help/v3.10/prop_tgt/IMPORTED.html#prop_tgt:IMPORTED
 #
+# The following functions are defined:
+#
+#   sharg_embed_exports (<target> [SUBCOMMANDS <name>...] [FORMATS <format>...])
+#                            -- builds a copy of the executable <target>, runs it at build time to capture its help
+#                               page, version, copyright, the html/man/ctd/cwl/json exports and the bash/zsh/fish
+#                               completion scripts (FORMATS, default: all), also for each of its SUBCOMMANDS, and
+#                               embeds the output into <target>. The embedded output is written with a single write
+#                               instead of being rendered, as long as the parser is set up the same way as during the
+#                               build. Must be called after all sources and libraries were added to <target>, in the
+#                               directory that defines <target>. Does nothing but warn when cross-compiling.
+#
 # ============================================================================
 
 cmake_minimum_required (VERSION 3.4...3.12)
@@ -152,6 +170,8 @@ set (CMAKE_REQUIRED_FLAGS ${CMAKE_CXX_FLAGS})
 # ----------------------------------------------------------------------------
 
 option (SHARG_NO_TDL "Do not use TDL, even if present." OFF)
+option (SHARG_NO_EXPORT_HTML "Do not provide the HTML export (--export-help html)." OFF)
+option (SHARG_NO_EXPORT_MAN "Do not provide the man page export (--export-help man)." OFF)
 
 # ----------------------------------------------------------------------------
 # Require C++20
@@ -233,6 +253,16 @@ else ()
     set (SHARG_DEFINITIONS ${SHARG_DEFINITIONS} "-DSHARG_HAS_TDL=0")
 endif ()
 
+if (SHARG_NO_EXPORT_HTML)
+    sharg_config_print ("Export format:              HTML deactivated.")
+    set (SHARG_DEFINITIONS ${SHARG_DEFINITIONS} "-DSHARG_HAS_EXPORT_HTML=0")
+endif ()
+
+if (SHARG_NO_EXPORT_MAN)
+    sharg_config_print ("Export format:              man deactivated.")
+    set (SHARG_DEFINITIONS ${SHARG_DEFINITIONS} "-DSHARG_HAS_EXPORT_MAN=0")
+endif ()
+
 # ----------------------------------------------------------------------------
 # System dependencies
 # ----------------------------------------------------------------------------
@@ -320,6 +350,107 @@ if (SHARG_FOUND AND NOT TARGET sharg::sharg)
     add_library (sharg::sharg ALIAS sharg_sharg)
 endif ()
 
+# sharg::sharg_compiled is an optional static library that contains explicit instantiations of the non-template parts
+# of Sharg (help/man/html rendering, common validators). It is only built if a target links against it.
+find_file (SHARG_COMPILED_SOURCE
+           NAMES sharg_compiled.cpp
+           HINTS "${SHARG_INCLUDE_DIR}/../src" "${SHARG_INCLUDE_DIR}/../share/sharg/src"
+           NO_DEFAULT_PATH)
+mark_as_advanced (SHARG_COMPILED_SOURCE)
+
+if (SHARG_FOUND
+    AND SHARG_COMPILED_SOURCE
+    AND NOT TARGET sharg::sharg_compiled)
+    add_library (sharg_compiled STATIC EXCLUDE_FROM_ALL "${SHARG_COMPILED_SOURCE}")
+    target_compile_definitions (sharg_compiled PUBLIC "SHARG_COMPILED_LIBRARY=1")
+    target_link_libraries (sharg_compiled PUBLIC sharg::sharg)
+    add_library (sharg::sharg_compiled ALIAS sharg_compiled)
+endif ()
+
+# sharg::sharg_module provides the `sharg` C++20 module (`import sharg;`). It requires CMake >= 3.28 for module
+# dependency scanning and is only built if a target links against it. The headers remain usable without it.
+find_file (SHARG_MODULE_SOURCE
+           NAMES sharg.cppm
+           HINTS "${SHARG_INCLUDE_DIR}/../src" "${SHARG_INCLUDE_DIR}/../share/sharg/src"
+           NO_DEFAULT_PATH)
+mark_as_advanced (SHARG_MODULE_SOURCE)
+
+if (SHARG_FOUND
+    AND SHARG_MODULE_SOURCE
+    AND NOT TARGET sharg::sharg_module
+    AND CMAKE_VERSION VERSION_GREATER_EQUAL 3.28)
+    add_library (sharg_module STATIC EXCLUDE_FROM_ALL)
+    get_filename_component (SHARG_MODULE_SOURCE_DIR "${SHARG_MODULE_SOURCE}" DIRECTORY)
+    target_sources (sharg_module
+                    PUBLIC FILE_SET CXX_MODULES
+                           BASE_DIRS "${SHARG_MODULE_SOURCE_DIR}"
+                           FILES "${SHARG_MODULE_SOURCE}")
+    target_compile_features (sharg_module PUBLIC cxx_std_20)
+    target_link_libraries (sharg_module PUBLIC sharg::sharg)
+    add_library (sharg::sharg_module ALIAS sharg_module)
+endif ()
+
+# sharg_embed_exports runs this script at build time.
+set (SHARG_EMBED_EXPORTS_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/sharg-embed-exports.cmake")
+mark_as_advanced (SHARG_EMBED_EXPORTS_SCRIPT)
+
+function (sharg_embed_exports target)
+    cmake_parse_arguments (PARSE_ARGV 1 SHARG_EMBED "" "" "SUBCOMMANDS;FORMATS")
+
+    if (NOT SHARG_EMBED_FORMATS)
+        set (SHARG_EMBED_FORMATS help advanced-help version copyright html man ctd cwl json bash zsh fish)
+    endif ()
+
+    # The program must run on the build machine to capture its output.
+    if (CMAKE_CROSSCOMPILING)
+        message (WARNING "sharg_embed_exports: Not embedding the exports of ${target}, because it cannot be run on the "
+                         "build machine when cross-compiling.")
+        return ()
+    endif ()
+
+    # A program cannot capture its own output while it is being built: build a copy without the embedded output.
+    set (capture_target "${target}_sharg_exports")
+    get_target_property (sources ${target} SOURCES)
+    add_executable (${capture_target} EXCLUDE_FROM_ALL ${sources})
+
+    foreach (property
+             COMPILE_DEFINITIONS
+             COMPILE_FEATURES
+             COMPILE_OPTIONS
+             CXX_STANDARD
+             INCLUDE_DIRECTORIES
+             LINK_LIBRARIES
+             LINK_OPTIONS)
+        get_target_property (value ${target} ${property})
+        if (value)
+            set_target_properties (${capture_target} PROPERTIES ${property} "${value}")
+        endif ()
+    endforeach ()
+
+    # The copy has the same file name as the program, such that argv[0] is the same.
+    get_target_property (output_name ${target} OUTPUT_NAME)
+    if (NOT output_name)
+        set (output_name "${target}")
+    endif ()
+    set (capture_directory "${CMAKE_CURRENT_BINARY_DIR}/${capture_target}")
+    set_target_properties (${capture_target} PROPERTIES OUTPUT_NAME "${output_name}"
+                                                        RUNTIME_OUTPUT_DIRECTORY "${capture_directory}")
+
+    string (REPLACE ";" "," subcommands "${SHARG_EMBED_SUBCOMMANDS}")
+    string (REPLACE ";" "," formats "${SHARG_EMBED_FORMATS}")
+    set (generated "${CMAKE_CURRENT_BINARY_DIR}/${target}_sharg_exports.cpp")
+
+    add_custom_command (OUTPUT "${generated}"
+                        COMMAND "${CMAKE_COMMAND}" "-DDIRECTORY=$<TARGET_FILE_DIR:${capture_target}>"
+                                "-DCOMMAND=$<TARGET_FILE_NAME:${capture_target}>" "-DSUBCOMMANDS=${subcommands}"
+                                "-DFORMATS=${formats}" "-DOUTPUT=${generated}" -P "${SHARG_EMBED_EXPORTS_SCRIPT}"
+                        DEPENDS ${capture_target} "${SHARG_EMBED_EXPORTS_SCRIPT}"
+                        COMMENT "Embedding the help pages and exports of ${target}"
+                        VERBATIM)
+
+    target_sources (${target} PRIVATE "${generated}")
+endfunction ()
+
 set (CMAKE_REQUIRED_QUIET ${CMAKE_REQUIRED_QUIET_SAVE})
 
 if (SHARG_FIND_DEBUG)
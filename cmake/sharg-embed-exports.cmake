@@ -0,0 +1,106 @@
+# SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: BSD-3-Clause
+
+# This script is run by the function sharg_embed_exports (see sharg-config.cmake) in script mode:
+#
+#   cmake -DDIRECTORY=<dir> -DCOMMAND=<name> -DSUBCOMMANDS=<a,b> -DFORMATS=<help,man> -DOUTPUT=<file.cpp> -P <script>
+#
+# It runs the program <dir>/<name> (and each of its subcommands) once per format and writes a source file that
+# registers the captured output together with the fingerprint of the parser (`--export-help fingerprint`).
+# Formats that the program does not support, e.g. `ctd` and `cwl` without TDL, are skipped.
+
+cmake_minimum_required (VERSION 3.14)
+
+foreach (variable DIRECTORY COMMAND OUTPUT)
+    if (NOT DEFINED ${variable})
+        message (FATAL_ERROR "sharg-embed-exports.cmake: ${variable} is not set.")
+    endif ()
+endforeach ()
+
+string (REPLACE "," ";" SUBCOMMANDS "${SUBCOMMANDS}")
+string (REPLACE "," ";" FORMATS "${FORMATS}")
+
+# The program is called by its name, such that argv[0], which is part of the CTD and CWL exports, is the same as when
+# the installed program is called via PATH.
+if (CMAKE_HOST_WIN32)
+    set (ENV{PATH} "${DIRECTORY};$ENV{PATH}")
+else ()
+    set (ENV{PATH} "${DIRECTORY}:$ENV{PATH}")
+endif ()
+set (ENV{SHARG_NO_VERSION_CHECK} 1)
+
+# CMake regular expressions have no repetition count: match 16 bytes of the form `0x00,` explicitly.
+set (line_of_bytes "")
+foreach (i RANGE 1 16)
+    string (APPEND line_of_bytes "0x[0-9a-f][0-9a-f],")
+endforeach ()
+
+set (captured "${OUTPUT}.captured")
+set (arrays "")
+set (entries "")
+set (count 0)
+
+foreach (subcommand "" ${SUBCOMMANDS})
+    set (command "${COMMAND}")
+    if (subcommand)
+        string (APPEND command " ${subcommand}")
+    endif ()
+
+    execute_process (COMMAND "${COMMAND}" ${subcommand} --export-help fingerprint
+                     RESULT_VARIABLE result
+                     OUTPUT_VARIABLE fingerprint
+                     ERROR_QUIET
+                     OUTPUT_STRIP_TRAILING_WHITESPACE)
+
+    if (NOT result EQUAL 0 OR NOT fingerprint MATCHES "^[0-9a-f]+$")
+        message (WARNING "sharg_embed_exports: Cannot determine the fingerprint of `${command}`; skipping it.")
+        continue ()
+    endif ()
+
+    foreach (format ${FORMATS})
+        if (format STREQUAL "help")
+            set (arguments -h)
+        elseif (format STREQUAL "advanced-help")
+            set (arguments -hh)
+        elseif (format STREQUAL "version" OR format STREQUAL "copyright")
+            set (arguments "--${format}")
+        else ()
+            set (arguments --export-help ${format})
+        endif ()
+
+        execute_process (COMMAND "${COMMAND}" ${subcommand} ${arguments}
+                         RESULT_VARIABLE result
+                         OUTPUT_FILE "${captured}"
+                         ERROR_QUIET)
+
+        file (SIZE "${captured}" size)
+        if (NOT result EQUAL 0 OR size EQUAL 0)
+            continue ()
+        endif ()
+
+        file (READ "${captured}" contents HEX)
+        string (REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," contents "${contents}")
+        string (REGEX REPLACE "(${line_of_bytes})" "\\1\n    " contents "${contents}")
+
+        string (APPEND arrays "unsigned char const export_${count}[] = {\n    ${contents}};\n\n")
+        string (APPEND entries
+                "    {\"${format}\", 0x${fingerprint}ULL, \"${command}\", "
+                "{reinterpret_cast<char const *>(export_${count}), sizeof(export_${count})}},\n")
+        math (EXPR count "${count} + 1")
+    endforeach ()
+endforeach ()
+
+file (REMOVE "${captured}")
+
+set (source "// Generated by sharg_embed_exports. Do not edit.\n\n#include <sharg/detail/embedded_exports.hpp>\n\n")
+string (APPEND source "namespace\n{\n\n")
+
+if (count GREATER 0)
+    string (APPEND source "${arrays}")
+    string (APPEND source "sharg::detail::embedded_exports_registration const registration{\n${entries}};\n\n")
+endif ()
+
+string (APPEND source "} // namespace\n")
+
+file (WRITE "${OUTPUT}" "${source}")
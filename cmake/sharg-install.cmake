@@ -18,7 +18,12 @@ install (FILES "${SHARG_CLONE_DIR}/CHANGELOG.md" #
 
 # install cmake files in /share/cmake
 install (FILES "${SHARG_CLONE_DIR}/cmake/sharg-config.cmake" "${SHARG_CLONE_DIR}/cmake/sharg-config-version.cmake"
+               "${SHARG_CLONE_DIR}/cmake/sharg-embed-exports.cmake"
          DESTINATION "${CMAKE_INSTALL_DATADIR}/cmake/sharg")
 
 # install sharg header files in /include/sharg
 install (DIRECTORY "${SHARG_INCLUDE_DIR}/sharg" TYPE INCLUDE)
+
+# install the sources of the optional sharg::sharg_compiled and sharg::sharg_module libraries in /share/sharg/src
+install (FILES "${SHARG_CLONE_DIR}/src/sharg_compiled.cpp" "${SHARG_CLONE_DIR}/src/sharg.cppm"
+         DESTINATION "${CMAKE_INSTALL_DATADIR}/sharg/src")
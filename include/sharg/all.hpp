@@ -51,6 +51,10 @@
 #pragma once
 
 #include <sharg/auxiliary.hpp>
+#include <sharg/config_file_watcher.hpp>
 #include <sharg/exceptions.hpp>
+#include <sharg/flag_set.hpp>
+#include <sharg/parse_result.hpp>
 #include <sharg/parser.hpp>
+#include <sharg/parser_schema.hpp>
 #include <sharg/validators.hpp>
@@ -89,6 +89,13 @@ struct parser_meta_data // holds all meta information
     //!\brief The man page section info (type `man man` on the command line for more information).
     unsigned man_page_section{1};
 
+    /*!\brief The number of elements of a container default that are shown on the help page. Set to 0 for no limit.
+     *
+     * A longer default is shortened to its first elements, followed by `...` and the number of elements, e.g.
+     * `Default: [1, 2, ... (20000 elements)]`.
+     */
+    size_t default_message_element_limit{SHARG_DEFAULT_MESSAGE_ELEMENT_LIMIT};
+
     /*!\brief A more detailed description that is displayed on the help
      *        page in the section "DESCRIPTION". Each `std::string` appended
      *        to the description vector will be treated as a paragraph and
@@ -14,6 +14,20 @@
 namespace sharg
 {
 
+/*!\brief The compute resource an option controls. See sharg::config::resource.
+ * \ingroup parser
+ *
+ * \details
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+enum class resource_kind : uint8_t
+{
+    none,       //!< The option does not control a resource.
+    threads,    //!< The option is the number of threads.
+    memory_mib, //!< The option is the memory budget in mebibytes (MiB).
+    memory_gib  //!< The option is the memory budget in gibibytes (GiB).
+};
+
 /*!\brief Option struct that is passed to the `sharg::parser::add_option()` function.
  * \ingroup parser
  *
@@ -33,6 +47,8 @@ namespace sharg
  * | sharg::config::advanced             |           ✓          |      ✓      |              X            |
  * | sharg::config::hidden               |           ✓          |      ✓      |              X            |
  * | sharg::config::required             |           ✓          |      ✓      |             (✓)           |
+ * | sharg::config::environment_variable |           ✓          |      ✓      |              X            |
+ * | sharg::config::resource             |           ✓          |      X      |              X            |
  * | sharg::config::validator            |           ✓          |     (✓)     |              ✓            |
  *
  * \details
@@ -128,6 +144,39 @@ struct config
      */
     bool required{false};
 
+    /*!\brief The name of an environment variable that provides the value if the option is not given on the command
+     *        line.
+     *
+     * The value is parsed and validated like a value given on the command line. A container option receives it as a
+     * single value. A flag is set by `true` or `1` and left unset by `false` or `0`.
+     * The precedence is: command line, environment variable, configuration file (see
+     * sharg::parser::add_config_file_option), default value.
+     *
+     * \attention This parameter cannot be set for positional options added with
+     *            sharg::parser::add_positional_option and will trigger a sharg::design_error.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    std::string environment_variable{};
+
+    /*!\brief The compute resource the option controls, e.g. the number of threads.
+     *
+     * The CWL export (`--export-help cwl`) derives a `ResourceRequirement` from the value of the option: `coresMin`
+     * for sharg::resource_kind::threads and `ramMin` for the memory budget. The CTD export tags the parameter with
+     * `threads`, `memory_mib` or `memory_gib`. Workflow systems can use these hints to schedule the tool.
+     *
+     * ### Example
+     *
+     * `parser.add_option(threads, sharg::config{.long_id = "threads", .resource = sharg::resource_kind::threads})`
+     *
+     * \attention Only one option per parser can be the number of threads and only one the memory budget.
+     *            The option must be an integral number. Flags and positional options cannot control a resource.
+     *            Violations trigger a sharg::design_error.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    resource_kind resource{resource_kind::none};
+
     /*!\brief A sharg::validator that verifies the value after parsing (callable).
      * \details
      * \stableapi{Since version 1.0.}
@@ -0,0 +1,389 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::config_file_watcher.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+#    include <poll.h>
+#    include <unistd.h>
+
+#    include <sys/inotify.h>
+#endif
+
+#include <sharg/detail/config_file.hpp>
+#include <sharg/parser_schema.hpp>
+
+namespace sharg
+{
+
+/*!\brief Keeps the values of a sharg::parser_schema up to date with a configuration file while the program runs.
+ * \ingroup parser
+ * \tparam options_t The type holding the values; see sharg::parser_schema.
+ *
+ * \details
+ *
+ * Long-running services, e.g. a server that loaded a large index, can change tunables like a batch size without a
+ * restart. The watcher reads the file on construction and whenever it changes. The file has the syntax described for
+ * sharg::parser::add_config_file_option; only the keys before the first section are read, and each key is the long
+ * identifier of an option or flag of the schema.
+ *
+ * On a change, only the keys whose values differ from the previous version of the file are parsed, and only their
+ * validators are run. A key that was removed is reset to the default of the schema. All other values are kept.
+ * The result is published as a new, immutable sharg::config_file_watcher::snapshot with an increased version number:
+ *
+ * \include test/snippet/config_file_watcher.cpp
+ *
+ * If the changed file is invalid, e.g. because a value does not pass its validator, the current snapshot is kept and
+ * the error callback is called instead. The file is read again on the next change.
+ *
+ * On Linux, sharg::config_file_watcher::start watches the directory of the file with inotify, such that files that are
+ * replaced by a rename (as many editors do) are detected as well. On other systems, the modification time is polled.
+ *
+ * ### Thread safety
+ *
+ * sharg::config_file_watcher::current may be called concurrently with a reload. The callbacks are called by the
+ * thread that reloads the file, i.e. the watching thread after sharg::config_file_watcher::start.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <typename options_t>
+    requires std::copy_constructible<options_t>
+class config_file_watcher
+{
+public:
+    //!\brief A version of the values.
+    struct snapshot
+    {
+        //!\brief The version; 0 for the values read on construction, increased by one for each change.
+        size_t version;
+        //!\brief The values.
+        options_t options;
+    };
+
+    //!\brief The type of the function that is called with the new snapshot and the changed keys.
+    using change_callback_t = std::function<void(snapshot const &, std::vector<std::string> const &)>;
+    //!\brief The type of the function that is called if the changed file is invalid.
+    using error_callback_t = std::function<void(parser_error const &)>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    config_file_watcher() = delete;                                        //!< Deleted.
+    config_file_watcher(config_file_watcher const &) = delete;             //!< Deleted.
+    config_file_watcher & operator=(config_file_watcher const &) = delete; //!< Deleted.
+    config_file_watcher(config_file_watcher &&) = delete;                  //!< Deleted.
+    config_file_watcher & operator=(config_file_watcher &&) = delete;      //!< Deleted.
+
+    /*!\brief Reads the configuration file.
+     * \param[in] schema The options of the configuration file; must outlive the watcher.
+     * \param[in] path The path to the configuration file.
+     * \throws sharg::parser_error if the file cannot be read or contains invalid values.
+     */
+    config_file_watcher(parser_schema<options_t> const & schema, std::filesystem::path path) :
+        schema{schema},
+        path{std::move(path)}
+    {
+        options_t options{*schema.defaults};
+        update(options);
+        current_snapshot = std::make_shared<snapshot const>(snapshot{0u, std::move(options)});
+    }
+
+    //!\brief Stops watching the file.
+    ~config_file_watcher()
+    {
+        stop();
+    }
+    //!\}
+
+    /*!\name Callbacks
+     * \brief The callbacks must be set before calling sharg::config_file_watcher::start.
+     * \{
+     */
+    //!\brief Sets the function that is called with the new snapshot and the sorted keys that changed.
+    void on_change(change_callback_t callback)
+    {
+        change_callback = std::move(callback);
+    }
+
+    //!\brief Sets the function that is called if the changed file cannot be read or contains invalid values.
+    void on_error(error_callback_t callback)
+    {
+        error_callback = std::move(callback);
+    }
+    //!\}
+
+    //!\brief Returns the current snapshot. The snapshot stays valid even if a newer one is published.
+    std::shared_ptr<snapshot const> current() const
+    {
+        std::lock_guard lock{snapshot_mutex};
+        return current_snapshot;
+    }
+
+    /*!\brief Reads the file and publishes a new snapshot if any value changed.
+     * \returns `true` if a new snapshot was published.
+     * \details
+     * Errors are passed to the error callback. This function is called by the watching thread; it only needs to be
+     * called manually if the file is not watched.
+     */
+    bool reload()
+    {
+        std::lock_guard lock{reload_mutex};
+
+        try
+        {
+            std::shared_ptr<snapshot const> const previous = current();
+            options_t options{previous->options};
+            std::vector<std::string> changed_keys = update(options);
+
+            if (changed_keys.empty())
+                return false;
+
+            auto next = std::make_shared<snapshot const>(snapshot{previous->version + 1u, std::move(options)});
+            {
+                std::lock_guard snapshot_lock{snapshot_mutex};
+                current_snapshot = next;
+            }
+
+            if (change_callback)
+                change_callback(*next, changed_keys);
+
+            return true;
+        }
+        catch (parser_error const & error)
+        {
+            if (error_callback)
+                error_callback(error);
+
+            return false;
+        }
+    }
+
+    /*!\brief Starts a thread that calls sharg::config_file_watcher::reload whenever the file changes.
+     * \details
+     * Does nothing if the file is already watched.
+     */
+    void start()
+    {
+        if (watcher.joinable())
+            return;
+
+        stop_requested = false;
+        watcher = std::thread{[this]()
+                              {
+                                  watch();
+                              }};
+    }
+
+    //!\brief Stops the thread started by sharg::config_file_watcher::start.
+    void stop()
+    {
+        stop_requested = true;
+
+        if (watcher.joinable())
+            watcher.join();
+    }
+
+private:
+    //!\brief The options of the configuration file.
+    parser_schema<options_t> const & schema;
+    //!\brief The path to the configuration file.
+    std::filesystem::path path;
+    //!\brief The values of each key in the last version of the file that was read successfully.
+    std::map<std::string, std::vector<std::string>, std::less<>> file_values{};
+
+    //!\brief Protects sharg::config_file_watcher::current_snapshot.
+    mutable std::mutex snapshot_mutex{};
+    //!\brief The current snapshot.
+    std::shared_ptr<snapshot const> current_snapshot{};
+    //!\brief Serialises calls to sharg::config_file_watcher::reload.
+    std::mutex reload_mutex{};
+
+    //!\brief See sharg::config_file_watcher::on_change.
+    change_callback_t change_callback{};
+    //!\brief See sharg::config_file_watcher::on_error.
+    error_callback_t error_callback{};
+
+    //!\brief The watching thread.
+    std::thread watcher{};
+    //!\brief Tells the watching thread to stop.
+    std::atomic<bool> stop_requested{false};
+
+    //!\brief How long the watching thread waits before checking sharg::config_file_watcher::stop_requested.
+    static constexpr std::chrono::milliseconds poll_interval{100};
+
+    /*!\brief Reads the file and parses the keys whose values changed into `options`.
+     * \param[in, out] options The values of the previous version; only the changed ones are modified.
+     * \returns The changed keys in sorted order.
+     * \throws sharg::parser_error if the file cannot be read or contains invalid values.
+     * \details
+     * sharg::config_file_watcher::file_values is only updated if no error occurred.
+     */
+    std::vector<std::string> update(options_t & options)
+    {
+        detail::config_file const file{path};
+        std::map<std::string, std::vector<std::string>, std::less<>> values{};
+        std::map<std::string_view, size_t, std::less<>> lines{};
+
+        for (detail::config_file::entry const & entry : file.entries())
+        {
+            if (!entry.section.empty())
+                continue;
+
+            values[std::string{entry.key}].emplace_back(entry.value);
+            lines.emplace(entry.key, entry.line);
+        }
+
+        std::vector<std::string> changed_keys{};
+        for (auto const & [key, key_values] : values)
+        {
+            auto it = file_values.find(key);
+            if (it == file_values.end() || it->second != key_values)
+                changed_keys.push_back(key);
+        }
+        for (auto const & [key, key_values] : file_values)
+        {
+            if (!values.contains(key))
+                changed_keys.push_back(key);
+        }
+        std::ranges::sort(changed_keys);
+
+        std::string const location = "in the configuration file \"" + path.string() + "\" in line ";
+        std::vector<std::string> arguments{};
+        std::vector<typename parser_schema<options_t>::operation const *> changed_operations{};
+
+        for (std::string const & key : changed_keys)
+        {
+            auto op = std::ranges::find(schema.operations, key, &parser_schema<options_t>::operation::long_id);
+            auto value_it = values.find(key);
+
+            if (op == schema.operations.end())
+            {
+                if (value_it == values.end()) // An unknown key was removed.
+                    continue;
+
+                throw unknown_option{"Unknown option " + key + " " + location + std::to_string(lines.at(key))
+                                     + ". See -h/--help for program information."};
+            }
+
+            // The value of a removed key is the default.
+            op->reset(options, *schema.defaults);
+            changed_operations.push_back(std::to_address(op));
+
+            if (value_it == values.end())
+                continue;
+
+            for (std::string const & value : value_it->second)
+            {
+                if (op->kind != parser_schema<options_t>::table_type::kind::flag)
+                    arguments.push_back("--" + key + "=" + value);
+                else if (value == "1" || value == "true")
+                    arguments.push_back("--" + key);
+                else if (value != "0" && value != "false")
+                    throw user_input_error{"Value for flag --" + key + " " + location + std::to_string(lines.at(key))
+                                           + " must be true (1) or false (0)."};
+            }
+        }
+
+        // Only the changed options are added, hence only their validators are run.
+        typename parser_schema<options_t>::table_type changed_table{};
+
+        for (auto const * op : changed_operations)
+            changed_table.add(op->kind, op->step);
+
+        std::pmr::monotonic_buffer_resource arena{};
+        detail::format_parse format{detail::format_parse::argument_list{arguments.begin(), arguments.end(), &arena}};
+        parse_result{format.try_parse(changed_table, options, true)}.value();
+
+        file_values = std::move(values);
+        return changed_keys;
+    }
+
+    //!\brief Calls sharg::config_file_watcher::reload whenever the file changes, until a stop is requested.
+    void watch()
+    {
+#ifdef __linux__
+        int const descriptor = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        std::filesystem::path const directory = path.has_parent_path() ? path.parent_path() : ".";
+
+        if (descriptor != -1 && ::inotify_add_watch(descriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) != -1)
+        {
+            watch_inotify(descriptor);
+            ::close(descriptor);
+            return;
+        }
+
+        if (descriptor != -1)
+            ::close(descriptor);
+#endif
+        watch_modification_time();
+    }
+
+#ifdef __linux__
+    //!\brief Reloads the file on inotify events of the watched directory that refer to the file.
+    void watch_inotify(int const descriptor)
+    {
+        alignas(inotify_event) char buffer[4096];
+        std::string const filename = path.filename().string();
+
+        while (!stop_requested)
+        {
+            pollfd request{descriptor, POLLIN, 0};
+
+            if (::poll(&request, 1, static_cast<int>(poll_interval.count())) <= 0)
+                continue;
+
+            bool file_changed{false};
+
+            for (ssize_t length; (length = ::read(descriptor, buffer, sizeof(buffer))) > 0;)
+            {
+                for (char const * it = buffer; it < buffer + length;)
+                {
+                    auto const * event = reinterpret_cast<inotify_event const *>(it);
+                    file_changed |= event->len > 0u && filename == event->name;
+                    it += sizeof(inotify_event) + event->len;
+                }
+            }
+
+            if (file_changed)
+                reload();
+        }
+    }
+#endif
+
+    //!\brief Reloads the file whenever its modification time or size changes.
+    void watch_modification_time()
+    {
+        auto status = [this]()
+        {
+            std::error_code error{};
+            auto const time = std::filesystem::last_write_time(path, error);
+            auto const size = std::filesystem::file_size(path, error);
+            return std::pair{time, size};
+        };
+
+        for (auto last_status = status(); !stop_requested; std::this_thread::sleep_for(poll_interval))
+        {
+            if (auto const current_status = status(); current_status != last_status)
+            {
+                last_status = current_status;
+                reload();
+            }
+        }
+    }
+};
+
+} // namespace sharg
@@ -9,13 +9,60 @@
 
 #pragma once
 
+#include <ranges>
 #include <string>
+#include <tuple>
 
 #include <sharg/platform.hpp>
 
 namespace sharg::detail
 {
 
+/*!\concept sharg::detail::is_insertable_container_option
+ * \ingroup misc
+ * \brief Whether the option type is a container that grows when values are added, e.g. std::vector or std::set.
+ * \details
+ *
+ * The `option_type` must:
+ * * not be `std::string`
+ * * provide a member function `push_back(value_type)` or `insert(value_type)`
+ *
+ * \noapi
+ */
+// clang-format off
+template <typename option_type>
+concept is_insertable_container_option = (!std::is_same_v<std::remove_cvref_t<option_type>, std::string>) &&
+                                         (requires (option_type container,
+                                                    std::ranges::range_value_t<option_type> value)
+                                          {
+                                              { container.push_back(std::move(value)) };
+                                          } ||
+                                          requires (option_type container,
+                                                    std::ranges::range_value_t<option_type> value)
+                                          {
+                                              { container.insert(std::move(value)) };
+                                          });
+// clang-format on
+
+/*!\concept sharg::detail::is_fixed_size_container_option
+ * \ingroup misc
+ * \brief Whether the option type is a container with a size known at compile time, e.g. std::array.
+ * \details
+ *
+ * The `option_type` must:
+ * * specialise `std::tuple_size`
+ * * be a random access range whose elements can be assigned
+ *
+ * \noapi
+ */
+// clang-format off
+template <typename option_type>
+concept is_fixed_size_container_option = requires { std::tuple_size<std::remove_cvref_t<option_type>>::value; } &&
+                                         std::ranges::random_access_range<option_type> &&
+                                         std::ranges::output_range<option_type,
+                                                                   std::ranges::range_value_t<option_type>>;
+// clang-format on
+
 /*!\concept sharg::detail::is_container_option
  * \ingroup misc
  * \brief Whether the option type is considered to be a container.
@@ -26,21 +73,14 @@ namespace sharg::detail
  *
  * In general, all standard library containers except std::string can be considered containers.
  *
- * In order to be considered a container, the `option_type` must:
- * * not be `std::string`
- * * define a member type `value_type`
- * * provide a member function `push_back(value_type)`
+ * In order to be considered a container, the `option_type` must model either
+ * sharg::detail::is_insertable_container_option (e.g. std::vector, std::list, std::set or std::unordered_set) or
+ * sharg::detail::is_fixed_size_container_option (e.g. std::array).
  *
  * \noapi
  */
-// clang-format off
 template <typename option_type>
-concept is_container_option = (!std::is_same_v<std::remove_cvref_t<option_type>, std::string>) &&
-                              requires (option_type container,
-                                        typename std::ranges::range_value_t<option_type> value)
-                              {
-                                  { container.push_back(value) };
-                              };
-// clang-format on
+concept is_container_option =
+    is_insertable_container_option<option_type> || is_fixed_size_container_option<option_type>;
 
 } // namespace sharg::detail
@@ -0,0 +1,371 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::config_file.
+ */
+
+#pragma once
+
+#include <deque>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#else
+#    include <fstream>
+#    include <iterator>
+#endif
+
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief A read-only view of the contents of a file that is memory-mapped where possible.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * On POSIX systems the file is mapped with `mmap`; otherwise it is read into memory.
+ */
+class mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_file() = delete;                                //!< Deleted.
+    mapped_file(mapped_file const &) = delete;             //!< Deleted.
+    mapped_file & operator=(mapped_file const &) = delete; //!< Deleted.
+    mapped_file(mapped_file &&) = delete;                  //!< Deleted.
+    mapped_file & operator=(mapped_file &&) = delete;      //!< Deleted.
+
+    /*!\brief Maps the file at `path`.
+     * \param[in] path The path to the file.
+     * \param[in] kind The kind of the file for the error message, e.g. "configuration file".
+     * \throws sharg::validation_error if the file cannot be opened or mapped.
+     */
+    explicit mapped_file(std::filesystem::path const & path, std::string_view const kind = "configuration file")
+    {
+        std::string const message = "Cannot read the " + std::string{kind} + " \"" + path.string() + "\".";
+
+#ifndef _WIN32
+        int const descriptor = ::open(path.c_str(), O_RDONLY);
+
+        if (descriptor == -1)
+            throw validation_error{message};
+
+        struct stat status{};
+        bool const is_regular_file = ::fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode);
+
+        if (is_regular_file && status.st_size > 0)
+        {
+            size = static_cast<size_t>(status.st_size);
+            address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        }
+
+        ::close(descriptor); // The mapping stays valid.
+
+        if (!is_regular_file || address == MAP_FAILED)
+            throw validation_error{message};
+#else
+        std::ifstream stream{path, std::ios::binary};
+
+        if (!stream)
+            throw validation_error{message};
+
+        buffer.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+#endif
+    }
+
+    //!\brief Unmaps the file.
+    ~mapped_file()
+    {
+#ifndef _WIN32
+        if (size > 0u)
+            ::munmap(address, size);
+#endif
+    }
+    //!\}
+
+    //!\brief Returns the contents of the file.
+    std::string_view contents() const noexcept
+    {
+#ifndef _WIN32
+        return size > 0u ? std::string_view{static_cast<char const *>(address), size} : std::string_view{};
+#else
+        return buffer;
+#endif
+    }
+
+private:
+#ifndef _WIN32
+    //!\brief The address of the mapping.
+    void * address{nullptr};
+    //!\brief The size of the mapping; 0 if the file is empty.
+    size_t size{};
+#else
+    //!\brief The contents of the file.
+    std::string buffer{};
+#endif
+};
+
+/*!\brief Reads option values from a configuration file in a subset of the INI/TOML syntax.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The file is memory-mapped and tokenized in a single pass. The keys and values are views into the mapping; only
+ * quoted values that contain escape sequences are copied. See sharg::parser::add_config_file_option for the syntax.
+ */
+class config_file
+{
+public:
+    //!\brief A single value of a key.
+    struct entry
+    {
+        std::string_view section; //!< The section, e.g. the subcommand, or empty before the first section.
+        std::string_view key;     //!< The key, i.e. the long identifier of an option or flag.
+        std::string_view value;   //!< The unquoted value.
+        size_t line;              //!< The line number, starting at 1.
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    config_file() = delete;                                //!< Deleted.
+    config_file(config_file const &) = delete;             //!< Deleted.
+    config_file & operator=(config_file const &) = delete; //!< Deleted.
+    config_file(config_file &&) = delete;                  //!< Deleted.
+    config_file & operator=(config_file &&) = delete;      //!< Deleted.
+    ~config_file() = default;                              //!< Defaulted.
+
+    /*!\brief Reads the configuration file at `path`.
+     * \param[in] path The path to the file.
+     * \throws sharg::validation_error if the file cannot be read.
+     * \throws sharg::user_input_error if the file contains a syntax error.
+     */
+    explicit config_file(std::filesystem::path const & path) : path{path}, file{path}
+    {
+        std::string_view text = file.contents();
+        std::string_view section{};
+
+        for (size_t line_number = 1u; !text.empty(); ++line_number)
+        {
+            size_t const line_end = text.find('\n');
+            std::string_view const line = text.substr(0u, line_end);
+            text.remove_prefix(line_end == std::string_view::npos ? text.size() : line_end + 1u);
+
+            read_line(trim(line), section, line_number);
+        }
+    }
+    //!\}
+
+    //!\brief Returns the values in the order they appear in the file.
+    std::span<entry const> entries() const noexcept
+    {
+        return entries_;
+    }
+
+private:
+    //!\brief The path to the file.
+    std::filesystem::path path;
+    //!\brief The contents of the file.
+    mapped_file file;
+    //!\brief The values.
+    std::vector<entry> entries_{};
+    //!\brief Storage for quoted values that contained escape sequences; a deque does not move its elements.
+    std::deque<std::string> unescaped_values{};
+
+    //!\brief Removes leading whitespace.
+    static std::string_view trim_front(std::string_view text) noexcept
+    {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+            text.remove_prefix(1u);
+        return text;
+    }
+
+    //!\brief Removes leading and trailing whitespace, including the `\r` of Windows line endings.
+    static std::string_view trim(std::string_view text) noexcept
+    {
+        text = trim_front(text);
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+            text.remove_suffix(1u);
+        return text;
+    }
+
+    //!\brief Throws a sharg::user_input_error for a syntax error in `line_number`.
+    [[noreturn]] void syntax_error(size_t const line_number, std::string_view const reason) const
+    {
+        throw user_input_error{"Error in the configuration file \"" + path.string() + "\" in line "
+                               + std::to_string(line_number) + ": " + std::string{reason}};
+    }
+
+    /*!\brief Reads a section header, a key with a value or a list of values, or a comment.
+     * \param[in] line The trimmed line.
+     * \param[in, out] section The current section.
+     * \param[in] line_number The line number.
+     */
+    void read_line(std::string_view line, std::string_view & section, size_t const line_number)
+    {
+        if (line.empty() || line.front() == '#' || line.front() == ';')
+            return;
+
+        if (line.front() == '[')
+        {
+            size_t const end = line.find(']');
+
+            if (end == std::string_view::npos)
+                syntax_error(line_number, "Missing ']' after the section name.");
+
+            expect_end_of_line(line.substr(end + 1u), line_number);
+            section = trim(line.substr(1u, end - 1u));
+            return;
+        }
+
+        size_t const equals = line.find('=');
+
+        if (equals == std::string_view::npos)
+            syntax_error(line_number, "Missing '=' after the key.");
+
+        std::string_view const key = trim(line.substr(0u, equals));
+
+        if (key.empty())
+            syntax_error(line_number, "Missing key before '='.");
+
+        std::string_view rest = trim_front(line.substr(equals + 1u));
+
+        if (!rest.starts_with('['))
+        {
+            entries_.push_back(entry{section, key, read_value(rest, line_number), line_number});
+            expect_end_of_line(rest, line_number);
+            return;
+        }
+
+        // A list: key = [value, value, ...]
+        rest = trim_front(rest.substr(1u));
+
+        while (!rest.starts_with(']'))
+        {
+            if (rest.empty() || rest.front() == ',' || rest.front() == '#')
+                syntax_error(line_number, "Expected a value in the list.");
+
+            entries_.push_back(entry{section, key, read_value(rest, line_number, ",]#"), line_number});
+            rest = trim_front(rest);
+
+            if (rest.starts_with(','))
+                rest = trim_front(rest.substr(1u));
+            else if (!rest.starts_with(']'))
+                syntax_error(line_number, "Expected ',' or ']' after a value in the list.");
+        }
+
+        expect_end_of_line(rest.substr(1u), line_number);
+    }
+
+    //!\brief Checks that only whitespace or a comment follows.
+    void expect_end_of_line(std::string_view const rest, size_t const line_number) const
+    {
+        if (std::string_view const remainder = trim_front(rest); !remainder.empty() && remainder.front() != '#')
+            syntax_error(line_number, "Unexpected characters \"" + std::string{remainder} + "\".");
+    }
+
+    /*!\brief Reads a (quoted) value from the front of `rest` and removes it.
+     * \param[in, out] rest The remainder of the line, starting with the value.
+     * \param[in] line_number The line number.
+     * \param[in] delimiters The characters that end an unquoted value, including the comment character `#`.
+     * \returns The value without quotes.
+     *
+     * \details
+     *
+     * Double quoted values may contain the escape sequences `\\`, `\"`, `\n`, `\t` and `\r`. Single quoted values are
+     * taken literally. Unquoted values end at a delimiter or a comment and are trimmed.
+     */
+    std::string_view read_value(std::string_view & rest, size_t const line_number, std::string_view delimiters = "#")
+    {
+        if (rest.starts_with('\''))
+        {
+            size_t const end = rest.find('\'', 1u);
+
+            if (end == std::string_view::npos)
+                syntax_error(line_number, "Missing closing quote.");
+
+            std::string_view const value = rest.substr(1u, end - 1u);
+            rest.remove_prefix(end + 1u);
+            return value;
+        }
+
+        if (rest.starts_with('"'))
+        {
+            size_t end = 1u;
+            while (end < rest.size() && rest[end] != '"')
+                end += (rest[end] == '\\') ? 2u : 1u;
+
+            if (end >= rest.size())
+                syntax_error(line_number, "Missing closing quote.");
+
+            std::string_view const quoted = rest.substr(1u, end - 1u);
+            rest.remove_prefix(end + 1u);
+
+            if (quoted.find('\\') == std::string_view::npos)
+                return quoted;
+
+            return unescape(quoted, line_number);
+        }
+
+        size_t const end = rest.find_first_of(delimiters);
+        std::string_view const value = trim(rest.substr(0u, end));
+        rest.remove_prefix(end == std::string_view::npos ? rest.size() : end);
+        return value;
+    }
+
+    //!\brief Replaces the escape sequences of a double quoted value.
+    std::string_view unescape(std::string_view const quoted, size_t const line_number)
+    {
+        std::string & value = unescaped_values.emplace_back();
+        value.reserve(quoted.size());
+
+        for (size_t i = 0u; i < quoted.size(); ++i)
+        {
+            if (quoted[i] != '\\')
+            {
+                value.push_back(quoted[i]);
+                continue;
+            }
+
+            switch (quoted[++i])
+            {
+                case '\\':
+                    value.push_back('\\');
+                    break;
+                case '"':
+                    value.push_back('"');
+                    break;
+                case 'n':
+                    value.push_back('\n');
+                    break;
+                case 't':
+                    value.push_back('\t');
+                    break;
+                case 'r':
+                    value.push_back('\r');
+                    break;
+                default:
+                    syntax_error(line_number, "Unknown escape sequence \"\\" + std::string{quoted[i]} + "\".");
+            }
+        }
+
+        return value;
+    }
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the registry of help pages and exports that were embedded at build time.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace sharg::detail
+{
+
+/*!\brief A help page or export that was captured at build time. See `sharg_embed_exports` in `sharg-config.cmake`.
+ * \ingroup parser
+ */
+struct embedded_export
+{
+    //!\brief The format: `help`, `advanced-help`, `version`, `copyright`, or an `--export-help` format, e.g. `html`.
+    std::string_view format;
+    //!\brief The sharg::detail::format_fingerprint of the parser that created the output.
+    uint64_t fingerprint;
+    //!\brief The command the output was captured with, e.g. `raptor build`; part of the CTD, CWL and JSON exports.
+    std::string_view command;
+    //!\brief The output.
+    std::string_view contents;
+};
+
+/*!\brief Returns the exports that were registered by sharg::detail::embedded_exports_registration.
+ * \ingroup parser
+ * \details
+ * The registry is empty unless the program was built with `sharg_embed_exports`.
+ */
+inline std::vector<embedded_export> & embedded_exports()
+{
+    static std::vector<embedded_export> exports{};
+    return exports;
+}
+
+/*!\brief Registers embedded exports on construction. The source file generated by `sharg_embed_exports` defines a
+ *        static object of this type.
+ * \ingroup parser
+ */
+struct embedded_exports_registration
+{
+    //!\brief Adds `exports` to sharg::detail::embedded_exports.
+    embedded_exports_registration(std::initializer_list<embedded_export> const exports)
+    {
+        embedded_exports().insert(embedded_exports().end(), exports.begin(), exports.end());
+    }
+};
+
+/*!\brief Looks up an embedded export.
+ * \param[in] format The format, see sharg::detail::embedded_export::format.
+ * \param[in] fingerprint The fingerprint of the current parser.
+ * \param[in] command The command the program was called with.
+ * \returns The embedded output, or `std::nullopt` if there is no export for this parser.
+ * \details
+ * The command is only compared for the CTD, CWL and JSON exports and the completion scripts, which contain it.
+ */
+inline std::optional<std::string_view>
+find_embedded_export(std::string_view const format, uint64_t const fingerprint, std::string_view const command)
+{
+    bool const contains_command = format == "ctd" || format == "cwl" || format == "json" || format == "bash"
+                               || format == "zsh" || format == "fish";
+
+    auto it = std::ranges::find_if(embedded_exports(),
+                                   [&](embedded_export const & entry)
+                                   {
+                                       return entry.format == format && entry.fingerprint == fingerprint
+                                           && (!contains_command || entry.command == command);
+                                   });
+
+    if (it == embedded_exports().end())
+        return std::nullopt;
+
+    return it->contents;
+}
+
+} // namespace sharg::detail
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::for_each_environment_variable.
+ */
+
+#pragma once
+
+#include <string_view>
+
+#ifdef _WIN32
+#    include <cstdlib> // _environ
+#else
+// POSIX only guarantees the declaration of `environ` if it is declared by the program itself.
+extern char ** environ;
+#endif
+
+namespace sharg::detail
+{
+
+/*!\brief Calls `fn(name, value)` for each variable in the environment of the process.
+ * \ingroup parser
+ * \param[in] fn The function to call with the name and value of each variable as std::string_view.
+ *
+ * \details
+ *
+ * The environment is scanned once. In contrast to calling `std::getenv` for each name of interest, the cost does
+ * not depend on the number of names that are looked up.
+ */
+template <typename fn_t>
+void for_each_environment_variable(fn_t && fn)
+{
+#ifdef _WIN32
+    char ** variables = _environ;
+#else
+    char ** variables = environ;
+#endif
+
+    if (variables == nullptr)
+        return;
+
+    for (; *variables != nullptr; ++variables)
+    {
+        std::string_view const variable{*variables};
+
+        if (size_t const equals = variable.find('='); equals != std::string_view::npos)
+            fn(variable.substr(0u, equals), variable.substr(equals + 1u));
+    }
+}
+
+} // namespace sharg::detail
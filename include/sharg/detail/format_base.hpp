@@ -10,10 +10,15 @@
 
 #pragma once
 
+#include <cctype>
+#include <charconv>
+#include <iostream>
+
 #include <sharg/auxiliary.hpp>
 #include <sharg/config.hpp>
 #include <sharg/detail/concept.hpp>
 #include <sharg/detail/type_name_as_string.hpp>
+#include <sharg/flag_set.hpp>
 #include <sharg/validators.hpp>
 
 #if __has_include(<seqan3/version.hpp>)
@@ -29,6 +34,10 @@ namespace sharg::detail
  */
 class format_base
 {
+public:
+    //!\brief The number of elements of a container default that are shown. See sharg::parser_meta_data.
+    size_t default_message_element_limit{SHARG_DEFAULT_MESSAGE_ELEMENT_LIMIT};
+
 protected:
     /*!\brief Returns the input type as a string (reflection).
      * \tparam value_type The type whose name is converted std::string.
@@ -105,6 +114,16 @@ protected:
         return ("(\\fIList\\fP of \\fI" + get_type_name_as_string(container) + "\\fP)");
     }
 
+    /*!\brief Formats a sharg::flag_set and the names of its values for the help page printing.
+     * \tparam enum_t The type of the enumeration.
+     * \returns The names of the values, encapsulated in "Subset of", e.g. "(Subset of [a, b, c])".
+     */
+    template <typename enum_t>
+    static std::string option_type_and_list_info(flag_set<enum_t> const & /**/)
+    {
+        return ("(\\fISubset\\fP of \\fI" + detail::enumeration_keys<enum_t>() + "\\fP)");
+    }
+
     /*!\brief Formats the option/flag identifier pair for the help page printing.
      * \param[in] short_id The short identifier of the option/flag.
      * \param[in] long_id  The long identifier of the option/flag.
@@ -188,58 +207,175 @@ protected:
      * \param[in] value The default value to get the default message for.
      * \returns The default message for the help page (" Default: <default-value>. ").
      * \details
+     * See format_base::append_default_message.
+     */
+    template <typename option_type, typename default_type>
+    std::string get_default_message(option_type const & option, default_type const & value) const
+    {
+        std::string message{};
+        append_default_message(message, option, value);
+        return message;
+    }
+
+    /*!\brief Appends the default message for the help page to `out`.
+     * \tparam option_type The type of the option.
+     * \tparam default_type  The type of the default value.
+     * \param[in, out] out The string to append to, e.g. the description of the option.
+     * \param[in] option The option to get the default message for.
+     * \param[in] value The default value to get the default message for.
+     * \details
      * `value` is either `config.default_message`, or the same as `option`.
      * If the `option_type` is a std::string or std::filesystem::path, the value is quoted.
      * If the `option_type` is a container of std::string or std::filesystem::path, each individual value is quoted;
      * if a `config.default_message` is provided, it will not be quoted.
+     * Only the first format_base::default_message_element_limit elements of a container are printed.
      */
     template <typename option_type, typename default_type>
-    static std::string get_default_message(option_type const & SHARG_DOXYGEN_ONLY(option), default_type const & value)
+    void append_default_message(std::string & out,
+                                option_type const & SHARG_DOXYGEN_ONLY(option),
+                                default_type const & value) const
     {
         static_assert(std::same_as<option_type, default_type> || std::same_as<default_type, std::string>);
 
-        std::stringstream message{};
-        message << " Default: ";
+        out += " Default: ";
 
-        if constexpr (detail::is_container_option<option_type>)
+        if constexpr (std::same_as<default_type, std::string>)
         {
-            // If we have a list of strings, we want to quote each string.
-            if constexpr (std::same_as<std::ranges::range_value_t<default_type>, std::string>)
-            {
-                auto view = std::views::transform(value,
-                                                  [](auto const & val)
-                                                  {
-                                                      return std::quoted(val);
-                                                  });
-                message << detail::to_string(view);
-            }
-            else // Otherwise we just print the list or the default_message without quotes.
+            // Quote: std::string (from value + default_message), and std::filesystem::path (default_message).
+            if constexpr (std::same_as<option_type, std::string> || std::same_as<option_type, std::filesystem::path>)
+                append_quoted(out, value);
+            else
+                out += value;
+        }
+        else if constexpr (detail::is_container_option<option_type>)
+        {
+            size_t const limit = default_message_element_limit;
+            size_t count{};
+
+            out += '[';
+            for (auto const & element : value)
             {
-                message << detail::to_string(value);
+                if (count == limit && limit != 0u)
+                {
+                    out += ", ... (";
+                    out += std::to_string(std::ranges::distance(value));
+                    out += " elements)";
+                    break;
+                }
+
+                if (count++ != 0u)
+                    out += ", ";
+
+                append_default_value(out, element);
             }
+            out += ']';
         }
         else
         {
-            static constexpr bool option_is_string = std::same_as<option_type, std::string>;
-            static constexpr bool option_is_path = std::same_as<option_type, std::filesystem::path>;
-            static constexpr bool value_is_string = std::same_as<default_type, std::string>;
+            append_default_value(out, value);
+        }
+    }
 
-            // Quote: std::string (from value + default_message), and std::filesystem::path (default_message).
-            // std::filesystem::path is quoted by the STL's operator<< in detail::to_string.
-            static constexpr bool needs_string_quote = option_is_string || (option_is_path && value_is_string);
+    /*!\brief Returns the name of a sharg::resource_kind, e.g. `threads`; empty for sharg::resource_kind::none.
+     * \param[in] kind The resource an option controls. See sharg::config::resource.
+     */
+    static std::string_view resource_name(resource_kind const kind)
+    {
+        switch (kind)
+        {
+            case resource_kind::threads:
+                return "threads";
+            case resource_kind::memory_mib:
+                return "memory_mib";
+            case resource_kind::memory_gib:
+                return "memory_gib";
+            default:
+                return {};
+        }
+    }
 
-            if constexpr (needs_string_quote)
-                message << std::quoted(value);
-            else
-                message << detail::to_string(value);
+private:
+    /*!\brief Appends a single default value to `out`.
+     * \param[in, out] out The string to append to.
+     * \param[in] value The value; a std::string or std::filesystem::path is quoted.
+     * \details
+     * Arithmetic values are written with std::to_chars instead of a stream. The output is the same as
+     * sharg::detail::to_string: `bool` is printed as 0/1, and floating point values as with `%g`.
+     */
+    template <typename value_type>
+    static void append_default_value(std::string & out, value_type const & value)
+    {
+        [[maybe_unused]] char buffer[64];
+
+        if constexpr (std::same_as<value_type, bool>)
+        {
+            out += value ? '1' : '0';
+        }
+        else if constexpr (std::integral<value_type> && !is_character<value_type>)
+        {
+            auto const result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, result.ptr);
+        }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        else if constexpr (std::floating_point<value_type>)
+        {
+            auto const result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6);
+            out.append(buffer, result.ptr);
         }
+#endif
+        else if constexpr (std::same_as<value_type, std::string>)
+        {
+            append_quoted(out, value);
+        }
+        else if constexpr (std::same_as<value_type, std::filesystem::path>)
+        {
+            append_quoted(out, value.string());
+        }
+        else
+        {
+            out += detail::to_string(value);
+        }
+    }
 
-        return message.str();
+    //!\brief Appends `text` to `out`, quoted as by std::quoted.
+    static void append_quoted(std::string & out, std::string_view const text)
+    {
+        out += '"';
+        for (char const c : text)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        out += '"';
+    }
+
+    //!\brief Whether `type` is a character type, which is printed as a character rather than a number.
+    template <typename type>
+    static constexpr bool is_character = std::same_as<type, char> || std::same_as<type, wchar_t>
+                                      || std::same_as<type, char8_t> || std::same_as<type, char16_t>
+                                      || std::same_as<type, char32_t>;
+};
+
+/*!\brief Restricts the help page to the elements that match `--help=<pattern>` and `--help-section=<name>`.
+ * \ingroup parser
+ */
+struct help_filter
+{
+    //!\brief Only options, flags, list items and lines whose identifiers or description contain the pattern are shown.
+    std::string pattern{};
+    //!\brief Only elements in a section or subsection whose title contains the name are shown.
+    std::string section{};
+
+    //!\brief Whether the help page is restricted.
+    bool active() const
+    {
+        return !pattern.empty() || !section.empty();
     }
 };
 
 /*!\brief The format that contains all helper functions needed in all formats for
- *        printing the interface description of the application (to std::cout).
+ *        printing the interface description of the application (to std::cout by default).
  * \ingroup parser
  * \remark For a complete overview, take a look at \ref parser
  */
@@ -261,14 +397,21 @@ private:
      * \param[in] names    A list of subcommands (see \link subcommand_parse subcommand parsing \endlink).
      * \param[in] version_updates Whether the developer disabled version checks when constructing the parser.
      * \param[in] advanced Set to `true` to show advanced options.
+     * \param[in] page_filter Restricts the page to matching elements; advanced options are matched as well.
      */
     format_help_base(std::vector<std::string> const & names,
                      update_notifications const version_updates,
-                     bool const advanced) :
+                     bool const advanced,
+                     help_filter const & page_filter = {}) :
         version_check_dev_decision{version_updates},
         command_names{names},
-        show_advanced_options{advanced}
-    {}
+        show_advanced_options{advanced || page_filter.active()},
+        filter{lowercase(page_filter.pattern), lowercase(page_filter.section)}
+    {
+        // The options that are added before the first section belong to the section "Options".
+        if (filter.active())
+            add_heading("Options", true);
+    }
     //!\}
 
 public:
@@ -278,17 +421,27 @@ public:
     template <typename option_type, typename validator_t>
     void add_option(option_type & value, config<validator_t> const & config)
     {
+        if (is_skipped(config))
+            return;
+
         std::string id = prep_id_for_help(config.short_id, config.long_id) + " " + option_type_and_list_info(value);
         std::string info{config.description};
 
         if (config.default_message.empty())
-            info += ((config.required) ? std::string{} : get_default_message(value, value));
+        {
+            if (!config.required)
+                append_default_message(info, value, value);
+        }
         else
-            info += get_default_message(value, config.default_message);
+        {
+            append_default_message(info, value, config.default_message);
+        }
 
         if (auto const & validator_message = config.validator.get_help_page_message(); !validator_message.empty())
             info += ". " + validator_message;
 
+        append_environment_variable(info, config.environment_variable);
+
         store_help_page_element(
             [this, id, info]()
             {
@@ -297,16 +450,61 @@ public:
             config);
     }
 
+    /*!\brief Adds a sharg::print_list_item call to be evaluated later on. The default value is only computed when
+     *        the help page is printed.
+     * \copydetails sharg::parser::add_option(option_type &, config<validator_type>, default_provider_type)
+     */
+    template <typename option_type, typename validator_t, typename default_provider_t>
+    void add_option(option_type & value,
+                    config<validator_t> const & config,
+                    default_provider_t const & default_provider)
+    {
+        if (!config.default_message.empty())
+            return add_option(value, config);
+
+        if (is_skipped(config))
+            return;
+
+        std::string id = prep_id_for_help(config.short_id, config.long_id) + " " + option_type_and_list_info(value);
+        std::string validator_message = config.validator.get_help_page_message();
+
+        if (!validator_message.empty())
+            validator_message.insert(0, ". ");
+
+        store_help_page_element(
+            [this,
+             id,
+             description = config.description,
+             validator_message,
+             environment_variable = config.environment_variable,
+             &default_provider]()
+            {
+                option_type const default_value = std::invoke(default_provider);
+                std::string info{description};
+                append_default_message(info, default_value, default_value);
+                info += validator_message;
+                append_environment_variable(info, environment_variable);
+                derived_t().print_list_item(id, info);
+            },
+            config);
+    }
+
     /*!\brief Adds a sharg::print_list_item call to be evaluated later on.
      * \copydetails sharg::parser::add_flag
      */
     template <typename validator_t>
     void add_flag(bool & SHARG_DOXYGEN_ONLY(value), config<validator_t> const & config)
     {
+        if (is_skipped(config))
+            return;
+
+        std::string info{config.description};
+        append_environment_variable(info, config.environment_variable);
+
         store_help_page_element(
-            [this, id = prep_id_for_help(config.short_id, config.long_id), description = config.description]()
+            [this, id = prep_id_for_help(config.short_id, config.long_id), info]()
             {
-                derived_t().print_list_item(id, description);
+                derived_t().print_list_item(id, info);
             },
             config);
     }
@@ -317,8 +515,14 @@ public:
     template <typename option_type, typename validator_t>
     void add_positional_option(option_type & value, config<validator_t> const & config)
     {
+        // The positional options are numbered on the help page, also if some are filtered out.
+        unsigned const position = ++positional_option_count;
+
+        if (filter.active() && !matches_filter(config.description, section_matches("Positional Arguments")))
+            return;
+
         // a list at the end may be empty and thus have a default value
-        auto positional_default_message = [&value]() -> std::string
+        auto positional_default_message = [this, &value]() -> std::string
         {
             if constexpr (detail::is_container_option<option_type>)
             {
@@ -342,13 +546,13 @@ public:
         positional_option_calls.push_back(
             [this,
              &value,
+             position,
              default_message = positional_default_message(),
              validator_message = positional_validator_message(),
              description = config.description]()
             {
-                ++positional_option_count;
                 derived_t().print_list_item(detail::to_string("\\fBARGUMENT-",
-                                                              positional_option_count,
+                                                              position,
                                                               "\\fP ",
                                                               option_type_and_list_info(value)),
                                             description + default_message + validator_message);
@@ -357,13 +561,22 @@ public:
 
     /*!\brief Initiates the printing of the help page to std::cout.
      * \param[in] parser_meta The meta information that are needed for a detailed help page.
+     * \details
+     * If the page is filtered (see sharg::detail::help_filter), only the header, the matching elements and the
+     * headings of their sections are printed.
      */
     void parse(parser_meta_data & parser_meta)
     {
         meta = parser_meta;
 
+        // A rough upper bound for typical descriptions avoids reallocations for large parsers.
+        output.reserve(8192u + 256u * (parser_set_up_calls.size() + positional_option_calls.size()));
+
         derived_t().print_header();
 
+        if (filter.active())
+            return print_filtered_page();
+
         if (!meta.synopsis.empty())
         {
             derived_t().print_section("Synopsis");
@@ -409,17 +622,8 @@ public:
 
         // print Common options after developer options
         derived_t().print_subsection("Common options");
-        derived_t().print_list_item("\\fB-h\\fP, \\fB--help\\fP", "Prints the help page.");
-        derived_t().print_list_item("\\fB-hh\\fP, \\fB--advanced-help\\fP",
-                                    "Prints the help page including advanced options.");
-        derived_t().print_list_item("\\fB--version\\fP", "Prints the version information.");
-        derived_t().print_list_item("\\fB--copyright\\fP", "Prints the copyright/license information.");
-        derived_t().print_list_item("\\fB--export-help\\fP (std::string)",
-                                    "Export the help page information. Value must be one of "
-                                        + detail::supported_exports + ".");
-        if (version_check_dev_decision == update_notifications::on)
-            derived_t().print_list_item("\\fB--version-check\\fP (bool)",
-                                        "Whether to check for the newest app version. Default: true");
+        for (auto const & [key, description] : common_options())
+            derived_t().print_list_item(key, description);
 
         if (!meta.examples.empty())
         {
@@ -433,6 +637,8 @@ public:
         print_legal();
 
         derived_t().print_footer();
+
+        write_output();
     }
 
     /*!\brief Adds a print_section call to parser_set_up_calls.
@@ -440,6 +646,9 @@ public:
      */
     void add_section(std::string const & title, bool const advanced_only)
     {
+        if (filter.active())
+            return add_heading(title, true);
+
         store_help_page_element(
             [this, title]()
             {
@@ -454,6 +663,9 @@ public:
      */
     void add_subsection(std::string const & title, bool const advanced_only)
     {
+        if (filter.active())
+            return add_heading(title, false);
+
         store_help_page_element(
             [this, title]()
             {
@@ -468,6 +680,9 @@ public:
      */
     void add_line(std::string const & text, bool is_paragraph, bool const advanced_only)
     {
+        if (filter.active() && !matches_filter(text, in_matching_section))
+            return;
+
         store_help_page_element(
             [this, text, is_paragraph]()
             {
@@ -482,6 +697,9 @@ public:
      */
     void add_list_item(std::string const & key, std::string const & desc, bool const advanced_only)
     {
+        if (filter.active() && !matches_filter(key + ' ' + desc, in_matching_section))
+            return;
+
         store_help_page_element(
             [this, key, desc]()
             {
@@ -491,6 +709,44 @@ public:
             false /* never hidden */);
     }
 
+    /*!\brief Lists the option `--config` in the common options.
+     * \copydetails sharg::parser::add_config_file_option
+     */
+    void add_config_file_option(std::vector<std::filesystem::path> const & default_files)
+    {
+        std::string description{"Read option values from a configuration file. Options given on the command line "
+                                "take precedence."};
+
+        if (!default_files.empty())
+        {
+            auto quoted = std::views::transform(default_files,
+                                                [](std::filesystem::path const & file)
+                                                {
+                                                    return '"' + file.string() + '"';
+                                                });
+            description += " Default: the first existing file of " + detail::to_string(quoted);
+        }
+
+        config_file_option_item = std::pair{std::string{"\\fB--config\\fP (std::filesystem::path)"}, description};
+    }
+
+    /*!\brief Lists the option `--import-params` in the common options.
+     * \copydetails sharg::parser::add_import_params_option
+     */
+    void add_import_params_option()
+    {
+        import_params_option_item =
+            std::pair{std::string{"\\fB--import-params\\fP (std::filesystem::path)"},
+                      std::string{"Read option values from a CTD file or a CWL job file. Options given on the command "
+                                  "line take precedence."}};
+    }
+
+    //!\brief Lists the option `--all-subcommands` in the common options. See sharg::parser::set_subcommand_setup.
+    void add_all_subcommands_option()
+    {
+        all_subcommands_option = true;
+    }
+
     /*!\brief Stores all meta information about the application
      *
      * \details
@@ -507,6 +763,14 @@ public:
      */
     parser_meta_data meta;
 
+    //!\brief The stream the help page is printed to. See sharg::parser::parse(std::ostream &).
+    std::ostream * output_stream{&std::cout};
+
+    /*!\brief The rendered page. The print functions append to it; format_help_base::write_output writes it to
+     *        format_help_base::output_stream at once.
+     */
+    std::string output{};
+
     //!\brief Befriend the derived type so it can access private functions.
     friend derived_type;
 
@@ -520,6 +784,18 @@ protected:
         return static_cast<derived_type &>(*this);
     }
 
+    /*!\brief Writes format_help_base::output to format_help_base::output_stream and clears it.
+     * \details
+     * The page is written with a single call, which results in a single `write` to the terminal or pipe instead of
+     * one per formatted piece.
+     */
+    void write_output()
+    {
+        output_stream->write(output.data(), output.size());
+        output_stream->flush();
+        output.clear();
+    }
+
     //!\brief Prints a synopsis in any format.
     void print_synopsis()
     {
@@ -608,6 +884,79 @@ protected:
         }
     }
 
+    //!\brief Returns the list items of the common options, e.g. `-h, --help`.
+    std::vector<std::pair<std::string, std::string>> common_options() const
+    {
+        std::vector<std::pair<std::string, std::string>> items{
+            {"\\fB-h\\fP, \\fB--help\\fP", "Prints the help page."},
+            {"\\fB-hh\\fP, \\fB--advanced-help\\fP", "Prints the help page including advanced options."},
+            {"\\fB--version\\fP", "Prints the version information."},
+            {"\\fB--copyright\\fP", "Prints the copyright/license information."},
+            {"\\fB--help\\fP=pattern", "Prints only the options and lines that contain the pattern."},
+            {"\\fB--help-section\\fP=name", "Prints only the sections whose title contains the name."},
+            {"\\fB--export-help\\fP (std::string)",
+             "Export the help page information. Value must be one of " + detail::supported_exports + "."}};
+
+        if (all_subcommands_option)
+            items.emplace_back("\\fB--all-subcommands\\fP",
+                               "Exports the help page information of all subcommands as well.");
+
+        if (version_check_dev_decision == update_notifications::on)
+            items.emplace_back("\\fB--version-check\\fP (bool)",
+                               "Whether to check for the newest app version. Default: true");
+        if (config_file_option_item)
+            items.push_back(*config_file_option_item);
+        if (import_params_option_item)
+            items.push_back(*import_params_option_item);
+
+        return items;
+    }
+
+    /*!\brief Prints the elements that match the help_filter, preceded by the headings of their sections.
+     * \details
+     * The elements were filtered when they were added; non-matching elements were never formatted.
+     */
+    void print_filtered_page()
+    {
+        if (!positional_option_calls.empty())
+            derived_t().print_section("Positional Arguments");
+
+        for (auto f : positional_option_calls)
+            f();
+
+        // The common options are a subsection of "Options", also if other sections were added.
+        if (current_section != "Options")
+            add_heading("Options", true);
+
+        add_heading("Common options", false);
+        for (auto & [key, description] : common_options())
+        {
+            if (matches_filter(key + ' ' + description, in_matching_section))
+            {
+                store_help_page_element(
+                    [this, key, description]()
+                    {
+                        derived_t().print_list_item(key, description);
+                    },
+                    false,
+                    false);
+            }
+        }
+
+        for (auto f : parser_set_up_calls)
+            f();
+
+        if (positional_option_calls.empty() && parser_set_up_calls.empty())
+        {
+            derived_t().print_section("Options");
+            derived_t().print_line("No option matches the filter.", true);
+        }
+
+        derived_t().print_footer();
+
+        write_output();
+    }
+
     //!\brief Vector of functions that stores all calls except add_positional_option.
     std::vector<std::function<void()>> parser_set_up_calls;
     //!\brief Vector of functions that stores add_positional_option calls.
@@ -618,6 +967,20 @@ protected:
     std::vector<std::string> command_names{};
     //!\brief Whether to show advanced options or not.
     bool show_advanced_options{true};
+    //!\brief The list item of the option `--config`, if sharg::parser::add_config_file_option was called.
+    std::optional<std::pair<std::string, std::string>> config_file_option_item{};
+    //!\brief The list item of the option `--import-params`, if sharg::parser::add_import_params_option was called.
+    std::optional<std::pair<std::string, std::string>> import_params_option_item{};
+    //!\brief Whether sharg::parser::set_subcommand_setup was called.
+    bool all_subcommands_option{false};
+    //!\brief The filter of `--help=<pattern>` and `--help-section=<name>`, in lower case.
+    help_filter filter{};
+    //!\brief The title of the current section of a filtered help page.
+    std::string current_section{};
+    //!\brief Whether the title of the current section or subsection matches help_filter::section.
+    bool in_matching_section{true};
+    //!\brief The headings (title, whether it is a section) that are printed before the next shown element.
+    std::vector<std::pair<std::string, bool>> pending_headings{};
 
 private:
     /*!\brief Adds a function object to parser_set_up_calls **if** the annotation in `config` does not prevent it.
@@ -634,7 +997,10 @@ private:
     void store_help_page_element(std::function<void()> printer, bool const advanced, bool const hidden)
     {
         if (!(hidden) && (!(advanced) || show_advanced_options))
+        {
+            print_pending_headings();
             parser_set_up_calls.push_back(std::move(printer));
+        }
     }
 
     /*!\brief Adds a function object to parser_set_up_calls **if** the annotation in `config` does not prevent it.
@@ -651,7 +1017,117 @@ private:
     void store_help_page_element(std::function<void()> printer, config<validator_t> const & config)
     {
         if (!(config.hidden) && (!(config.advanced) || show_advanced_options))
+        {
+            print_pending_headings();
             parser_set_up_calls.push_back(std::move(printer));
+        }
+    }
+
+    /*!\brief Stores a section or subsection of a filtered help page.
+     * \param[in] title The title of the section.
+     * \param[in] is_section Whether it is a section (`true`) or a subsection (`false`).
+     * \details
+     * The heading is only printed if an element of the section is shown. It replaces the previous headings of the
+     * same or a lower level that have no shown elements.
+     */
+    void add_heading(std::string const & title, bool const is_section)
+    {
+        while (!pending_headings.empty() && (is_section || !pending_headings.back().second))
+            pending_headings.pop_back();
+
+        pending_headings.emplace_back(title, is_section);
+
+        if (is_section)
+            current_section = title;
+
+        in_matching_section = section_matches(current_section) || (!is_section && section_matches(title));
+    }
+
+    //!\brief Adds the print calls of the headings above an element that is shown. See add_heading.
+    void print_pending_headings()
+    {
+        for (auto & [title, is_section] : pending_headings)
+        {
+            parser_set_up_calls.push_back(
+                [this, title, is_section]()
+                {
+                    if (is_section)
+                        derived_t().print_section(title);
+                    else
+                        derived_t().print_subsection(title);
+                });
+        }
+
+        pending_headings.clear();
+    }
+
+    /*!\brief Returns whether an option or flag is not shown on the help page.
+     * \param[in] config The configuration of the option or flag; the identifiers and the description are matched
+     *                   against the help_filter.
+     * \details
+     * Hidden options, advanced options on the basic help page, and options that do not match the help_filter are
+     * skipped before their description and default value are formatted.
+     */
+    template <typename validator_t>
+    bool is_skipped(config<validator_t> const & config) const
+    {
+        if (config.hidden || (config.advanced && !show_advanced_options))
+            return true;
+
+        if (!filter.active())
+            return false;
+
+        std::string text{config.description};
+
+        if (config.short_id != '\0')
+            text += std::string{" -"} + config.short_id;
+        if (!config.long_id.empty())
+            text += " --" + config.long_id;
+
+        return !matches_filter(text, in_matching_section);
+    }
+
+    /*!\brief Returns whether an element matches the help_filter.
+     * \param[in] text The identifiers and the description of the element.
+     * \param[in] in_section Whether the element belongs to a section that matches help_filter::section.
+     */
+    bool matches_filter(std::string_view const text, bool const in_section) const
+    {
+        return in_section && lowercase(text).find(filter.pattern) != std::string::npos;
+    }
+
+    //!\brief Returns whether the title of a section contains help_filter::section, ignoring case.
+    bool section_matches(std::string_view const title) const
+    {
+        return lowercase(title).find(filter.section) != std::string::npos;
+    }
+
+    //!\brief Returns `text` in lower case.
+    static std::string lowercase(std::string_view const text)
+    {
+        std::string result(text.size(), '\0');
+        std::ranges::transform(text,
+                               result.begin(),
+                               [](unsigned char const c)
+                               {
+                                   return static_cast<char>(std::tolower(c));
+                               });
+        return result;
+    }
+
+    /*!\brief Appends "Environment variable: <name>" to the description of an option or flag.
+     * \param[in, out] info The description of the option or flag.
+     * \param[in] environment_variable The value of sharg::config::environment_variable; nothing is appended if empty.
+     */
+    static void append_environment_variable(std::string & info, std::string const & environment_variable)
+    {
+        if (environment_variable.empty())
+            return;
+
+        if (!info.empty())
+            info += info.ends_with('.') ? " " : ". ";
+
+        info += "Environment variable: " + environment_variable;
     }
 };
 
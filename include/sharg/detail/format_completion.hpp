@@ -0,0 +1,724 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the format_completion class.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+
+#include <sharg/detail/format_base.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief The format that prints a shell completion script (`--export-help bash`, `zsh` or `fish`).
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The script completes the options, flags, positional options and subcommands of the parser without running the
+ * program, which may be expensive to start. Values are completed with
+ *
+ * - the values of a sharg::value_list_validator,
+ * - the names of a named enumeration (see sharg::enumeration_names) or sharg::flag_set,
+ * - file names with the extensions of a sharg::input_file_validator or sharg::output_file_validator,
+ * - directory names for a sharg::input_directory_validator or sharg::output_directory_validator,
+ * - file names for other options of type std::filesystem::path.
+ *
+ * Hidden options are not completed. The top-level script completes the subcommands and registers the completion for
+ * the program. The options of a subcommand are completed by the script of the subcommand (e.g.
+ * `raptor build --export-help bash`), which is called by the top-level script if it is loaded as well.
+ * `--export-help bash --all-subcommands` prints all scripts at once (see sharg::parser::set_subcommand_setup).
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class format_completion : public format_base
+{
+public:
+    //!\brief The supported shells.
+    enum class shell
+    {
+        bash, //!< Bash; the script uses `complete -F`.
+        zsh,  //!< Zsh; the script uses `_arguments` and `compdef`.
+        fish  //!< Fish; the script uses `complete -c`.
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    format_completion() = default;                                      //!< Defaulted.
+    format_completion(format_completion const &) = default;             //!< Defaulted.
+    format_completion & operator=(format_completion const &) = default; //!< Defaulted.
+    format_completion(format_completion &&) = default;                  //!< Defaulted.
+    format_completion & operator=(format_completion &&) = default;      //!< Defaulted.
+    ~format_completion() = default;                                     //!< Defaulted.
+
+    /*!\brief Initializes a format_completion object.
+     * \param[in] target The shell to print the script for.
+     * \param[in] names A list of subcommands (see \link subcommand_parse subcommand parsing \endlink).
+     * \param[in] version_updates Whether the developer disabled version checks when constructing the parser.
+     */
+    format_completion(shell const target,
+                      std::vector<std::string> const & names,
+                      update_notifications const version_updates) :
+        target_shell{target},
+        command_names{names},
+        version_check_dev_decision{version_updates}
+    {}
+    //!\}
+
+    //!\brief Adds the completion of an option. See sharg::parser::add_option.
+    template <typename option_type, typename validator_t>
+    void add_option(option_type & SHARG_DOXYGEN_ONLY(value), config<validator_t> const & config)
+    {
+        if (config.hidden)
+            return;
+
+        completion_entry entry{.names = identifiers(config),
+                               .description = config.description,
+                               .takes_value = true,
+                               .repeatable = detail::is_container_option<option_type>};
+        add_values<option_type>(entry, config.validator);
+        options.push_back(std::move(entry));
+    }
+
+    //!\brief Adds the completion of an option; the default value is not part of the script.
+    template <typename option_type, typename validator_t, typename default_provider_t>
+    void add_option(option_type & value,
+                    config<validator_t> const & config,
+                    default_provider_t const & SHARG_DOXYGEN_ONLY(default_provider))
+    {
+        add_option(value, config);
+    }
+
+    //!\brief Adds the completion of a flag. See sharg::parser::add_flag.
+    template <typename validator_t>
+    void add_flag(bool & SHARG_DOXYGEN_ONLY(value), config<validator_t> const & config)
+    {
+        if (!config.hidden)
+            options.push_back(completion_entry{.names = identifiers(config), .description = config.description});
+    }
+
+    //!\brief Adds the completion of a positional option. See sharg::parser::add_positional_option.
+    template <typename option_type, typename validator_t>
+    void add_positional_option(option_type & SHARG_DOXYGEN_ONLY(value), config<validator_t> const & config)
+    {
+        completion_entry entry{.description = config.description,
+                               .takes_value = true,
+                               .repeatable = detail::is_container_option<option_type>};
+        add_values<option_type>(entry, config.validator);
+        positional_options.push_back(std::move(entry));
+    }
+
+    // Help page structuring is not part of the script.
+    //!\cond
+    void add_section(std::string const &, bool const)
+    {}
+    void add_subsection(std::string const &, bool const)
+    {}
+    void add_line(std::string const &, bool, bool const)
+    {}
+    void add_list_item(std::string const &, std::string const &, bool const)
+    {}
+    //!\endcond
+
+    //!\brief Completes the option `--config` with file names. See sharg::parser::add_config_file_option.
+    void add_config_file_option(std::vector<std::filesystem::path> const & SHARG_DOXYGEN_ONLY(default_files))
+    {
+        config_file_option = true;
+    }
+
+    //!\brief Completes the option `--import-params` with file names. See sharg::parser::add_import_params_option.
+    void add_import_params_option()
+    {
+        import_params_option = true;
+    }
+
+    //!\brief Completes the option `--all-subcommands`. See sharg::parser::set_subcommand_setup.
+    void add_all_subcommands_option()
+    {
+        all_subcommands_option = true;
+    }
+
+    /*!\brief Prints the completion script.
+     * \param[in] parser_meta The meta information of the application.
+     * \param[in] executable_name A list of arguments that form together the call to the executable.
+     *                            For example: [raptor, build]
+     */
+    void parse(parser_meta_data const & parser_meta, std::vector<std::string> const & executable_name)
+    {
+        add_common_options();
+
+        // The script is registered for the name of the program, not for the path it was called with.
+        std::vector<std::string> command{executable_name};
+        if (command.empty())
+            command.push_back(parser_meta.app_name);
+        command[0] = std::filesystem::path{command[0]}.filename().string();
+
+        std::string script{};
+        if (target_shell == shell::bash)
+            script = bash_script(command);
+        else if (target_shell == shell::zsh)
+            script = zsh_script(command);
+        else
+            script = fish_script(command);
+
+        output_stream->write(script.data(), script.size());
+        output_stream->flush();
+    }
+
+    //!\brief The stream the script is printed to. See sharg::parser::parse(std::ostream &).
+    std::ostream * output_stream{&std::cout};
+
+private:
+    //!\brief The completion of an option, flag or positional option.
+    struct completion_entry
+    {
+        //!\brief The identifiers, e.g. `-t` and `--threads`; empty for positional options.
+        std::vector<std::string> names{};
+        //!\brief The description; only the first line is shown.
+        std::string description{};
+        //!\brief Whether a value follows the option; `false` for flags.
+        bool takes_value{};
+        //!\brief Whether the option can be given more than once, i.e. it is a list.
+        bool repeatable{};
+        //!\brief The valid values, e.g. the names of an enumeration.
+        std::vector<std::string> words{};
+        //!\brief Whether the value is a file.
+        bool files{};
+        //!\brief The valid extensions of the file, e.g. `.fa`; all files are valid if empty.
+        std::vector<std::string> extensions{};
+        //!\brief Whether the value is a directory.
+        bool directories{};
+    };
+
+    //!\brief The shell to print the script for.
+    shell target_shell{};
+    //!\brief The names of subcommand programs.
+    std::vector<std::string> command_names{};
+    //!\brief Whether the developer disabled version checks when constructing the parser.
+    update_notifications version_check_dev_decision{};
+    //!\brief Whether sharg::parser::add_config_file_option was called.
+    bool config_file_option{false};
+    //!\brief Whether sharg::parser::add_import_params_option was called.
+    bool import_params_option{false};
+    //!\brief Whether sharg::parser::set_subcommand_setup was called.
+    bool all_subcommands_option{false};
+    //!\brief The options and flags, in the order they were added.
+    std::vector<completion_entry> options{};
+    //!\brief The positional options, in the order they were added.
+    std::vector<completion_entry> positional_options{};
+
+    //!\brief Returns `-s` and `--long` for the identifiers of an option or flag.
+    template <typename validator_t>
+    static std::vector<std::string> identifiers(config<validator_t> const & config)
+    {
+        std::vector<std::string> names{};
+
+        if (config.short_id != '\0')
+            names.push_back(std::string{'-', config.short_id});
+        if (!config.long_id.empty())
+            names.push_back("--" + config.long_id);
+
+        return names;
+    }
+
+    //!\brief Sets the valid values of `entry` from the type of the option and its validator.
+    template <typename option_type, typename validator_t>
+    static void add_values(completion_entry & entry, validator_t const & validator)
+    {
+        auto element_type = []()
+        {
+            if constexpr (is_flag_set<option_type>)
+                return std::type_identity<typename option_type::value_type>{};
+            else if constexpr (detail::is_container_option<option_type>)
+                return std::type_identity<std::ranges::range_value_t<option_type>>{};
+            else
+                return std::type_identity<option_type>{};
+        };
+        using value_t = typename decltype(element_type())::type;
+
+        if constexpr (requires { validator.values; })
+        {
+            for (auto const & value : validator.values)
+                entry.words.push_back(detail::to_string(value));
+        }
+        else if constexpr (named_enumeration<value_t>)
+        {
+            // All names are accepted on the command line; they are sorted, because the map is unordered.
+            for (auto const & [name, value] : sharg::enumeration_names<value_t>)
+                entry.words.emplace_back(name);
+
+            std::ranges::sort(entry.words);
+        }
+        else if constexpr (std::same_as<value_t, bool>)
+        {
+            entry.words = {"true", "false"};
+        }
+
+        if constexpr (std::derived_from<validator_t, input_directory_validator>
+                      || std::derived_from<validator_t, output_directory_validator>)
+        {
+            entry.directories = true;
+        }
+        else if constexpr (std::derived_from<validator_t, file_validator_base>)
+        {
+            entry.files = true;
+
+            for (std::string const & extension : validator.extensions)
+                entry.extensions.push_back(extension.starts_with('.') ? extension : '.' + extension);
+        }
+        else if constexpr (std::same_as<value_t, std::filesystem::path>)
+        {
+            entry.files = true;
+        }
+    }
+
+    //!\brief Adds the options that every parser has. See sharg::detail::format_help_base::print_common_options.
+    void add_common_options()
+    {
+        options.push_back({.names = {"-h", "--help"}, .description = "Prints the help page."});
+        options.push_back(
+            {.names = {"-hh", "--advanced-help"}, .description = "Prints the help page including advanced options."});
+        options.push_back({.names = {"--version"}, .description = "Prints the version information."});
+        options.push_back({.names = {"--copyright"}, .description = "Prints the copyright/license information."});
+        options.push_back({.names = {"--help-section"},
+                           .description = "Prints only the sections whose title contains the name.",
+                           .takes_value = true});
+
+        // supported_exports is "[html, man, ...]".
+        completion_entry export_help{.names = {"--export-help"},
+                                     .description = "Export the help page information.",
+                                     .takes_value = true};
+        std::string_view formats{detail::supported_exports};
+        formats = formats.substr(1u, formats.size() - 2u);
+        for (auto && format : std::views::split(formats, std::string_view{", "}))
+            export_help.words.emplace_back(std::ranges::begin(format), std::ranges::end(format));
+        options.push_back(std::move(export_help));
+
+        if (all_subcommands_option)
+            options.push_back({.names = {"--all-subcommands"},
+                               .description = "Exports the help page information of all subcommands as well."});
+
+        if (version_check_dev_decision == update_notifications::on)
+            options.push_back({.names = {"--version-check"},
+                               .description = "Whether to check for the newest app version.",
+                               .takes_value = true,
+                               .words = {"true", "false"}});
+        if (config_file_option)
+            options.push_back({.names = {"--config"},
+                               .description = "Read option values from a configuration file.",
+                               .takes_value = true,
+                               .files = true});
+        if (import_params_option)
+            options.push_back({.names = {"--import-params"},
+                               .description = "Read option values from a CTD file or a CWL job file.",
+                               .takes_value = true,
+                               .files = true});
+    }
+
+    //!\brief Returns the values of a positional argument: the subcommands or those of the positional options.
+    completion_entry positional_values() const
+    {
+        completion_entry merged{.takes_value = true, .words = command_names};
+        bool all_files{false};
+
+        for (completion_entry const & entry : positional_options)
+        {
+            merged.words.insert(merged.words.end(), entry.words.begin(), entry.words.end());
+            merged.extensions.insert(merged.extensions.end(), entry.extensions.begin(), entry.extensions.end());
+            merged.files |= entry.files;
+            merged.directories |= entry.directories;
+            all_files |= entry.files && entry.extensions.empty();
+        }
+
+        if (all_files)
+            merged.extensions.clear();
+
+        return merged;
+    }
+
+    //!\brief Returns the name of the shell function for the command, e.g. `_sharg_raptor_build`.
+    static std::string function_name(std::vector<std::string> const & command)
+    {
+        std::string name{"_sharg"};
+
+        for (std::string const & word : command)
+            name += '_' + sanitise(word);
+
+        return name;
+    }
+
+    //!\brief Replaces all characters that are not allowed in a shell function name by `_`.
+    static std::string sanitise(std::string word)
+    {
+        std::ranges::replace_if(
+            word,
+            [](char const c)
+            {
+                return !std::isalnum(static_cast<unsigned char>(c));
+            },
+            '_');
+        return word;
+    }
+
+    //!\brief Returns the first line of `text`.
+    static std::string first_line(std::string const & text)
+    {
+        return text.substr(0u, text.find('\n'));
+    }
+
+    //!\brief Joins `words` with `separator`.
+    static std::string join(std::vector<std::string> const & words, std::string_view const separator)
+    {
+        std::string joined{};
+
+        for (std::string const & word : words)
+        {
+            if (!joined.empty())
+                joined += separator;
+            joined += word;
+        }
+
+        return joined;
+    }
+
+    //!\brief Quotes `text` for bash and zsh: `'text'`, with `'` written as `'\''`.
+    static std::string single_quote(std::string_view const text)
+    {
+        std::string quoted{'\''};
+
+        for (char const c : text)
+            quoted += (c == '\'') ? std::string_view{"'\\''"} : std::string_view{&c, 1u};
+
+        return quoted += '\'';
+    }
+
+    /*!\name Bash
+     * \{
+     */
+    //!\brief Returns the lines that set `COMPREPLY` to the values of `entry`; none if the value is not completed.
+    static std::vector<std::string> bash_values(completion_entry const & entry)
+    {
+        if (!entry.words.empty())
+            return {"COMPREPLY=($(compgen -W " + single_quote(join(entry.words, " ")) + " -- \"$cur\"))"};
+
+        if (!entry.files && !entry.directories)
+            return {};
+
+        // File names may contain spaces. Directories are always listed to navigate to the files.
+        std::string reply{"COMPREPLY=($(compgen -d -- \"$cur\")"};
+
+        if (entry.files && entry.extensions.empty())
+            reply = "COMPREPLY=($(compgen -f -- \"$cur\")";
+
+        for (std::string const & extension : entry.extensions)
+            reply += " $(compgen -f -X " + single_quote("!*" + extension) + " -- \"$cur\")";
+
+        return {"compopt -o filenames 2> /dev/null", "local IFS=$'\\n'", reply + ')'};
+    }
+
+    //!\brief Returns the bash script.
+    std::string bash_script(std::vector<std::string> const & command) const
+    {
+        std::string const function = function_name(command);
+        std::string out{"# bash completion for " + join(command, " ") + '\n'};
+
+        if (command.size() == 1u)
+            out += "# Load it with: source <(" + command[0] + " --export-help bash)\n";
+
+        out += '\n' + function + "()\n{\n    local cur=${COMP_WORDS[COMP_CWORD]} prev=${COMP_WORDS[COMP_CWORD-1]} i\n";
+
+        // The script of a subcommand is called with the position of the subcommand.
+        if (!command_names.empty())
+        {
+            std::vector<std::string> value_options{};
+            for (completion_entry const & entry : options)
+                if (entry.takes_value)
+                    value_options.push_back(join(entry.names, "|"));
+
+            out += "\n    for (( i = ${1:-0} + 1; i < COMP_CWORD; ++i )); do\n        case ${COMP_WORDS[i]} in\n";
+            out += "            " + join(value_options, "|") + ")\n                (( ++i ));;\n";
+
+            for (std::string const & name : command_names)
+            {
+                std::string const subcommand_function = function + '_' + sanitise(name);
+                out += "            " + name + ")\n                declare -F " + subcommand_function
+                     + " > /dev/null && " + subcommand_function + " \"$i\"\n                return;;\n";
+            }
+
+            out += "        esac\n    done\n";
+        }
+
+        out += "\n    case $prev in\n";
+        for (completion_entry const & entry : options)
+        {
+            if (!entry.takes_value)
+                continue;
+
+            out += "        " + join(entry.names, "|") + ")\n";
+            for (std::string const & line : bash_values(entry))
+                out += "            " + line + '\n';
+            out += "            return;;\n";
+        }
+        out += "    esac\n";
+
+        std::vector<std::string> names{};
+        for (completion_entry const & entry : options)
+            names.insert(names.end(), entry.names.begin(), entry.names.end());
+
+        out += "\n    if [[ $cur == -* ]]; then\n        COMPREPLY=($(compgen -W " + single_quote(join(names, " "))
+             + " -- \"$cur\"))\n        return\n    fi\n";
+
+        if (std::vector<std::string> const lines = bash_values(positional_values()); !lines.empty())
+        {
+            out += '\n';
+            for (std::string const & line : lines)
+                out += "    " + line + '\n';
+        }
+
+        out += "}\n";
+
+        if (command.size() == 1u)
+            out += "\ncomplete -F " + function + ' ' + command[0] + '\n';
+
+        return out;
+    }
+    //!\}
+
+    /*!\name Zsh
+     * \{
+     */
+    //!\brief Escapes the characters that `_arguments` interprets in descriptions: `\`, `[`, `]` and `:`.
+    static std::string zsh_escape(std::string_view const text)
+    {
+        std::string escaped{};
+
+        for (char const c : text)
+        {
+            if (c == '\\' || c == '[' || c == ']' || c == ':')
+                escaped += '\\';
+            escaped += c;
+        }
+
+        return escaped;
+    }
+
+    //!\brief Returns the `_arguments` action that completes the values of `entry`.
+    static std::string zsh_action(completion_entry const & entry)
+    {
+        if (!entry.words.empty())
+        {
+            std::string action{"("};
+            for (std::string const & word : entry.words)
+            {
+                if (action.size() > 1u)
+                    action += ' ';
+                for (char const c : word)
+                {
+                    if (c == ' ' || c == '(' || c == ')' || c == '\\' || c == ':')
+                        action += '\\';
+                    action += c;
+                }
+            }
+            return action += ')';
+        }
+
+        if (entry.files && !entry.extensions.empty())
+            return "_files -g \"*(" + join(entry.extensions, "|") + ")\"";
+        if (entry.files)
+            return "_files";
+        if (entry.directories)
+            return "_files -/";
+
+        return " ";
+    }
+
+    //!\brief Returns the zsh script.
+    std::string zsh_script(std::vector<std::string> const & command) const
+    {
+        std::string const function = function_name(command);
+        std::string out{"# zsh completion for " + join(command, " ") + '\n'};
+
+        if (command.size() == 1u)
+            out += "# Load it after compinit with: source <(" + command[0] + " --export-help zsh)\n";
+
+        out += '\n' + function + "()\n{\n    local curcontext=$curcontext state state_descr line\n";
+        out += "    typeset -A opt_args\n    local -a arguments=(\n";
+
+        for (completion_entry const & entry : options)
+        {
+            // -t+ and --threads= also accept the value in the same word, e.g. -t4 and --threads=4.
+            std::vector<std::string> specs{};
+            for (std::string const & name : entry.names)
+                specs.push_back(name + (entry.takes_value ? (name.starts_with("--") ? "=" : "+") : ""));
+
+            out += "        ";
+            if (entry.repeatable)
+                out += "'*'";
+            else if (entry.names.size() > 1u)
+                out += single_quote('(' + join(entry.names, " ") + ')');
+
+            out += (specs.size() > 1u) ? '{' + join(specs, ",") + '}' : specs[0];
+
+            std::string tail{'[' + zsh_escape(first_line(entry.description)) + ']'};
+            if (entry.takes_value)
+            {
+                std::string_view label{entry.names.back()};
+                label.remove_prefix(label.find_first_not_of('-'));
+                tail += ':' + std::string{label} + ':' + zsh_action(entry);
+            }
+
+            out += single_quote(tail) + '\n';
+        }
+
+        for (size_t i = 0; i < positional_options.size(); ++i)
+        {
+            completion_entry const & entry = positional_options[i];
+            std::string const description = first_line(entry.description);
+            std::string const message = description.empty() ? "positional_" + std::to_string(i) : description;
+
+            out += "        "
+                 + single_quote((entry.repeatable ? "*" : std::to_string(i + 1u)) + ':' + zsh_escape(message) + ':'
+                                + zsh_action(entry))
+                 + '\n';
+        }
+
+        if (!command_names.empty())
+        {
+            out += "        " + single_quote("1:subcommand:" + zsh_action(positional_values())) + '\n';
+            out += "        '*::argument:->subcommand'\n";
+        }
+
+        out += "    )\n\n    _arguments -C : $arguments && return\n";
+
+        // `*::` removed the words before the subcommand; its script completes the remaining words.
+        if (!command_names.empty())
+        {
+            out += "\n    if [[ $state == subcommand ]]; then\n        case $line[1] in\n";
+
+            for (std::string const & name : command_names)
+            {
+                std::string const subcommand_function = function + '_' + sanitise(name);
+                out += "            " + name + ")\n                (( $+functions[" + subcommand_function + "] )) && "
+                     + subcommand_function + ";;\n";
+            }
+
+            out += "        esac\n    fi\n";
+        }
+
+        out += "}\n";
+
+        if (command.size() == 1u)
+            out += "\ncompdef " + function + ' ' + command[0] + '\n';
+
+        return out;
+    }
+    //!\}
+
+    /*!\name Fish
+     * \{
+     */
+    //!\brief Quotes `text` for fish: `'text'`, with `\` and `'` escaped by a backslash.
+    static std::string fish_quote(std::string_view const text)
+    {
+        std::string quoted{'\''};
+
+        for (char const c : text)
+        {
+            if (c == '\\' || c == '\'')
+                quoted += '\\';
+            quoted += c;
+        }
+
+        return quoted += '\'';
+    }
+
+    //!\brief Returns the arguments of `complete` that complete the values of `entry`.
+    static std::string fish_values(completion_entry const & entry)
+    {
+        if (!entry.words.empty())
+            return " -x -a " + fish_quote(join(entry.words, " "));
+
+        if (entry.files && !entry.extensions.empty())
+        {
+            std::vector<std::string> calls{};
+            for (std::string const & extension : entry.extensions)
+                calls.push_back("__fish_complete_suffix " + extension);
+
+            return " -x -a " + fish_quote('(' + join(calls, "; ") + ')');
+        }
+
+        if (entry.files)
+            return " -r -F";
+        if (entry.directories)
+            return " -x -a '(__fish_complete_directories)'";
+
+        return " -x";
+    }
+
+    //!\brief Returns the fish script.
+    std::string fish_script(std::vector<std::string> const & command) const
+    {
+        std::string out{"# fish completion for " + join(command, " ") + '\n'};
+
+        if (command.size() == 1u)
+            out += "# Load it with: " + command[0] + " --export-help fish | source\n";
+
+        // The completions of a subcommand apply after the subcommand and before its own subcommands.
+        std::vector<std::string> conditions{};
+        if (command.size() > 1u)
+            conditions.push_back("__fish_seen_subcommand_from " + command.back());
+        if (!command_names.empty())
+            conditions.push_back("not __fish_seen_subcommand_from " + join(command_names, " "));
+
+        std::string const prefix{"complete -c " + command[0]
+                                 + (conditions.empty() ? "" : " -n " + fish_quote(join(conditions, "; and ")))};
+
+        out += '\n';
+        for (completion_entry const & entry : options)
+        {
+            out += prefix;
+
+            for (std::string const & name : entry.names)
+            {
+                if (name.starts_with("--"))
+                    out += " -l " + name.substr(2u);
+                else if (name.size() == 2u)
+                    out += " -s " + name.substr(1u);
+                else // -hh
+                    out += " -o " + name.substr(1u);
+            }
+
+            if (entry.takes_value)
+                out += fish_values(entry);
+
+            if (std::string const description = first_line(entry.description); !description.empty())
+                out += " -d " + fish_quote(description);
+
+            out += '\n';
+        }
+
+        // Positional arguments; the files are only completed if a positional option is a file.
+        completion_entry const positional = positional_values();
+        std::string const values = fish_values(positional);
+
+        if (values == " -x")
+            out += prefix + " -f\n";
+        else if (values == " -r -F")
+            out += prefix + " -F\n";
+        else
+            out += prefix + " -f" + values.substr(3u) + '\n';
+
+        return out;
+    }
+    //!\}
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,258 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the format_fingerprint class.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <functional>
+
+#include <sharg/detail/format_base.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief The format that computes a fingerprint of everything the help page and export formats print.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The parser replays the add_option, add_flag, add_positional_option and help page structuring calls on this format.
+ * Instead of rendering them, it hashes their arguments (64 bit FNV-1a), including the default values and the
+ * messages of the validators, as well as the meta data of the parser. Two parsers with the same fingerprint produce
+ * the same help page, man page, HTML page and CTD/CWL export.
+ *
+ * It is used to check that output embedded at build time (see sharg::detail::embedded_exports) still matches the
+ * parser. `--export-help fingerprint` prints the fingerprint as 16 hexadecimal digits; this value is used by the
+ * build and is not listed on the help page.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class format_fingerprint : public format_base
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    format_fingerprint() = default;                                       //!< Defaulted.
+    format_fingerprint(format_fingerprint const &) = default;             //!< Defaulted.
+    format_fingerprint & operator=(format_fingerprint const &) = default; //!< Defaulted.
+    format_fingerprint(format_fingerprint &&) = default;                  //!< Defaulted.
+    format_fingerprint & operator=(format_fingerprint &&) = default;      //!< Defaulted.
+    ~format_fingerprint() = default;                                      //!< Defaulted.
+
+    /*!\brief Initializes a format_fingerprint object.
+     * \param[in] names A list of subcommands (see \link subcommand_parse subcommand parsing \endlink).
+     * \param[in] version_updates Whether the developer disabled version checks when constructing the parser.
+     */
+    format_fingerprint(std::vector<std::string> const & names, update_notifications const version_updates) :
+        command_names{names},
+        version_check_dev_decision{version_updates}
+    {}
+    //!\}
+
+    //!\brief Hashes an option. See sharg::parser::add_option.
+    template <typename option_type, typename validator_t>
+    void add_option(option_type & value, config<validator_t> const & config)
+    {
+        add_record('o', option_type_and_list_info(value), config);
+
+        if (!config.default_message.empty())
+            mix(get_default_message(value, config.default_message));
+        else if (!config.required)
+            mix(get_default_message(value, value));
+    }
+
+    //!\brief Hashes an option; the default value is computed, because the help page prints it.
+    template <typename option_type, typename validator_t, typename default_provider_t>
+    void add_option(option_type & value,
+                    config<validator_t> const & config,
+                    default_provider_t const & default_provider)
+    {
+        if (!config.default_message.empty())
+            return add_option(value, config);
+
+        option_type const default_value = std::invoke(default_provider);
+        add_record('o', option_type_and_list_info(value), config);
+        mix(get_default_message(default_value, default_value));
+    }
+
+    //!\brief Hashes a flag. See sharg::parser::add_flag.
+    template <typename validator_t>
+    void add_flag(bool & SHARG_DOXYGEN_ONLY(value), config<validator_t> const & config)
+    {
+        add_record('f', {}, config);
+    }
+
+    //!\brief Hashes a positional option. See sharg::parser::add_positional_option.
+    template <typename option_type, typename validator_t>
+    void add_positional_option(option_type & value, config<validator_t> const & config)
+    {
+        add_record('p', option_type_and_list_info(value), config);
+
+        if constexpr (detail::is_container_option<option_type>)
+            mix(get_default_message(value, value));
+    }
+
+    //!\brief Hashes a section. See sharg::parser::add_section.
+    void add_section(std::string const & title, bool const advanced_only)
+    {
+        mix("section", title, advanced_only);
+    }
+
+    //!\brief Hashes a subsection. See sharg::parser::add_subsection.
+    void add_subsection(std::string const & title, bool const advanced_only)
+    {
+        mix("subsection", title, advanced_only);
+    }
+
+    //!\brief Hashes a line. See sharg::parser::add_line.
+    void add_line(std::string const & text, bool const is_paragraph, bool const advanced_only)
+    {
+        mix("line", text, is_paragraph, advanced_only);
+    }
+
+    //!\brief Hashes a list item. See sharg::parser::add_list_item.
+    void add_list_item(std::string const & key, std::string const & desc, bool const advanced_only)
+    {
+        mix("list item", key, desc, advanced_only);
+    }
+
+    //!\brief Hashes the option `--config` and its default files. See sharg::parser::add_config_file_option.
+    void add_config_file_option(std::vector<std::filesystem::path> const & default_files)
+    {
+        mix("config");
+
+        for (std::filesystem::path const & file : default_files)
+            mix(file.string());
+    }
+
+    //!\brief Hashes the option `--import-params`. See sharg::parser::add_import_params_option.
+    void add_import_params_option()
+    {
+        mix("import-params");
+    }
+
+    //!\brief Hashes the option `--all-subcommands`. See sharg::parser::set_subcommand_setup.
+    void add_all_subcommands_option()
+    {
+        mix("all-subcommands");
+    }
+
+    /*!\brief Returns the fingerprint after all calls were replayed.
+     * \param[in] parser_meta The meta data of the parser.
+     */
+    uint64_t finish(parser_meta_data const & parser_meta)
+    {
+        mix(parser_meta.app_name,
+            parser_meta.version,
+            parser_meta.short_description,
+            parser_meta.author,
+            parser_meta.email,
+            parser_meta.date,
+            parser_meta.url,
+            parser_meta.short_copyright,
+            parser_meta.long_copyright,
+            parser_meta.citation,
+            parser_meta.man_page_title,
+            std::to_string(parser_meta.man_page_section),
+            std::to_string(parser_meta.default_message_element_limit));
+
+        for (auto const * lines : {&parser_meta.description, &parser_meta.synopsis, &parser_meta.examples})
+        {
+            mix(std::to_string(lines->size()));
+
+            for (std::string const & line : *lines)
+                mix(line);
+        }
+
+        for (std::string const & name : command_names)
+            mix(name);
+
+        mix(version_check_dev_decision == update_notifications::on, std::string_view{sharg_version_cstring});
+
+#ifdef SEQAN3_VERSION_CSTRING
+        mix(std::string_view{seqan3::seqan3_version_cstring});
+#endif
+
+        return hash;
+    }
+
+    /*!\brief Prints the fingerprint as 16 hexadecimal digits (`--export-help fingerprint`).
+     * \param[in] parser_meta The meta data of the parser.
+     */
+    void parse(parser_meta_data const & parser_meta)
+    {
+        char digits[17]{"0000000000000000"};
+        uint64_t const fingerprint = finish(parser_meta);
+        auto const result = std::to_chars(digits, digits + 16, fingerprint, 16);
+        std::rotate(digits, result.ptr, digits + 16);
+
+        output_stream->write(digits, 16);
+        output_stream->put('\n');
+        output_stream->flush();
+    }
+
+    //!\brief The stream the fingerprint is printed to. See sharg::parser::parse(std::ostream &).
+    std::ostream * output_stream{&std::cout};
+
+private:
+    //!\brief The names of subcommand programs.
+    std::vector<std::string> command_names{};
+    //!\brief Whether the developer disabled version checks when constructing the parser.
+    update_notifications version_check_dev_decision{};
+    //!\brief The FNV-1a hash of everything mixed in so far.
+    uint64_t hash{0xcbf29ce484222325ULL};
+
+    //!\brief Hashes the kind, identifiers, type and sharg::config of an option, flag or positional option.
+    template <typename validator_t>
+    void add_record(char const kind, std::string const & type, config<validator_t> const & config)
+    {
+        mix(std::string_view{&kind, 1u},
+            std::string_view{&config.short_id, 1u},
+            config.long_id,
+            type,
+            config.description,
+            config.validator.get_help_page_message(),
+            config.environment_variable,
+            resource_name(config.resource),
+            config.advanced,
+            config.hidden,
+            config.required);
+    }
+
+    //!\brief Hashes each value. Strings are followed by a separator, such that `"ab", "c"` differs from `"a", "bc"`.
+    template <typename... value_types>
+    void mix(value_types const &... values)
+    {
+        auto mix_one = [this]<typename value_t>(value_t const & value)
+        {
+            if constexpr (std::same_as<value_t, bool>)
+            {
+                mix_byte(value ? '1' : '0');
+            }
+            else
+            {
+                for (char const c : std::string_view{value})
+                    mix_byte(c);
+
+                mix_byte('\0');
+            }
+        };
+
+        (mix_one(values), ...);
+    }
+
+    //!\brief Hashes a single byte.
+    void mix_byte(char const c)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+    }
+};
+
+} // namespace sharg::detail
@@ -52,8 +52,9 @@ public:
     //!\copydoc sharg::detail::format_help_base::format_help_base
     format_help(std::vector<std::string> const & names,
                 update_notifications const version_updates,
-                bool const advanced = false) :
-        base_type{names, version_updates, advanced} {};
+                bool const advanced = false,
+                help_filter const & page_filter = {}) :
+        base_type{names, version_updates, advanced, page_filter} {};
     //!\}
 
 protected:
@@ -113,17 +114,18 @@ protected:
     //!\brief Prints a help page header to std::cout.
     void print_header()
     {
-        std::ostream_iterator<char> out(std::cout);
-
-        std::cout << meta.app_name;
+        output += meta.app_name;
         if (!empty(meta.short_description))
-            std::cout << " - " << meta.short_description;
+        {
+            output += " - ";
+            output += meta.short_description;
+        }
 
-        std::cout << "\n";
+        output += '\n';
         unsigned len =
             text_width(meta.app_name) + (empty(meta.short_description) ? 0 : 3) + text_width(meta.short_description);
-        std::fill_n(out, len, '=');
-        std::cout << '\n';
+        output.append(len, '=');
+        output += '\n';
     }
 
     /*!\brief Prints a help page section to std::cout.
@@ -131,16 +133,16 @@ protected:
      */
     void print_section(std::string const & title)
     {
-        std::ostream_iterator<char> out(std::cout);
-        std::cout << '\n' << to_text("\\fB");
-        std::transform(title.begin(),
-                       title.end(),
-                       out,
-                       [](unsigned char c)
-                       {
-                           return std::toupper(c);
-                       });
-        std::cout << to_text("\\fP") << '\n';
+        output += '\n';
+        append_text(output, "\\fB");
+        std::ranges::transform(title,
+                               std::back_inserter(output),
+                               [](unsigned char c)
+                               {
+                                   return static_cast<char>(std::toupper(c));
+                               });
+        append_text(output, "\\fP");
+        output += '\n';
         prev_was_paragraph = false;
     }
 
@@ -149,10 +151,12 @@ protected:
      */
     void print_subsection(std::string const & title)
     {
-        std::ostream_iterator<char> out(std::cout);
-        std::cout << '\n';
-        std::fill_n(out, layout.leftPadding / 2, ' ');
-        std::cout << in_bold(title) << '\n';
+        output += '\n';
+        output.append(layout.leftPadding / 2, ' ');
+        append_text(output, "\\fB");
+        output += title;
+        append_text(output, "\\fP");
+        output += '\n';
         prev_was_paragraph = false;
     }
 
@@ -164,10 +168,9 @@ protected:
     void print_line(std::string const & text, bool const line_is_paragraph)
     {
         if (prev_was_paragraph)
-            std::cout << '\n';
+            output += '\n';
 
-        std::ostream_iterator<char> out(std::cout);
-        std::fill_n(out, layout.leftPadding, ' ');
+        output.append(layout.leftPadding, ' ');
         print_text(text, layout.leftPadding);
         prev_was_paragraph = line_is_paragraph;
     }
@@ -189,20 +192,18 @@ protected:
     void print_list_item(std::string const & term, std::string const & desc)
     {
         if (prev_was_paragraph)
-            std::cout << '\n';
-
-        std::ostream_iterator<char> out(std::cout);
+            output += '\n';
 
         // Print term.
-        std::fill_n(out, layout.leftPadding, ' ');
-        std::cout << to_text(term);
+        output.append(layout.leftPadding, ' ');
+        append_text(output, term);
         unsigned pos = layout.leftPadding + term.size();
         if (pos + layout.centerPadding > layout.rightColumnTab)
         {
-            std::cout << '\n';
+            output += '\n';
             pos = 0;
         }
-        std::fill_n(out, layout.rightColumnTab - pos, ' ');
+        output.append(layout.rightColumnTab - pos, ' ');
         print_text(desc, layout.rightColumnTab);
 
         prev_was_paragraph = false;
@@ -217,10 +218,22 @@ protected:
     /*!\brief Formats text for pretty command line printing.
      * \param[in] str The input string to format for correct command line printing.
      */
-    std::string to_text(std::string const & str)
+    std::string to_text(std::string_view const str)
     {
         std::string result;
+        append_text(result, str);
+        return result;
+    }
 
+    /*!\brief Appends text formatted for pretty command line printing.
+     * \param[out] out The string to append to, usually format_help_base::output.
+     * \param[in] str The input string to format for correct command line printing.
+     * \details
+     * "\-" is printed as "-". "\fB", "\fI" and "\fP" are replaced by the escape sequences for bold, underlined and
+     * normal text if the output is a terminal, and removed otherwise.
+     */
+    void append_text(std::string & out, std::string_view const str)
+    {
         for (auto it = str.begin(); it != str.end(); ++it)
         {
             if (*it == '\\')
@@ -230,7 +243,7 @@ protected:
                 assert(it != str.end());
                 if (*it == '-')
                 {
-                    result.push_back(*it);
+                    out.push_back(*it);
                 }
                 else if (*it == 'f')
                 {
@@ -238,45 +251,43 @@ protected:
                     assert(it != str.end());
                     if (*it == 'I')
                     {
-                        if (stdout_is_terminal())
-                            result.append("\033[4m");
+                        if (prints_to_terminal())
+                            out.append("\033[4m");
                     }
                     else if (*it == 'B')
                     {
-                        if (stdout_is_terminal())
-                            result.append("\033[1m");
+                        if (prints_to_terminal())
+                            out.append("\033[1m");
                     }
                     else if (*it == 'P')
                     {
-                        if (stdout_is_terminal())
-                            result.append("\033[0m");
+                        if (prints_to_terminal())
+                            out.append("\033[0m");
                     }
                     else
                     {
-                        result.append("\\f");
-                        result.push_back(*it);
+                        out.append("\\f");
+                        out.push_back(*it);
                     }
                 }
                 else
                 {
-                    result.push_back('\\');
-                    result.push_back(*it);
+                    out.push_back('\\');
+                    out.push_back(*it);
                 }
             }
             else
             {
-                result.push_back(*it);
+                out.push_back(*it);
             }
         }
-
-        return result;
     }
 
     /*!\brief Returns width of text if printed.
      * \param[in] text The string to compute the width for on the command line.
      * /detail Note: "\-" has length 1, "\fI", "\fB", "\fP" have length 0.
      */
-    unsigned text_width(std::string const & text)
+    unsigned text_width(std::string_view const text)
     {
         unsigned result = 0;
 
@@ -323,54 +334,70 @@ protected:
     /*!\brief Prints text with correct line wrapping to the command line (std::cout).
      * \param[in] text   The string to print on the command line.
      * \param[in] tab    The position offset (indentation) to start printing at.
+     * \details
+     * The words are views into `text`; nothing is allocated besides the growth of format_help_base::output.
      */
-    void print_text(std::string const & text, unsigned const tab)
+    void print_text(std::string_view const text, unsigned const tab)
     {
-        unsigned pos = tab;
-        std::ostream_iterator<char> out(std::cout);
+        // Same as the whitespace that `operator>>` skips in the "C" locale.
+        constexpr std::string_view whitespace{" \t\n\v\f\r"};
 
-        // Tokenize the text.
-        std::istringstream iss(text.c_str());
-        std::vector<std::string> tokens{std::istream_iterator<std::string>(iss), std::istream_iterator<std::string>()};
-
-        // Print the text.
-        assert(pos <= tab);
-        std::fill_n(out, tab - pos, ' '); // go to tab
+        unsigned pos = tab;
+        bool first_word{true};
 
-        pos = tab;
-        for (auto it = tokens.begin(); it != tokens.end(); ++it)
+        for (size_t start = text.find_first_not_of(whitespace); start != std::string_view::npos;
+             start = text.find_first_not_of(whitespace, start))
         {
-            if (it == tokens.begin())
+            size_t const end = std::min(text.find_first_of(whitespace, start), text.size());
+            std::string_view const word = text.substr(start, end - start);
+            unsigned const width = text_width(word);
+            start = end;
+
+            if (first_word)
             {
-                std::cout << to_text(*it);
-                pos += text_width(*it);
+                first_word = false;
+                append_text(output, word);
+                pos += width;
                 if (pos > layout.screenWidth)
                 {
-                    std::cout << '\n';
-                    std::fill_n(out, tab, ' ');
+                    output += '\n';
+                    output.append(tab, ' ');
                     pos = tab;
                 }
             }
+            else if (pos + 1 + width > layout.screenWidth)
+            {
+                // Would go over screen with next, print current word on next line.
+                output += '\n';
+                output.append(tab, ' ');
+                append_text(output, word);
+                pos = tab + width;
+            }
             else
             {
-                if (pos + 1 + text_width(*it) > layout.screenWidth)
-                {
-                    // Would go over screen with next, print current word on next line.
-                    std::cout << '\n';
-                    fill_n(out, tab, ' ');
-                    std::cout << to_text(*it);
-                    pos = tab + text_width(*it);
-                }
-                else
-                {
-                    std::cout << ' ';
-                    std::cout << to_text(*it);
-                    pos += text_width(*it) + 1;
-                }
+                output += ' ';
+                append_text(output, word);
+                pos += width + 1;
             }
         }
-        if (!empty(tokens))
-            std::cout << '\n';
+
+        if (!first_word)
+            output += '\n';
+    }
+
+    /*!\brief Whether escape sequences for bold and underlined text can be used, i.e. the output is a terminal.
+     * \details
+     * The result is cached, s.t. the terminal is only queried once per page.
+     */
+    bool prints_to_terminal()
+    {
+        if (terminal_checked_stream != output_stream)
+        {
+            terminal_checked_stream = output_stream;
+            is_terminal = output_stream == &std::cout && stdout_is_terminal();
+        }
+
+        return is_terminal;
     }
 
     /*!\brief Format string in bold.
@@ -382,6 +409,11 @@ protected:
         return to_text("\\fB") + str + to_text("\\fP");
     }
 
+    //!\brief The stream for which format_help::is_terminal was determined.
+    std::ostream const * terminal_checked_stream{nullptr};
+    //!\brief Whether format_help::terminal_checked_stream is a terminal. See format_help::prints_to_terminal.
+    bool is_terminal{false};
+
     //!\brief Needed for correct formatting while calling different print functions.
     bool prev_was_paragraph{false};
 
@@ -392,6 +424,13 @@ protected:
     console_layout_struct layout{};
 };
 
+#if SHARG_COMPILED_LIBRARY
+//!\cond
+// Instantiated once in sharg::sharg_compiled.
+extern template class format_help_base<format_help>;
+//!\endcond
+#endif
+
 /*!\brief The format that prints a short help message to std::cout.
  * \ingroup parser
  *
@@ -419,6 +458,7 @@ public:
             print_synopsis();
 
         print_line("Try -h or --help for more information.\n", true);
+        write_output();
     }
 };
 
@@ -445,6 +485,7 @@ public:
 
         print_header();
         print_version();
+        write_output();
     }
 };
 
@@ -497,28 +538,41 @@ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
 OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 DAMAGE.)"};
 
-        std::cout << std::string(80, '=') << "\n"
-                  << in_bold("Copyright information for " + meta.app_name + ":\n") << std::string(80, '-') << '\n';
+        output.append(80u, '=');
+        output += '\n';
+        output += in_bold("Copyright information for " + meta.app_name + ":\n");
+        output.append(80u, '-');
+        output += '\n';
 
         if (!empty(meta.long_copyright))
         {
-            std::cout << to_text("\\fP") << meta.long_copyright << "\n";
+            append_text(output, "\\fP");
+            output += meta.long_copyright;
+            output += '\n';
         }
         else if (!empty(meta.short_copyright))
         {
-            std::cout << in_bold(meta.app_name + " full copyright information not available. "
-                                 + "Displaying short copyright information instead:\n")
-                      << meta.short_copyright << "\n";
+            output += in_bold(meta.app_name + " full copyright information not available. "
+                              + "Displaying short copyright information instead:\n");
+            output += meta.short_copyright;
+            output += '\n';
         }
         else
         {
-            std::cout << to_text("\\fP") << meta.app_name << " copyright information not available.\n";
+            append_text(output, "\\fP");
+            output += meta.app_name;
+            output += " copyright information not available.\n";
         }
 
-        std::cout << std::string(80, '=') << '\n'
-                  << in_bold("This program contains SeqAn code licensed under the following terms:\n")
-                  << std::string(80, '-') << '\n'
-                  << seqan_license << '\n';
+        output.append(80u, '=');
+        output += '\n';
+        output += in_bold("This program contains SeqAn code licensed under the following terms:\n");
+        output.append(80u, '-');
+        output += '\n';
+        output += seqan_license;
+        output += '\n';
+
+        write_output();
     }
 };
 
@@ -9,7 +9,33 @@
 
 #pragma once
 
-#include <sharg/detail/format_base.hpp>
+#include <sharg/platform.hpp>
+
+#if !SHARG_HAS_EXPORT_HTML
+
+#    include <sharg/detail/format_help.hpp>
+
+namespace sharg::detail
+{
+// A dummy class that is used when the html export is compiled out (SHARG_HAS_EXPORT_HTML=0).
+// It only reuses the already instantiated format_help to store the set up calls.
+// It will always throw when parse is called.
+class format_html : public format_help
+{
+public:
+    using format_help::format_help;
+
+    void parse(parser_meta_data &)
+    {
+        throw validation_error{detail::unavailable_export_message("html")};
+    }
+};
+
+} // namespace sharg::detail
+
+#else
+
+#    include <sharg/detail/format_base.hpp>
 
 namespace sharg::detail
 {
@@ -58,7 +84,7 @@ private:
     {
         if (is_dl)
         {
-            std::cout << "</dl>\n";
+            output += "</dl>\n";
             is_dl = false;
         }
     }
@@ -68,7 +94,7 @@ private:
     {
         if (is_p)
         {
-            std::cout << "</p>\n";
+            output += "</p>\n";
             is_p = false;
         }
     }
@@ -77,18 +103,21 @@ private:
     void print_header()
     {
         // Print HTML boilerplate header.
-        std::cout << "<!DOCTYPE html PUBLIC \"-//W3C//DTD HTML 4.01//EN\" "
-                  << "http://www.w3.org/TR/html4/strict.dtd\">\n"
-                  << "<html lang=\"en\">\n"
-                  << "<head>\n"
-                  << "<meta http-equiv=\"content-type\" content=\"text/html; charset=utf-8\">\n"
-                  << "<title>" << escape_special_xml_chars(meta.app_name) << " &mdash; "
-                  << escape_special_xml_chars(meta.short_description) << "</title>\n"
-                  << "</head>\n"
-                  << "<body>\n";
-
-        std::cout << "<h1>" << to_html(meta.app_name) << "</h1>\n"
-                  << "<div>" << to_html(meta.short_description) << "</div>\n";
+        output += "<!DOCTYPE html PUBLIC \"-//W3C//DTD HTML 4.01//EN\" "
+                  "http://www.w3.org/TR/html4/strict.dtd\">\n"
+                  "<html lang=\"en\">\n"
+                  "<head>\n"
+                  "<meta http-equiv=\"content-type\" content=\"text/html; charset=utf-8\">\n"
+                  "<title>";
+        output += escape_special_xml_chars(meta.app_name);
+        output += " &mdash; ";
+        output += escape_special_xml_chars(meta.short_description);
+        output += "</title>\n"
+                  "</head>\n"
+                  "<body>\n";
+
+        output += "<h1>" + to_html(meta.app_name) + "</h1>\n";
+        output += "<div>" + to_html(meta.short_description) + "</div>\n";
     }
 
     /*!\brief Prints a section title in HTML format to std::cout.
@@ -99,7 +128,7 @@ private:
         // SEQAN_ASSERT_NOT_MSG(isDl && isP, "Current <dl> and <p> are mutually exclusive.");
         maybe_close_list();
         maybe_close_paragraph();
-        std::cout << "<h2>" << to_html(title) << "</h2>\n";
+        output += "<h2>" + to_html(title) + "</h2>\n";
     }
 
     /*!\brief Prints a subsection title in HTML format to std::cout.
@@ -110,7 +139,7 @@ private:
         // SEQAN_ASSERT_NOT_MSG(isDl && isP, "Current <dl> and <p> are mutually exclusive.");
         maybe_close_list();
         maybe_close_paragraph();
-        std::cout << "<h3>" << to_html(title) << "</h3>\n";
+        output += "<h3>" + to_html(title) + "</h3>\n";
     }
 
     /*!\brief Prints a text in HTML format to std::cout.
@@ -124,14 +153,15 @@ private:
         maybe_close_list();
         if (!is_p) // open parapgraph
         {
-            std::cout << "<p>\n";
+            output += "<p>\n";
             is_p = true;
         }
-        std::cout << to_html(text) << "\n";
+        output += to_html(text);
+        output += '\n';
         if (line_is_paragraph)
             maybe_close_paragraph();
         else
-            std::cout << "<br>\n";
+            output += "<br>\n";
     }
 
     /*!\brief Prints a help page list_item in HTML format to std::cout.
@@ -150,11 +180,11 @@ private:
 
         if (!is_dl)
         {
-            std::cout << "<dl>\n";
+            output += "<dl>\n";
             is_dl = true;
         }
-        std::cout << "<dt>" << to_html(term) << "</dt>\n"
-                  << "<dd>" << to_html(desc) << "</dd>\n";
+        output += "<dt>" + to_html(term) + "</dt>\n";
+        output += "<dd>" + to_html(desc) + "</dd>\n";
     }
 
     //!\brief Prints a help page footer in HTML format to std::cout.
@@ -163,7 +193,7 @@ private:
         maybe_close_paragraph();
 
         // Print HTML boilerplate footer.
-        std::cout << "</body></html>";
+        output += "</body></html>";
     }
 
     /*!\brief Converts console output formatting to the HTML equivalent.
@@ -245,4 +275,13 @@ private:
     bool is_p{false};
 };
 
+#if SHARG_COMPILED_LIBRARY
+//!\cond
+// Instantiated once in sharg::sharg_compiled.
+extern template class format_help_base<format_html>;
+//!\endcond
+#endif
+
 } // namespace sharg::detail
+
+#endif
@@ -0,0 +1,404 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the format_json class.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <functional>
+
+#include <sharg/detail/format_base.hpp>
+#include <sharg/std/charconv>
+
+namespace sharg::detail
+{
+
+/*!\brief The format that prints a JSON schema of the options (`--export-help json`).
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The output is a [JSON Schema](https://json-schema.org/draft/2020-12/schema) of an object whose properties are the
+ * options, flags and positional options of the parser. They are named like the parameters of the CTD and CWL
+ * exports (the long identifier, or `positional_<i>`), i.e. a job file for sharg::parser::add_import_params_option
+ * can be validated against the schema.
+ *
+ * Each property has a JSON type (`integer`, `number`, `boolean`, `string` or an `array` of those), a default value if
+ * the help page shows one, and its description. Named enumerations and sharg::value_list_validator values are listed
+ * as `enum`, sharg::arithmetic_range_validator bounds as `minimum`/`maximum` and sharg::regex_validator patterns as
+ * `pattern`. The object `x-sharg` of each property contains the details that JSON Schema does not cover, e.g. the
+ * identifiers, the type name and the help page message of the validator. The object `x-sharg` of the schema contains
+ * the meta data of the application and its subcommands.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class format_json : public format_base
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    format_json() = default;                                //!< Defaulted.
+    format_json(format_json const &) = default;             //!< Defaulted.
+    format_json & operator=(format_json const &) = default; //!< Defaulted.
+    format_json(format_json &&) = default;                  //!< Defaulted.
+    format_json & operator=(format_json &&) = default;      //!< Defaulted.
+    ~format_json() = default;                               //!< Defaulted.
+
+    /*!\brief Initializes a format_json object.
+     * \param[in] names A list of subcommands (see \link subcommand_parse subcommand parsing \endlink).
+     */
+    format_json(std::vector<std::string> const & names) : command_names{names}
+    {}
+    //!\}
+
+    //!\brief Adds the property of an option. See sharg::parser::add_option.
+    template <typename option_type, typename validator_t>
+    void add_option(option_type & value, config<validator_t> const & config)
+    {
+        add_property(config.long_id.empty() ? std::string(1u, config.short_id) : config.long_id,
+                     "option",
+                     value,
+                     config,
+                     !config.required && config.default_message.empty());
+    }
+
+    //!\brief Adds the property of an option; the default value is computed, because the schema contains it.
+    template <typename option_type, typename validator_t, typename default_provider_t>
+    void add_option(option_type & SHARG_DOXYGEN_ONLY(value),
+                    config<validator_t> const & config,
+                    default_provider_t const & default_provider)
+    {
+        option_type default_value = std::invoke(default_provider);
+        add_option(default_value, config);
+    }
+
+    //!\brief Adds the property of a flag. See sharg::parser::add_flag.
+    template <typename validator_t>
+    void add_flag(bool & value, config<validator_t> const & config)
+    {
+        add_property(config.long_id.empty() ? std::string(1u, config.short_id) : config.long_id,
+                     "flag",
+                     value,
+                     config,
+                     true);
+    }
+
+    //!\brief Adds the property of a positional option. See sharg::parser::add_positional_option.
+    template <typename option_type, typename validator_t>
+    void add_positional_option(option_type & value, config<validator_t> const & config)
+    {
+        // Only a list at the end may be empty and thus has a default value.
+        add_property("positional_" + std::to_string(positional_option_count++),
+                     "positional option",
+                     value,
+                     config,
+                     detail::is_container_option<option_type>);
+
+        required.push_back(properties.back().first);
+    }
+
+    // Help page structuring is not part of the schema.
+    //!\cond
+    void add_section(std::string const &, bool const)
+    {}
+    void add_subsection(std::string const &, bool const)
+    {}
+    void add_line(std::string const &, bool, bool const)
+    {}
+    void add_list_item(std::string const &, std::string const &, bool const)
+    {}
+    //!\endcond
+
+    /*!\brief Prints the schema.
+     * \param[in] parser_meta The meta information of the application.
+     * \param[in] executable_name A list of arguments that form together the call to the executable.
+     *                            For example: [raptor, build]
+     */
+    void parse(parser_meta_data const & parser_meta, std::vector<std::string> const & executable_name)
+    {
+        std::string out{};
+        out.reserve(1024u + 512u * properties.size());
+
+        out += "{\n  \"$schema\": \"https://json-schema.org/draft/2020-12/schema\",\n  \"title\": ";
+        append_string(out, parser_meta.app_name);
+        out += ",\n  \"description\": ";
+        append_string(out, parser_meta.short_description);
+        out += ",\n  \"type\": \"object\",\n  \"properties\": {";
+
+        for (size_t i = 0; i < properties.size(); ++i)
+        {
+            out += (i == 0u) ? "\n    " : ",\n    ";
+            append_string(out, properties[i].first);
+            out += ": ";
+            out += properties[i].second;
+        }
+
+        out += properties.empty() ? "},\n  \"required\": " : "\n  },\n  \"required\": ";
+        append_list(out, required);
+        out += ",\n  \"x-sharg\": {\n    \"name\": ";
+        append_string(out, parser_meta.app_name);
+        out += ",\n    \"version\": ";
+        append_string(out, parser_meta.version);
+        out += ",\n    \"url\": ";
+        append_string(out, parser_meta.url);
+        out += ",\n    \"description\": ";
+        append_list(out, parser_meta.description);
+        out += ",\n    \"executable\": ";
+        append_list(out, executable_name);
+        out += ",\n    \"subcommands\": ";
+        append_list(out, command_names);
+        out += ",\n    \"sharg_version\": ";
+        append_string(out, sharg_version_cstring);
+        out += "\n  }\n}\n";
+
+        output_stream->write(out.data(), out.size());
+        output_stream->flush();
+    }
+
+    //!\brief The stream the schema is printed to. See sharg::parser::parse(std::ostream &).
+    std::ostream * output_stream{&std::cout};
+
+private:
+    //!\brief The names of subcommand programs.
+    std::vector<std::string> command_names{};
+    //!\brief The name and the serialised schema of each property, in the order they were added.
+    std::vector<std::pair<std::string, std::string>> properties{};
+    //!\brief The names of the required properties.
+    std::vector<std::string> required{};
+    //!\brief The number of positional options added so far.
+    size_t positional_option_count{};
+
+    /*!\brief Adds the schema of an option, flag or positional option to format_json::properties.
+     * \param[in] name The name of the property.
+     * \param[in] kind `option`, `flag` or `positional option`.
+     * \param[in] value The value; its type determines the JSON type and it is the default value.
+     * \param[in] config The configuration of the option.
+     * \param[in] has_default Whether the value is the default value.
+     */
+    template <typename option_type, typename validator_t>
+    void add_property(std::string name,
+                      std::string_view const kind,
+                      option_type const & value,
+                      config<validator_t> const & config,
+                      bool const has_default)
+    {
+        std::string out{"{\n      \"description\": "};
+        append_string(out, config.description);
+
+        if constexpr (is_flag_set<option_type>)
+        {
+            out += ",\n      \"type\": \"array\",\n      \"uniqueItems\": true,\n      \"items\": ";
+            out += "{" + item_schema<typename option_type::value_type>(config.validator, ", ") + "}";
+        }
+        else if constexpr (detail::is_container_option<option_type>)
+        {
+            out += ",\n      \"type\": \"array\",\n      \"items\": ";
+            out += "{" + item_schema<std::ranges::range_value_t<option_type>>(config.validator, ", ") + "}";
+        }
+        else
+        {
+            out += ",\n      " + item_schema<option_type>(config.validator, ",\n      ");
+        }
+
+        if (has_default)
+        {
+            out += ",\n      \"default\": ";
+            append_value(out, value);
+        }
+
+        out += ",\n      \"x-sharg\": {\"kind\": ";
+        append_string(out, kind);
+        out += ", \"short_id\": ";
+        append_string(out, config.short_id == '\0' ? std::string{} : std::string(1u, config.short_id));
+        out += ", \"long_id\": ";
+        append_string(out, config.long_id);
+        out += ", \"type\": ";
+        append_string(out, get_type_name_as_string(value));
+        out += ", \"validator\": ";
+        append_string(out, config.validator.get_help_page_message());
+        out += ", \"default_message\": ";
+        append_string(out, config.default_message);
+        out += ", \"environment_variable\": ";
+        append_string(out, config.environment_variable);
+        out += ", \"resource\": ";
+        append_string(out, resource_name(config.resource));
+        out += ", \"advanced\": ";
+        out += config.advanced ? "true" : "false";
+        out += ", \"hidden\": ";
+        out += config.hidden ? "true" : "false";
+        out += "}\n    }";
+
+        if (config.required && kind != "positional option")
+            required.push_back(name);
+
+        properties.emplace_back(std::move(name), std::move(out));
+    }
+
+    /*!\brief Returns the members of the schema of a single value of type `value_t`.
+     * \param[in] validator The validator of the option; the bounds, values or pattern of the built-in validators are
+     *                      added to the schema.
+     * \param[in] separator The separator of the members.
+     */
+    template <typename value_t, typename validator_t>
+    static std::string item_schema(validator_t const & validator, std::string_view const separator)
+    {
+        std::string out{};
+
+        if constexpr (std::same_as<value_t, bool>)
+            out += "\"type\": \"boolean\"";
+        else if constexpr (named_enumeration<value_t>)
+            out += "\"type\": \"string\"";
+        else if constexpr (std::integral<value_t>)
+            out += "\"type\": \"integer\"";
+        else if constexpr (std::floating_point<value_t>)
+            out += "\"type\": \"number\"";
+        else
+            out += "\"type\": \"string\"";
+
+        // The values of a sharg::value_list_validator are a subset of the names of an enumeration.
+        if constexpr (requires { validator.values; })
+        {
+            out += separator;
+            out += "\"enum\": ";
+            append_value(out, validator.values);
+        }
+        else if constexpr (named_enumeration<value_t>)
+        {
+            // All names are accepted on the command line; they are sorted, because the map is unordered.
+            std::vector<std::string> names{};
+            for (auto const & [key, enum_value] : sharg::enumeration_names<value_t>)
+                names.emplace_back(key);
+
+            std::ranges::sort(names);
+            out += separator;
+            out += "\"enum\": ";
+            append_list(out, names);
+        }
+
+        if constexpr (requires { validator.min; validator.max; })
+        {
+            out += separator;
+            out += "\"minimum\": ";
+            append_value(out, validator.min);
+            out += separator;
+            out += "\"maximum\": ";
+            append_value(out, validator.max);
+        }
+        else if constexpr (requires { validator.pattern; })
+        {
+            out += separator;
+            out += "\"pattern\": ";
+            append_string(out, "^(?:" + validator.pattern + ")$");
+        }
+
+        return out;
+    }
+
+    //!\brief Appends `value` as JSON value.
+    template <typename value_t>
+    static void append_value(std::string & out, value_t const & value)
+    {
+        if constexpr (std::same_as<value_t, bool>)
+        {
+            out += value ? "true" : "false";
+        }
+        else if constexpr (named_enumeration<value_t>)
+        {
+            append_string(out, detail::find_enumeration_name(value));
+        }
+        else if constexpr (std::integral<value_t>)
+        {
+            out += std::to_string(value);
+        }
+        else if constexpr (std::floating_point<value_t>)
+        {
+            if (!std::isfinite(value))
+            {
+                out += "null";
+                return;
+            }
+
+            char buffer[64];
+            auto const result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, result.ptr);
+        }
+        else if constexpr (is_flag_set<value_t>)
+        {
+            std::vector<typename value_t::value_type> values(value.begin(), value.end());
+            append_value(out, values);
+        }
+        else if constexpr (std::ranges::input_range<value_t> && !std::convertible_to<value_t, std::string_view>)
+        {
+            out += "[";
+            for (bool first = true; auto const & element : value)
+            {
+                out += first ? "" : ", ";
+                first = false;
+                append_value(out, element);
+            }
+            out += "]";
+        }
+        else if constexpr (std::same_as<value_t, std::filesystem::path>)
+        {
+            append_string(out, value.string());
+        }
+        else
+        {
+            append_string(out, detail::to_string(value));
+        }
+    }
+
+    //!\brief Appends a list of strings as JSON array.
+    static void append_list(std::string & out, std::vector<std::string> const & list)
+    {
+        append_value(out, list);
+    }
+
+    //!\brief Appends `str` as quoted and escaped JSON string.
+    static void append_string(std::string & out, std::string_view const str)
+    {
+        static constexpr char hex_digits[] = "0123456789abcdef";
+
+        out += '"';
+        for (char const c : str)
+        {
+            switch (c)
+            {
+                case '"':
+                    out += "\\\"";
+                    break;
+                case '\\':
+                    out += "\\\\";
+                    break;
+                case '\n':
+                    out += "\\n";
+                    break;
+                case '\t':
+                    out += "\\t";
+                    break;
+                case '\r':
+                    out += "\\r";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20u)
+                    {
+                        out += "\\u00";
+                        out += hex_digits[c >> 4];
+                        out += hex_digits[c & 0xf];
+                    }
+                    else
+                    {
+                        out += c;
+                    }
+            }
+        }
+        out += '"';
+    }
+};
+
+} // namespace sharg::detail
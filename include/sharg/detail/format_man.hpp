@@ -9,7 +9,33 @@
 
 #pragma once
 
-#include <sharg/detail/format_base.hpp>
+#include <sharg/platform.hpp>
+
+#if !SHARG_HAS_EXPORT_MAN
+
+#    include <sharg/detail/format_help.hpp>
+
+namespace sharg::detail
+{
+// A dummy class that is used when the man page export is compiled out (SHARG_HAS_EXPORT_MAN=0).
+// It only reuses the already instantiated format_help to store the set up calls.
+// It will always throw when parse is called.
+class format_man : public format_help
+{
+public:
+    using format_help::format_help;
+
+    void parse(parser_meta_data &)
+    {
+        throw validation_error{detail::unavailable_export_message("man")};
+    }
+};
+
+} // namespace sharg::detail
+
+#else
+
+#    include <sharg/detail/format_base.hpp>
 
 namespace sharg::detail
 {
@@ -57,29 +83,24 @@ private:
     //!\brief Prints a help page header in man page format to std::cout.
     void print_header()
     {
-        std::ostream_iterator<char> out(std::cout);
+        auto to_upper = [](unsigned char c)
+        {
+            return static_cast<char>(std::toupper(c));
+        };
+        auto to_lower = [](unsigned char c)
+        {
+            return static_cast<char>(std::tolower(c));
+        };
 
         // Print .TH line.
-        std::cout << ".TH ";
-        std::transform(meta.app_name.begin(),
-                       meta.app_name.end(),
-                       out,
-                       [](unsigned char c)
-                       {
-                           return std::toupper(c);
-                       });
-        std::cout << " " << std::to_string(meta.man_page_section) << " \"" << meta.date << "\" \"";
-        std::transform(meta.app_name.begin(),
-                       meta.app_name.end(),
-                       out,
-                       [](unsigned char c)
-                       {
-                           return std::tolower(c);
-                       });
-        std::cout << " " << meta.version << "\" \"" << meta.man_page_title << "\"\n";
+        output += ".TH ";
+        std::ranges::transform(meta.app_name, std::back_inserter(output), to_upper);
+        output += " " + std::to_string(meta.man_page_section) + " \"" + meta.date + "\" \"";
+        std::ranges::transform(meta.app_name, std::back_inserter(output), to_lower);
+        output += " " + meta.version + "\" \"" + meta.man_page_title + "\"\n";
 
         // Print NAME section.
-        std::cout << ".SH NAME\n" << meta.app_name << " \\- " << meta.short_description << std::endl;
+        output += ".SH NAME\n" + meta.app_name + " \\- " + meta.short_description + "\n";
     }
 
     /*!\brief Prints a section title in man page format to std::cout.
@@ -87,16 +108,14 @@ private:
      */
     void print_section(std::string const & title)
     {
-        std::ostream_iterator<char> out(std::cout);
-        std::cout << ".SH ";
-        std::transform(title.begin(),
-                       title.end(),
-                       out,
-                       [](unsigned char c)
-                       {
-                           return std::toupper(c);
-                       });
-        std::cout << "\n";
+        output += ".SH ";
+        std::ranges::transform(title,
+                               std::back_inserter(output),
+                               [](unsigned char c)
+                               {
+                                   return static_cast<char>(std::toupper(c));
+                               });
+        output += '\n';
         is_first_in_section = true;
     }
 
@@ -105,7 +124,9 @@ private:
      */
     void print_subsection(std::string const & title)
     {
-        std::cout << ".SS " << title << "\n";
+        output += ".SS ";
+        output += title;
+        output += '\n';
         is_first_in_section = true;
     }
 
@@ -118,11 +139,12 @@ private:
     void print_line(std::string const & text, bool const line_is_paragraph)
     {
         if (!is_first_in_section && line_is_paragraph)
-            std::cout << ".sp\n";
+            output += ".sp\n";
         else if (!is_first_in_section && !line_is_paragraph)
-            std::cout << ".br\n";
+            output += ".br\n";
 
-        std::cout << text << "\n";
+        output += text;
+        output += '\n';
         is_first_in_section = false;
     }
 
@@ -137,7 +159,11 @@ private:
      */
     void print_list_item(std::string const & term, std::string const & desc)
     {
-        std::cout << ".TP\n" << term << "\n" << desc << "\n";
+        output += ".TP\n";
+        output += term;
+        output += '\n';
+        output += desc;
+        output += '\n';
         is_first_in_section = false;
     }
 
@@ -160,4 +186,13 @@ private:
     bool is_first_in_section{true};
 };
 
+#if SHARG_COMPILED_LIBRARY
+//!\cond
+// Instantiated once in sharg::sharg_compiled.
+extern template class format_help_base<format_man>;
+//!\endcond
+#endif
+
 } // namespace sharg::detail
+
+#endif
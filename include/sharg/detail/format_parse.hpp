@@ -9,10 +9,19 @@
 
 #pragma once
 
+#include <array>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <unordered_map>
+
 #include <sharg/std/charconv>
 
 #include <sharg/concept.hpp>
 #include <sharg/detail/format_base.hpp>
+#include <sharg/detail/pmr_function.hpp>
+#include <sharg/parse_result.hpp>
 
 namespace sharg::detail
 {
@@ -41,26 +50,41 @@ namespace sharg::detail
  * the vector format_parse::arguments. That way, options that are specified multiple times,
  * but are no container type, can be identified and an error is reported.
  *
+ * Errors do not stop the parsing. Instead, a sharg::diagnostic is recorded for each of them and returned by
+ * format_parse::try_parse(). The value of an option is not validated if it could not be parsed.
+ *
+ * All bookkeeping (the arguments and the stored calls) is allocated from the memory resource of the arguments.
+ * The calls refer to the sharg::config they were added with, which must therefore outlive the call to parse.
+ *
  * \remark For a complete overview, take a look at \ref parser
  */
 class format_parse : public format_base
 {
 public:
+    //!\brief The type of the command line arguments.
+    using argument_list = std::pmr::vector<std::pmr::string>;
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
-    format_parse() = delete;                                     //!< Deleted.
-    format_parse(format_parse const & pf) = default;             //!< Defaulted.
-    format_parse & operator=(format_parse const & pf) = default; //!< Defaulted.
-    format_parse(format_parse &&) = default;                     //!< Defaulted.
-    format_parse & operator=(format_parse &&) = default;         //!< Defaulted.
-    ~format_parse() = default;                                   //!< Defaulted.
+    format_parse() = delete;                                    //!< Deleted.
+    format_parse(format_parse const & pf) = delete;             //!< Deleted.
+    format_parse & operator=(format_parse const & pf) = delete; //!< Deleted.
+    format_parse(format_parse &&) = default;                    //!< Defaulted.
+    format_parse & operator=(format_parse &&) = default;        //!< Defaulted.
+    ~format_parse() = default;                                  //!< Defaulted.
 
     /*!\brief The constructor of the parse format.
-     * \param[in] cmd_arguments The command line arguments to parse.
+     * \param[in] cmd_arguments The command line arguments to parse. Its memory resource is used for all bookkeeping.
+     * \param[in] cmd_argument_indices The index in `argv` for each of the `cmd_arguments`. If empty, the position in
+     *                                 `cmd_arguments` is reported in a sharg::diagnostic.
      */
-    format_parse(std::vector<std::string> cmd_arguments) : arguments{std::move(cmd_arguments)}
-    {}
+    format_parse(argument_list cmd_arguments, std::pmr::vector<size_t> cmd_argument_indices = {}) :
+        arguments{std::move(cmd_arguments)},
+        argument_indices{std::move(cmd_argument_indices), arguments.get_allocator()}
+    {
+        assert(argument_indices.empty() || argument_indices.size() == arguments.size());
+    }
     //!\}
 
     /*!\brief Adds an sharg::detail::get_option call to be evaluated later on.
@@ -69,11 +93,32 @@ public:
     template <typename option_type, typename validator_t>
     void add_option(option_type & value, config<validator_t> const & config)
     {
-        option_calls.push_back(
-            [this, &value, config]()
+        option_calls.emplace_back(
+            [this, &value, &config]()
             {
                 get_option(value, config);
-            });
+            },
+            memory_resource());
+    }
+
+    /*!\brief Adds an sharg::detail::get_option call to be evaluated later on. If the option is not given, the value
+     *        returned by `default_provider` is assigned.
+     * \copydetails sharg::parser::add_option(option_type &, config<validator_type>, default_provider_type)
+     */
+    template <typename option_type, typename validator_t, typename default_provider_t>
+    void add_option(option_type & value,
+                    config<validator_t> const & config,
+                    default_provider_t const & default_provider)
+    {
+        option_calls.emplace_back(
+            [this, &value, &config, &default_provider]()
+            {
+                get_option(value, config);
+
+                if (positions(std::string_view{&config.short_id, 1u}).empty() && positions(config.long_id).empty())
+                    value = std::invoke(default_provider);
+            },
+            memory_resource());
     }
 
     /*!\brief Adds a get_flag call to be evaluated later on.
@@ -82,11 +127,12 @@ public:
     template <typename validator_t>
     void add_flag(bool & value, config<validator_t> const & config)
     {
-        flag_calls.push_back(
-            [this, &value, config]()
+        flag_calls.emplace_back(
+            [this, &value, &config]()
             {
                 get_flag(value, config.short_id, config.long_id);
-            });
+            },
+            memory_resource());
     }
 
     /*!\brief Adds a get_positional_option call to be evaluated later on.
@@ -95,35 +141,181 @@ public:
     template <typename option_type, typename validator_t>
     void add_positional_option(option_type & value, config<validator_t> const & config)
     {
-        positional_option_calls.push_back(
-            [this, &value, config]()
+        positional_option_calls.emplace_back(
+            [this, &value, &config]()
             {
                 get_positional_option(value, config.validator);
-            });
+            },
+            memory_resource());
     }
 
-    //!\brief Initiates the actual command line parsing.
+    /*!\brief Initiates the actual command line parsing.
+     * \throws sharg::parser_error The exception of the first diagnostic returned by format_parse::try_parse().
+     */
     void parse(parser_meta_data const & /*meta*/)
     {
-        end_of_options_it = std::find(arguments.begin(), arguments.end(), "--");
+        parse_result{try_parse(true)}.value();
+    }
 
-        // parse options first, because we need to rule out -keyValue pairs
-        // (e.g. -AnoSpaceAfterIdentifierA) before parsing flags
-        for (auto && f : option_calls)
-            f();
+    /*!\brief Initiates the actual command line parsing and returns the diagnostics of the errors that were found.
+     * \param[in] stop_at_first_error Whether to stop parsing after the first (option, flag, or positional option)
+     *                                that caused an error. Used by format_parse::parse, s.t. no further values are
+     *                                assigned after the error that is thrown.
+     */
+    std::vector<diagnostic> try_parse(bool const stop_at_first_error = false)
+    {
+        return run_calls(option_calls,
+                         flag_calls,
+                         positional_option_calls,
+                         [](pmr_function<void()> const & call)
+                         {
+                             call();
+                         },
+                         stop_at_first_error);
+    }
 
-        for (auto && f : flag_calls)
-            f();
+    /*!\brief The parse steps of options, flags and positional options that store their values in data members of
+     *        `storage_t`.
+     * \tparam storage_t The type holding the values.
+     *
+     * \details
+     *
+     * Unlike format_parse::add_option and friends, the steps are not bound to a variable. A table is set up once and
+     * passed to format_parse::try_parse(option_table<storage_t> const &, storage_t &, bool) for every argument vector,
+     * e.g. by sharg::parser_schema.
+     */
+    template <typename storage_t>
+    class option_table
+    {
+    public:
+        //!\brief A parse step. Retrieves and validates the value of one option, flag or positional option.
+        using step_type = std::function<void(format_parse &, storage_t &)>;
 
-        check_for_unknown_ids();
+        //!\brief The kind of a parse step, which determines the order of parsing.
+        enum class kind : uint8_t
+        {
+            option,           //!< An option; parsed first.
+            flag,             //!< A flag; parsed after the options.
+            positional_option //!< A positional option; parsed last.
+        };
+
+        //!\brief Returns the parse step of an option. See sharg::parser::add_option.
+        template <typename option_type, typename validator_t>
+        static step_type option_step(option_type storage_t::*member, config<validator_t> const & config)
+        {
+            return [member, config](format_parse & format, storage_t & storage)
+            {
+                format.get_option(storage.*member, config);
+            };
+        }
 
-        if (end_of_options_it != arguments.end())
-            *end_of_options_it = ""; // remove -- before parsing positional arguments
+        //!\brief Returns the parse step of a flag. See sharg::parser::add_flag.
+        template <typename validator_t>
+        static step_type flag_step(bool storage_t::*member, config<validator_t> const & config)
+        {
+            return [member, short_id = config.short_id, long_id = config.long_id](format_parse & format,
+                                                                                  storage_t & storage)
+            {
+                format.get_flag(storage.*member, short_id, long_id);
+            };
+        }
+
+        //!\brief Returns the parse step of a positional option. See sharg::parser::add_positional_option.
+        template <typename option_type, typename validator_t>
+        static step_type positional_option_step(option_type storage_t::*member, config<validator_t> const & config)
+        {
+            return [member, validator = config.validator](format_parse & format, storage_t & storage)
+            {
+                format.get_positional_option(storage.*member, validator);
+            };
+        }
+
+        //!\brief Appends a parse step of the given kind.
+        void add(kind const step_kind, step_type step)
+        {
+            steps[static_cast<size_t>(step_kind)].push_back(std::move(step));
+        }
+
+    private:
+        //!\brief Befriend format_parse to grant access to the steps.
+        friend format_parse;
+
+        //!\brief The steps of options, flags and positional options, each in the order they were added.
+        std::array<std::vector<step_type>, 3> steps{};
+    };
+
+    /*!\brief Parses the options of a precomputed table into `storage`.
+     * \tparam storage_t The type holding the values.
+     * \param[in] table The parse steps.
+     * \param[in, out] storage The values; options that are not given keep their value.
+     * \param[in] stop_at_first_error See format_parse::try_parse(bool).
+     * \returns The diagnostics of the errors that were found.
+     */
+    template <typename storage_t>
+    std::vector<diagnostic>
+    try_parse(option_table<storage_t> const & table, storage_t & storage, bool const stop_at_first_error = false)
+    {
+        using step_type = typename option_table<storage_t>::step_type;
+
+        return run_calls(table.steps[0],
+                         table.steps[1],
+                         table.steps[2],
+                         [this, &storage](step_type const & step)
+                         {
+                             step(*this, storage);
+                         },
+                         stop_at_first_error);
+    }
 
-        for (auto && f : positional_option_calls)
-            f();
+    /*!\brief Returns the positions in `argv` at which an option or flag identifier was found while parsing.
+     * \param[in] id The short or long identifier without dashes, e.g. "i" or "input".
+     * \returns The positions in the order they were found; empty if the identifier was not given.
+     */
+    std::span<size_t const> positions(std::string_view const id) const
+    {
+        if (auto it = identifier_positions.find(id); it != identifier_positions.end())
+            return it->second;
+
+        return {};
+    }
+
+    /*!\brief Sets the positions of an identifier without parsing, e.g. when restoring a serialised parser state.
+     * \param[in] id The short or long identifier without dashes.
+     * \param[in] indices The positions in `argv`.
+     */
+    void restore_positions(std::string_view const id, std::span<size_t const> const indices)
+    {
+        for (size_t const index : indices)
+            record_position(id, index);
+    }
 
-        check_for_left_over_args();
+    /*!\brief Sets the option values that are used if an option or flag is not given on the command line.
+     * \param[in] values The values in the notation of the command line, e.g. `--threads=4` or `--verbose`.
+     *
+     * \details
+     *
+     * The values are read from environment variables and a configuration file by the sharg::parser.
+     * An option or flag is only looked up in `values` if neither of its identifiers was given on the command line.
+     * Its position is recorded as sharg::diagnostic::npos.
+     */
+    void set_fallback_arguments(argument_list const & values)
+    {
+        fallback_arguments.assign(values.begin(), values.end());
+        fallback_argument_indices.assign(values.size(), diagnostic::npos);
+    }
+
+    /*!\brief Sets the values of the positional options that are used if no positional argument is given on the
+     *        command line.
+     * \param[in] values The values in the order of the positional options.
+     *
+     * \details
+     *
+     * The values are read from a parameter file by the sharg::parser. They are not merged with the command line: If
+     * at least one positional argument is given, all values are taken from the command line.
+     */
+    void set_fallback_positional_arguments(argument_list const & values)
+    {
+        fallback_positional_arguments.assign(values.begin(), values.end());
     }
 
     // functions are not needed for command line parsing but are part of the format help interface.
@@ -177,35 +369,167 @@ public:
 
         return (std::find_if(begin_it,
                              end_it,
-                             [&](std::string const & current_arg)
+                             [&](std::string_view const current_arg)
                              {
-                                 std::string full_id = prepend_dash(id);
-
                                  if constexpr (std::same_as<id_type, char>) // short id
                                  {
                                      // check if current_arg starts with "-o", i.e. it correctly identifies all short notations:
                                      // "-ovalue", "-o=value", and "-o value".
-                                     return current_arg.substr(0, full_id.size()) == full_id;
+                                     return current_arg.size() >= 2u && current_arg[0] == '-' && current_arg[1] == id;
                                  }
                                  else
                                  {
                                      // only "--opt Value" or "--opt=Value" are valid
-                                     return current_arg.substr(0, full_id.size()) == full_id && // prefix is the same
-                                            (current_arg.size() == full_id.size()
-                                             || current_arg[full_id.size()] == '='); // space or `=`
+                                     size_t const full_id_size = id.size() + 2u;
+                                     return current_arg.starts_with("--")
+                                         && current_arg.substr(2u, id.size()) == id // prefix is the same
+                                         && (current_arg.size() == full_id_size
+                                             || (current_arg.size() > full_id_size
+                                                 && current_arg[full_id_size] == '=')); // space or `=`
                                  }
                              }));
     }
 
 private:
+    /*!\brief Runs the parse steps of options, flags and positional options, and checks the arguments in between.
+     * \param[in] options The steps that retrieve the values of the options.
+     * \param[in] flags The steps that retrieve the values of the flags.
+     * \param[in] positional_options The steps that retrieve the values of the positional options.
+     * \param[in] invoke Runs a single step.
+     * \param[in] stop_at_first_error See format_parse::try_parse(bool).
+     * \returns The diagnostics of the errors that were found.
+     */
+    template <typename calls_t, typename invoke_t>
+    std::vector<diagnostic> run_calls(calls_t const & options,
+                                      calls_t const & flags,
+                                      calls_t const & positional_options,
+                                      invoke_t && invoke,
+                                      bool const stop_at_first_error)
+    {
+        diagnostics.clear();
+        identifier_positions.clear();
+        end_of_options_it = std::find(arguments.begin(), arguments.end(), "--");
+        positional_option_total = positional_options.size();
+
+        // Returns false if parsing should stop.
+        auto run = [this, &invoke, stop_at_first_error](calls_t const & calls)
+        {
+            for (auto && call : calls)
+            {
+                invoke(call);
+
+                if (stop_at_first_error && !diagnostics.empty())
+                    return false;
+            }
+
+            return true;
+        };
+
+        // parse options first, because we need to rule out -keyValue pairs
+        // (e.g. -AnoSpaceAfterIdentifierA) before parsing flags
+        if (!run(options) || !run(flags))
+            return std::move(diagnostics);
+
+        check_for_unknown_ids();
+
+        if (stop_at_first_error && !diagnostics.empty())
+            return std::move(diagnostics);
+
+        if (end_of_options_it != arguments.end())
+            *end_of_options_it = ""; // remove -- before parsing positional arguments
+
+        use_fallback_positional_arguments();
+
+        if (run(positional_options))
+            check_for_left_over_args();
+
+        return std::move(diagnostics);
+    }
+
+    /*!\brief Returns how often the identifier occurs in format_parse::arguments before \--.
+     * \param[in] id The identifier to search for (must not contain dashes).
+     * \details
+     * Used to reserve the space for the values of a container option. See format_parse::find_option_id.
+     */
+    template <typename id_type>
+    size_t count_option_id(id_type const & id)
+    {
+        size_t count{};
+
+        for (auto it = find_option_id(arguments.begin(), end_of_options_it, id); it != end_of_options_it;
+             it = find_option_id(std::next(it), end_of_options_it, id))
+        {
+            ++count;
+        }
+
+        return count;
+    }
+
     //!\brief Describes the result of parsing the user input string given the respective option value type.
     enum class option_parse_result
     {
-        success,       //!< Parsing of user input was successful.
-        error,         //!< There was some error while trying to parse the user input.
-        overflow_error //!< Parsing was successful but the arithmetic value would cause an overflow.
+        success,            //!< Parsing of user input was successful.
+        error,              //!< There was some error while trying to parse the user input.
+        overflow_error,     //!< Parsing was successful but the arithmetic value would cause an overflow.
+        invalid_enumeration //!< The user input is not a key in sharg::enumeration_names.
+    };
+
+    //!\brief The type that a single user input is parsed into, i.e. the value type of a container option.
+    template <typename option_type>
+    struct parsed_value
+    {
+        //!\brief The option type itself.
+        using type = option_type;
+    };
+
+    //!\brief The type that a single user input is parsed into, i.e. the value type of a container option.
+    template <detail::is_container_option option_type>
+    struct parsed_value<option_type>
+    {
+        //!\brief The value type of the container.
+        using type = typename option_type::value_type;
     };
 
+    //!\brief Returns the index in `argv` of the argument `it` points to.
+    size_t argument_index(argument_list::const_iterator const it) const
+    {
+        size_t const position = it - arguments.begin();
+        return argument_indices.empty() ? position : argument_indices[position];
+    }
+
+    //!\brief Records that the identifier `id` was found at index `index` in `argv`. See format_parse::positions.
+    template <typename id_type>
+    void record_position(id_type const & id, size_t const index)
+    {
+        std::string_view key{};
+
+        if constexpr (std::same_as<id_type, char>)
+            key = std::string_view{&id, 1u};
+        else
+            key = id;
+
+        auto it = identifier_positions.find(key);
+
+        if (it == identifier_positions.end())
+        {
+            it = identifier_positions.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>{})
+                     .first;
+        }
+
+        it->second.push_back(index);
+    }
+
+    //!\brief Records a sharg::diagnostic.
+    void add_diagnostic(diagnostic_kind const kind,
+                        std::string option_id,
+                        size_t const index,
+                        std::string value,
+                        diagnostic::formatter_t const formatter,
+                        std::string detail = {})
+    {
+        diagnostics.emplace_back(kind, std::move(option_id), index, std::move(value), formatter, std::move(detail));
+    }
+
     /*!\brief Appends a double dash to a long identifier and returns it.
     * \param[in] long_id The name of the long identifier.
     * \returns The input long name prepended with a double dash.
@@ -224,6 +548,36 @@ private:
         return {'-', short_id};
     }
 
+    //!\brief Returns the size of the long identifier prepended with a double dash.
+    static size_t dashed_size(std::string const & long_id)
+    {
+        return long_id.size() + 2u;
+    }
+
+    //!\brief Returns the size of the short identifier prepended with a single dash.
+    static size_t dashed_size(char const)
+    {
+        return 2u;
+    }
+
+    //!\brief Returns the name of the current positional option, e.g. "positional option 1".
+    std::string positional_option_name() const
+    {
+        return positional_option_name(positional_option_count);
+    }
+
+    //!\brief Returns the name of the positional option at `position`, e.g. "positional option 1".
+    static std::string positional_option_name(unsigned const position)
+    {
+        return "positional option " + std::to_string(position);
+    }
+
+    //!\brief Returns the memory resource used for all bookkeeping.
+    std::pmr::memory_resource * memory_resource() const
+    {
+        return arguments.get_allocator().resource();
+    }
+
     /*!\brief Returns "-[short_id]/--[long_id]" if both are non-empty or just one of them if the other is empty.
     * \param[in] short_id The name of the short identifier.
     * \param[in] long_id  The name of the long identifier.
@@ -244,10 +598,19 @@ private:
      */
     bool flag_is_set(std::string const & long_id)
     {
-        auto it = std::find(arguments.begin(), end_of_options_it, prepend_dash(long_id));
+        auto it = std::find_if(arguments.begin(),
+                               end_of_options_it,
+                               [&long_id](std::string_view const arg)
+                               {
+                                   return arg.size() == dashed_size(long_id) && arg.starts_with("--")
+                                       && arg.substr(2) == long_id;
+                               });
 
         if (it != end_of_options_it)
+        {
+            record_position(long_id, argument_index(it));
             *it = ""; // remove seen flag
+        }
 
         return (it != end_of_options_it);
     }
@@ -258,14 +621,17 @@ private:
     bool flag_is_set(char const short_id)
     {
         // short flags need special attention, since they could be grouped (-rGv <=> -r -G -v)
-        for (std::string & arg : arguments)
+        for (auto it = arguments.begin(); it != arguments.end(); ++it)
         {
+            std::pmr::string & arg = *it;
+
             if (arg[0] == '-' && arg.size() > 1 && arg[1] != '-') // is option && not dash && no long option
             {
                 auto pos = arg.find(short_id);
 
                 if (pos != std::string::npos)
                 {
+                    record_position(short_id, argument_index(it));
                     arg.erase(pos, 1); // remove seen bool
 
                     if (arg == "-") // if flag is empty now
@@ -287,9 +653,9 @@ private:
      */
     template <typename option_t>
         requires istreamable<option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        std::istringstream stream{in};
+        std::istringstream stream{std::string{in}};
         stream >> value;
 
         if (stream.fail() || !stream.eof())
@@ -302,59 +668,63 @@ private:
      * \tparam option_t Must model sharg::named_enumeration.
      * \param[out] value Stores the parsed value.
      * \param[in] in The input argument to be parsed.
-     * \throws sharg::user_input_error if `in` is not a key in sharg::enumeration_names<option_t>.
-     * \returns sharg::option_parse_result::success.
+     * \returns sharg::option_parse_result::invalid_enumeration if `in` is not a key in
+     *          sharg::enumeration_names<option_t> and otherwise sharg::option_parse_result::success.
      */
     template <named_enumeration option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        auto map = sharg::enumeration_names<option_t>;
+        option_t const * parsed_value = detail::find_enumeration_value<option_t>(in);
 
-        if (auto it = map.find(in); it == map.end())
-        {
-            std::string keys = [&map]()
-            {
-                std::vector<std::pair<std::string_view, option_t>> key_value_pairs(map.begin(), map.end());
-
-                std::sort(key_value_pairs.begin(),
-                          key_value_pairs.end(),
-                          [](auto pair1, auto pair2)
-                          {
-                              if constexpr (std::totally_ordered<option_t>)
-                              {
-                                  if (pair1.second != pair2.second)
-                                      return pair1.second < pair2.second;
-                              }
-
-                              return pair1.first < pair2.first;
-                          }); // needed for deterministic output when using unordered maps
-
-                std::string result{'['};
-                for (auto const & [key, value] : key_value_pairs)
-                    result += std::string{key.data()} + ", ";
-                result.replace(result.size() - 2, 2, "]"); // replace last ", " by "]"
-                return result;
-            }();
-
-            throw user_input_error{"You have chosen an invalid input value: " + in + ". Please use one of: " + keys};
-        }
-        else
+        if (parsed_value == nullptr)
+            return option_parse_result::invalid_enumeration;
+
+        value = *parsed_value;
+        return option_parse_result::success;
+    }
+
+    /*!\brief Adds the values of a comma separated list of keys in sharg::enumeration_names<enum_t> to a
+     *        sharg::flag_set.
+     * \tparam enum_t The type of the enumeration.
+     * \param[out] value Stores the parsed values.
+     * \param[in] in The input argument to be parsed, e.g. "a,b,c".
+     * \returns sharg::option_parse_result::invalid_enumeration if any element of `in` is not a key in
+     *          sharg::enumeration_names<enum_t> and otherwise sharg::option_parse_result::success.
+     *
+     * \details
+     *
+     * No value is added if any of the keys is invalid.
+     */
+    template <typename enum_t>
+    option_parse_result parse_option_value(flag_set<enum_t> & value, std::string_view const in)
+    {
+        flag_set<enum_t> parsed{};
+
+        for (size_t start = 0, end = 0; end != std::string_view::npos; start = end + 1)
         {
-            value = it->second;
+            end = in.find(',', start);
+            enum_t const * parsed_value = detail::find_enumeration_value<enum_t>(in.substr(start, end - start));
+
+            if (parsed_value == nullptr)
+                return option_parse_result::invalid_enumeration;
+
+            parsed.insert(*parsed_value);
         }
 
+        value |= parsed;
+        ++stored_value_count;
         return option_parse_result::success;
     }
 
     //!\cond
-    option_parse_result parse_option_value(std::string & value, std::string const & in)
+    option_parse_result parse_option_value(std::string & value, std::string_view const in)
     {
         value = in;
         return option_parse_result::success;
     }
     //!\endcond
 
-    /*!\brief Parses the given option value and appends it to the target container.
+    /*!\brief Parses the given option value and stores it in the target container.
      * \tparam container_option_t Must model sharg::detail::is_container_option and
      *                            its value_type must be parseable via parse_option_value
      * \tparam format_parse_t Needed to make the function "dependent" (i.e. do instantiation in the second phase of
@@ -364,28 +734,104 @@ private:
      * \param[out] value The container that stores the parsed value.
      * \param[in] in The input argument to be parsed.
      * \returns A sharg::option_parse_result whether parsing was successful or not.
+     *
+     * \details
+     *
+     * The parsed value is moved into the container via `push_back` or, e.g. for sets, `insert`. A fixed size container
+     * is overwritten element by element; values beyond its size are only counted. See format_parse::prepare_container.
      */
     // clang-format off
     template <detail::is_container_option container_option_t, typename format_parse_t = format_parse>
         requires requires (format_parse_t fp,
                            typename container_option_t::value_type & container_value,
-                           std::string const & in)
+                           std::string_view const in)
         {
             {fp.parse_option_value(container_value, in)} -> std::same_as<option_parse_result>;
         }
     // clang-format on
-    option_parse_result parse_option_value(container_option_t & value, std::string const & in)
+    option_parse_result parse_option_value(container_option_t & value, std::string_view const in)
     {
         typename container_option_t::value_type tmp{};
 
         auto res = parse_option_value(tmp, in);
 
         if (res == option_parse_result::success)
-            value.push_back(tmp);
+        {
+            if constexpr (detail::is_fixed_size_container_option<container_option_t>)
+            {
+                if (stored_value_count < std::tuple_size_v<container_option_t>)
+                    value[stored_value_count] = std::move(tmp);
+            }
+            else if constexpr (requires { value.push_back(std::move(tmp)); })
+            {
+                value.push_back(std::move(tmp));
+            }
+            else
+            {
+                value.insert(std::move(tmp));
+            }
+
+            ++stored_value_count;
+        }
 
         return res;
     }
 
+    /*!\brief Prepares a container option before the values given on the command line are stored.
+     * \param[out] value The container option.
+     * \param[in] value_count The number of values that will be stored.
+     *
+     * \details
+     *
+     * A growing container is cleared, i.e. given values replace the default, and space for `value_count` elements is
+     * reserved if the container supports it. A fixed size container keeps its elements; they are overwritten.
+     */
+    template <detail::is_container_option container_option_t>
+    void prepare_container(container_option_t & value, size_t const value_count)
+    {
+        stored_value_count = 0u;
+
+        if constexpr (!detail::is_fixed_size_container_option<container_option_t>)
+        {
+            value.clear();
+
+            if constexpr (requires { value.reserve(value_count); })
+                value.reserve(value_count);
+        }
+    }
+
+    /*!\brief Records a diagnostic if a fixed size container option did not get exactly as many values as its size.
+     * \param[in] option_name The name of the option, e.g. `--coordinate` or `positional option 1`.
+     * \param[in] index The index in `argv` of the last given value.
+     */
+    template <detail::is_container_option container_option_t>
+    void check_fixed_size(std::string option_name, size_t const index)
+    {
+        if constexpr (detail::is_fixed_size_container_option<container_option_t>)
+        {
+            if (stored_value_count == std::tuple_size_v<container_option_t>)
+                return;
+
+            add_diagnostic(stored_value_count < std::tuple_size_v<container_option_t>
+                               ? diagnostic_kind::too_few_arguments
+                               : diagnostic_kind::too_many_arguments,
+                           std::move(option_name),
+                           index,
+                           {},
+                           [](diagnostic const & d, std::string const & counts)
+                           {
+                               return "Wrong number of values for " + d.option_id + ": " + counts + '.';
+                           },
+                           std::to_string(std::tuple_size_v<container_option_t>) + " values are required but "
+                               + std::to_string(stored_value_count) + " were given");
+        }
+        else
+        {
+            (void)option_name;
+            (void)index;
+        }
+    }
+
     /*!\brief Tries to parse an input string into an arithmetic value.
      * \tparam option_t The option value type; must model std::is_arithmetic_v.
      * \param[out] value Stores the parsed value.
@@ -400,13 +846,13 @@ private:
      */
     template <typename option_t>
         requires std::is_arithmetic_v<option_t> && istreamable<option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        auto res = std::from_chars(&in[0], &in[in.size()], value);
+        auto res = std::from_chars(in.data(), in.data() + in.size(), value);
 
         if (res.ec == std::errc::result_out_of_range)
             return option_parse_result::overflow_error;
-        else if (res.ec == std::errc::invalid_argument || res.ptr != &in[in.size()])
+        else if (res.ec == std::errc::invalid_argument || res.ptr != in.data() + in.size())
             return option_parse_result::error;
 
         return option_parse_result::success;
@@ -422,7 +868,7 @@ private:
      * This function accepts the strings "0" or "false" which sets sets `value` to `false` or "1" or "true" which
      * sets `value` to `true`.
      */
-    option_parse_result parse_option_value(bool & value, std::string const & in)
+    option_parse_result parse_option_value(bool & value, std::string_view const in)
     {
         if (in == "0")
             value = false;
@@ -438,37 +884,71 @@ private:
         return option_parse_result::success;
     }
 
-    /*!\brief Tries to parse an input string into boolean value.
-     * \param[in] res A result value of parsing an input string to the respective option value type.
+    /*!\brief Records a sharg::diagnostic for user input that could not be parsed.
+     * \param[in] res A result value of parsing an input string to the respective option value type; not
+     *                sharg::option_parse_result::success.
      * \param[in] option_name The name of the option whose input was parsed.
      * \param[in] input_value The original user input in question.
+     * \param[in] index The index of the user input in `argv`.
      *
-     * \throws sharg::user_input_error if `res` was not sharg::option_parse_result::success.
+     * \details
+     * The messages are only created if requested, hence the type information is captured in the formatters.
      */
     template <typename option_type>
-    void throw_on_input_error(option_parse_result const res,
-                              std::string const & option_name,
-                              std::string const & input_value)
+    void report_input_error(option_parse_result const res,
+                            std::string option_name,
+                            std::string_view const input_value,
+                            size_t const index)
     {
-        std::string msg{"Value parse failed for " + option_name + ": "};
+        assert(res != option_parse_result::success);
+        using value_t = typename parsed_value<option_type>::type;
 
         if (res == option_parse_result::error)
         {
-            throw user_input_error{msg + "Argument " + input_value + " could not be parsed as type "
-                                   + get_type_name_as_string(option_type{}) + "."};
+            add_diagnostic(diagnostic_kind::user_input_error,
+                           std::move(option_name),
+                           index,
+                           std::string{input_value},
+                           [](diagnostic const & d, std::string const &)
+                           {
+                               return "Value parse failed for " + d.option_id + ": Argument " + d.value
+                                    + " could not be parsed as type " + get_type_name_as_string(option_type{}) + ".";
+                           });
         }
 
-        if constexpr (std::is_arithmetic_v<option_type>)
+        if constexpr (std::is_arithmetic_v<value_t>)
         {
             if (res == option_parse_result::overflow_error)
             {
-                throw user_input_error{msg + "Numeric argument " + input_value + " is not in the valid range ["
-                                       + std::to_string(std::numeric_limits<option_type>::min()) + ","
-                                       + std::to_string(std::numeric_limits<option_type>::max()) + "]."};
+                add_diagnostic(diagnostic_kind::user_input_error,
+                               std::move(option_name),
+                               index,
+                               std::string{input_value},
+                               [](diagnostic const & d, std::string const &)
+                               {
+                                   return "Value parse failed for " + d.option_id + ": Numeric argument " + d.value
+                                        + " is not in the valid range ["
+                                        + std::to_string(std::numeric_limits<value_t>::min()) + ","
+                                        + std::to_string(std::numeric_limits<value_t>::max()) + "].";
+                               });
             }
         }
 
-        assert(res == option_parse_result::success); // if nothing was thrown, the result must have been a success
+        if constexpr (named_enumeration<value_t>)
+        {
+            if (res == option_parse_result::invalid_enumeration)
+            {
+                add_diagnostic(diagnostic_kind::user_input_error,
+                               std::move(option_name),
+                               index,
+                               std::string{input_value},
+                               [](diagnostic const & d, std::string const &)
+                               {
+                                   return "You have chosen an invalid input value: " + d.value
+                                        + ". Please use one of: " + detail::enumeration_keys<value_t>();
+                               });
+            }
+        }
     }
 
     /*!\brief Handles value retrieval for options based on different key-value pairs.
@@ -477,54 +957,75 @@ private:
      * \param[in]  option_it The iterator where the option identifier was found.
      * \param[in]  id        The option identifier supplied on the command line.
      *
-     * \throws sharg::too_few_arguments if the option was not followed by a value.
-     * \throws sharg::user_input_error if the given option value was invalid.
-     *
      * \details
      *
      * The value at option_it is inspected whether it is an '-key value', '-key=value'
      * or '-keyValue' pair and the input is extracted accordingly. The input
      * will then be tried to be parsed into the `value` parameter.
      *
-     * Returns true on success and false otherwise.
+     * Records a sharg::diagnostic_kind::too_few_arguments if the option was not followed by a value and a
+     * sharg::diagnostic_kind::user_input_error if the given option value was invalid.
+     *
+     * Returns true if the option was found and false otherwise.
      */
     template <typename option_type, typename id_type>
-    bool identify_and_retrieve_option_value(option_type & value,
-                                            std::vector<std::string>::iterator & option_it,
-                                            id_type const & id)
+    bool
+    identify_and_retrieve_option_value(option_type & value, argument_list::iterator & option_it, id_type const & id)
     {
         if (option_it != end_of_options_it)
         {
-            std::string input_value;
-            size_t id_size = (prepend_dash(id)).size();
+            auto report_missing_value = [this, &id](size_t const index)
+            {
+                add_diagnostic(diagnostic_kind::too_few_arguments,
+                               prepend_dash(id),
+                               index,
+                               {},
+                               [](diagnostic const & d, std::string const &)
+                               {
+                                   return "Missing value for option " + d.option_id;
+                               });
+            };
+
+            std::string_view input_value;
+            size_t const id_size = dashed_size(id);
+            size_t value_index = argument_index(option_it);
 
             if ((*option_it).size() > id_size) // identifier includes value (-keyValue or -key=value)
             {
                 if ((*option_it)[id_size] == '=') // -key=value
                 {
                     if ((*option_it).size() == id_size + 1) // malformed because no value follows '-i='
-                        throw too_few_arguments("Missing value for option " + prepend_dash(id));
-                    input_value = (*option_it).substr(id_size + 1);
+                    {
+                        report_missing_value(value_index);
+                        *option_it = "";
+                        return true;
+                    }
+                    input_value = std::string_view{*option_it}.substr(id_size + 1);
                 }
                 else // -kevValue
                 {
-                    input_value = (*option_it).substr(id_size);
+                    input_value = std::string_view{*option_it}.substr(id_size);
                 }
-
-                *option_it = ""; // remove used identifier-value pair
             }
             else // -key value
             {
                 *option_it = ""; // remove used identifier
                 ++option_it;
                 if (option_it == end_of_options_it) // should not happen
-                    throw too_few_arguments("Missing value for option " + prepend_dash(id));
+                {
+                    report_missing_value(value_index);
+                    return true;
+                }
+                value_index = argument_index(option_it);
                 input_value = *option_it;
-                *option_it = ""; // remove value
             }
 
-            auto res = parse_option_value(value, input_value);
-            throw_on_input_error<option_type>(res, prepend_dash(id), input_value);
+            // The input is a view on the argument, so the argument is removed after parsing.
+            if (auto res = parse_option_value(value, input_value); res != option_parse_result::success)
+                report_input_error<option_type>(res, prepend_dash(id), input_value, value_index);
+
+            *option_it = ""; // remove used identifier-value pair or value
+            last_value_index = value_index;
 
             return true;
         }
@@ -536,13 +1037,12 @@ private:
      * \param[out] value Stores the value found in arguments, parsed by parse_option_value.
      * \param[in] id The option identifier supplied on the command line.
      *
-     * \throws sharg::option_declared_multiple_times
-     *
      * \details
      *
      * If the option identifier is found in format_parse::arguments, the value of
      * the following position in arguments is tried to be parsed given the respective option value type
      * and the identifier and value argument are removed from arguments.
+     * If the identifier is found again, a sharg::diagnostic_kind::option_declared_multiple_times is recorded.
      *
      * Returns true on success and false otherwise. This is needed to catch
      * the user error of supplying multiple arguments for the same
@@ -554,11 +1054,23 @@ private:
         auto it = find_option_id(arguments.begin(), end_of_options_it, id);
 
         if (it != end_of_options_it)
+        {
+            record_position(id, argument_index(it));
             identify_and_retrieve_option_value(value, it, id);
+        }
 
-        if (find_option_id(it, end_of_options_it, id) != end_of_options_it) // should not be found again
-            throw option_declared_multiple_times("Option " + prepend_dash(id)
-                                                 + " is no list/container but declared multiple times.");
+        // should not be found again
+        if (auto again_it = find_option_id(it, end_of_options_it, id); again_it != end_of_options_it)
+        {
+            add_diagnostic(diagnostic_kind::option_declared_multiple_times,
+                           prepend_dash(id),
+                           argument_index(again_it),
+                           std::string{*again_it},
+                           [](diagnostic const & d, std::string const &)
+                           {
+                               return "Option " + d.option_id + " is no list/container but declared multiple times.";
+                           });
+        }
 
         return (it != end_of_options_it); // first search was successful or not
     }
@@ -571,8 +1083,7 @@ private:
      * \details
      *
      * Since option_type is a container, the option is a list and can be parsed
-     * multiple times.
-     *
+     * multiple times. The container must have been prepared via format_parse::prepare_container.
      */
     template <detail::is_container_option option_type, typename id_type>
     bool get_option_by_id(option_type & value, id_type const & id)
@@ -580,11 +1091,9 @@ private:
         auto it = find_option_id(arguments.begin(), end_of_options_it, id);
         bool seen_at_least_once{it != end_of_options_it};
 
-        if (seen_at_least_once)
-            value.clear();
-
         while (it != end_of_options_it)
         {
+            record_position(id, argument_index(it));
             identify_and_retrieve_option_value(value, it, id);
             it = find_option_id(it, end_of_options_it, id);
         }
@@ -593,14 +1102,13 @@ private:
     }
 
     /*!\brief Checks format_parse::arguments for unknown options/flags.
-     *
-     * \throws sharg::unknown_option
      *
      * \details
      *
      * This function is used by format_parse::parse() AFTER all flags and options
      * specified by the developer were parsed and therefore removed from arguments.
-     * Thus, all remaining flags/options are unknown.
+     * Thus, all remaining flags/options are unknown and a sharg::diagnostic_kind::unknown_option is recorded for
+     * each of them. The unknown identifiers are removed, s.t. they are not parsed as positional options.
      *
      * In addition this function removes "--" (if specified) from arguments to
      * clean arguments for positional option retrieval.
@@ -609,7 +1117,7 @@ private:
     {
         for (auto it = arguments.begin(); it != end_of_options_it; ++it)
         {
-            std::string arg{*it};
+            std::string_view const arg{*it};
             if (!arg.empty() && arg[0] == '-') // may be an identifier
             {
                 if (arg == "-")
@@ -618,43 +1126,68 @@ private:
                 }
                 else if (arg[1] != '-' && arg.size() > 2) // one dash, but more than one character (-> multiple flags)
                 {
-                    throw unknown_option("Unknown flags " + expand_multiple_flags(arg)
-                                         + ". In case this is meant to be a non-option/argument/parameter, "
-                                         + "please specify the start of arguments with '--'. "
-                                         + "See -h/--help for program information.");
+                    add_diagnostic(diagnostic_kind::unknown_option,
+                                   {},
+                                   argument_index(it),
+                                   std::string{arg},
+                                   [](diagnostic const & d, std::string const &)
+                                   {
+                                       return "Unknown flags " + expand_multiple_flags(d.value)
+                                            + ". In case this is meant to be a non-option/argument/parameter, "
+                                            + "please specify the start of arguments with '--'. "
+                                            + "See -h/--help for program information.";
+                                   });
                 }
                 else // unknown short or long option
                 {
-                    throw unknown_option("Unknown option " + arg
-                                         + ". In case this is meant to be a non-option/argument/parameter, "
-                                         + "please specify the start of non-options with '--'. "
-                                         + "See -h/--help for program information.");
+                    add_diagnostic(diagnostic_kind::unknown_option,
+                                   {},
+                                   argument_index(it),
+                                   std::string{arg},
+                                   [](diagnostic const & d, std::string const &)
+                                   {
+                                       return "Unknown option " + d.value
+                                            + ". In case this is meant to be a non-option/argument/parameter, "
+                                            + "please specify the start of non-options with '--'. "
+                                            + "See -h/--help for program information.";
+                                   });
                 }
+
+                *it = ""; // remove reported identifier
             }
         }
     }
 
-    /*!\brief Checks format_parse::arguments for unknown options/flags.
-     *
-     * \throws sharg::too_many_arguments
+    /*!\brief Checks format_parse::arguments for left over arguments.
      *
      * \details
      *
      * This function is used by format_parse::parse() AFTER all flags, options
      * and positional options specified by the developer were parsed and
      * therefore removed from arguments.
-     * Thus, all remaining non-empty arguments are too much.
+     * Thus, all remaining non-empty arguments are too much and a single sharg::diagnostic_kind::too_many_arguments
+     * pointing to the first of them is recorded.
      */
     void check_for_left_over_args()
     {
-        if (std::find_if(arguments.begin(),
-                         arguments.end(),
-                         [](std::string const & s)
-                         {
-                             return (s != "");
-                         })
-            != arguments.end())
-            throw too_many_arguments("Too many arguments provided. Please see -h/--help for more information.");
+        auto it = std::find_if(arguments.begin(),
+                               arguments.end(),
+                               [](std::string_view const s)
+                               {
+                                   return (s != "");
+                               });
+
+        if (it != arguments.end())
+        {
+            add_diagnostic(diagnostic_kind::too_many_arguments,
+                           {},
+                           argument_index(it),
+                           std::string{*it},
+                           [](diagnostic const &, std::string const &) -> std::string
+                           {
+                               return "Too many arguments provided. Please see -h/--help for more information.";
+                           });
+        }
     }
 
     /*!\brief Handles command line option retrieval.
@@ -662,28 +1195,60 @@ private:
      * \param[out] value The variable in which to store the given command line argument.
      * \param[in] config A configuration object to customise the sharg::parser behaviour. See sharg::config.
      *
-     * \throws sharg::option_declared_multiple_times
-     * \throws sharg::validation_error
-     * \throws sharg::required_option_missing
-     *
      * \details
      *
      * This function
      * - checks if the option is required but not set,
      * - retrieves any value found by the short or long identifier,
-     * - throws on (mis)use of both identifiers for non-container type values,
-     * - re-throws the validation exception with appended option information.
+     * - reports (mis)use of both identifiers for non-container type values,
+     * - reports the validation exception with appended option information.
+     *
+     * The value is not validated if an error was reported while retrieving it.
      */
     template <typename option_type, typename validator_t>
     void get_option(option_type & value, config<validator_t> const & config)
     {
-        bool short_id_is_set{get_option_by_id(value, config.short_id)};
-        bool long_id_is_set{get_option_by_id(value, config.long_id)};
+        size_t const diagnostic_count = diagnostics.size();
+
+        auto retrieve = [this, &value, &config]()
+        {
+            if constexpr (detail::is_container_option<option_type>)
+            {
+                // Given values replace the default. Reserve space for all of them at once.
+                if (size_t const count = count_option_id(config.short_id) + count_option_id(config.long_id); count > 0u)
+                    prepare_container(value, count);
+            }
+
+            bool const short_id_is_set{get_option_by_id(value, config.short_id)};
+            return std::pair{short_id_is_set, get_option_by_id(value, config.long_id)};
+        };
+
+        auto [short_id_is_set, long_id_is_set] = retrieve();
+
+        if (!short_id_is_set && !long_id_is_set && !fallback_arguments.empty())
+            std::tie(short_id_is_set, long_id_is_set) = from_fallback_arguments(retrieve);
 
         // if value is no container we need to check for multiple declarations
         if (short_id_is_set && long_id_is_set && !detail::is_container_option<option_type>)
-            throw option_declared_multiple_times("Option " + combine_option_names(config.short_id, config.long_id)
-                                                 + " is no list/container but specified multiple times");
+        {
+            add_diagnostic(diagnostic_kind::option_declared_multiple_times,
+                           combine_option_names(config.short_id, config.long_id),
+                           diagnostic::npos,
+                           {},
+                           [](diagnostic const & d, std::string const &)
+                           {
+                               return "Option " + d.option_id + " is no list/container but specified multiple times";
+                           });
+        }
+
+        if constexpr (detail::is_container_option<option_type>)
+        {
+            if ((short_id_is_set || long_id_is_set) && diagnostics.size() == diagnostic_count)
+                check_fixed_size<option_type>(combine_option_names(config.short_id, config.long_id), last_value_index);
+        }
+
+        if (diagnostics.size() != diagnostic_count)
+            return;
 
         if (short_id_is_set || long_id_is_set)
         {
@@ -693,16 +1258,31 @@ private:
             }
             catch (std::exception & ex)
             {
-                throw validation_error(std::string("Validation failed for option ")
-                                       + combine_option_names(config.short_id, config.long_id) + ": " + ex.what());
+                add_diagnostic(diagnostic_kind::validation_error,
+                               combine_option_names(config.short_id, config.long_id),
+                               last_value_index,
+                               {},
+                               [](diagnostic const & d, std::string const & what)
+                               {
+                                   return "Validation failed for option " + d.option_id + ": " + what;
+                               },
+                               ex.what());
             }
         }
         else // option is not set
         {
             // check if option is required
             if (config.required)
-                throw required_option_missing("Option " + combine_option_names(config.short_id, config.long_id)
-                                              + " is required but not set.");
+            {
+                add_diagnostic(diagnostic_kind::required_option_missing,
+                               combine_option_names(config.short_id, config.long_id),
+                               diagnostic::npos,
+                               {},
+                               [](diagnostic const & d, std::string const &)
+                               {
+                                   return "Option " + d.option_id + " is required but not set.";
+                               });
+            }
         }
     }
 
@@ -717,7 +1297,70 @@ private:
     {
         // `|| value` is needed to keep the value if it was set before.
         // It must be last because `flag_is_set` removes the flag from the arguments.
-        value = flag_is_set(short_id) || flag_is_set(long_id) || value;
+        value = flag_is_set(short_id) || flag_is_set(long_id) || flag_is_set_in_fallback_arguments(short_id, long_id)
+             || value;
+    }
+
+    /*!\brief Calls `retrieve` with format_parse::fallback_arguments in place of the command line arguments.
+     * \param[in] retrieve The function that looks up an option or flag.
+     * \returns The result of `retrieve`.
+     */
+    template <typename retrieve_t>
+    auto from_fallback_arguments(retrieve_t && retrieve)
+    {
+        argument_list::iterator const command_line_end = end_of_options_it;
+
+        std::swap(arguments, fallback_arguments);
+        std::swap(argument_indices, fallback_argument_indices);
+        end_of_options_it = arguments.end();
+
+        auto result = retrieve();
+
+        std::swap(arguments, fallback_arguments);
+        std::swap(argument_indices, fallback_argument_indices);
+        end_of_options_it = command_line_end; // Swapping does not invalidate iterators.
+
+        return result;
+    }
+
+    //!\brief Returns true if an identifier of a flag is in format_parse::fallback_arguments.
+    bool flag_is_set_in_fallback_arguments(char const short_id, std::string const & long_id)
+    {
+        if (fallback_arguments.empty())
+            return false;
+
+        return from_fallback_arguments(
+            [this, short_id, &long_id]()
+            {
+                return flag_is_set(short_id) || flag_is_set(long_id);
+            });
+    }
+
+    /*!\brief Appends format_parse::fallback_positional_arguments to the arguments if no positional argument is left.
+     * \details
+     * Called after all options and flags were removed from the arguments. The position of the values is recorded as
+     * sharg::diagnostic::npos.
+     */
+    void use_fallback_positional_arguments()
+    {
+        if (fallback_positional_arguments.empty() || std::ranges::any_of(arguments,
+                                                                         [](std::string_view const s)
+                                                                         {
+                                                                             return s != "";
+                                                                         }))
+        {
+            return;
+        }
+
+        if (argument_indices.empty())
+        {
+            argument_indices.resize(arguments.size());
+            std::iota(argument_indices.begin(), argument_indices.end(), size_t{});
+        }
+
+        arguments.insert(arguments.end(), fallback_positional_arguments.begin(), fallback_positional_arguments.end());
+        argument_indices.resize(arguments.size(), diagnostic::npos);
+        end_of_options_it = arguments.end(); // The iterator was invalidated; -- was already removed.
     }
 
     /*!\brief Handles command line positional option retrieval.
@@ -725,11 +1368,6 @@ private:
      * \param[out] value     The variable in which to store the given command line argument.
      * \param[in]  validator The validator applied to the value after parsing (callable).
      *
-     * \throws sharg::parser_error
-     * \throws sharg::too_few_arguments
-     * \throws sharg::validation_error
-     * \throws sharg::design_error
-     *
      * \details
      *
      * This function assumes that
@@ -739,8 +1377,9 @@ private:
      *  Thus we can simply iterate over non empty entries of arguments.
      *
      * This function
-     * - checks if the user did not provide enough arguments,
+     * - checks if the user did not provide enough arguments (reported only once),
      * - retrieves the next (no container type) or all (container type) remaining non empty value/s in arguments
+     * - validates the value/s if they could be parsed.
      */
     template <typename option_type, typename validator_type>
     void get_positional_option(option_type & value, validator_type && validator)
@@ -748,71 +1387,131 @@ private:
         ++positional_option_count;
         auto it = std::find_if(arguments.begin(),
                                arguments.end(),
-                               [](std::string const & s)
+                               [](std::string_view const s)
                                {
                                    return (s != "");
                                });
 
         if (it == arguments.end())
-            throw too_few_arguments("Not enough positional arguments provided (Need at least "
-                                    + std::to_string(positional_option_calls.size())
-                                    + "). See -h/--help for more information.");
+        {
+            if (!positional_arguments_missing)
+            {
+                positional_arguments_missing = true;
+                add_diagnostic(diagnostic_kind::too_few_arguments,
+                               {},
+                               diagnostic::npos,
+                               {},
+                               [](diagnostic const &, std::string const & required_count)
+                               {
+                                   return "Not enough positional arguments provided (Need at least " + required_count
+                                        + "). See -h/--help for more information.";
+                               },
+                               std::to_string(positional_option_total));
+            }
+            return;
+        }
+
+        size_t const diagnostic_count = diagnostics.size();
+        size_t value_index{};
 
         if constexpr (detail::is_container_option<
                           option_type>) // vector/list will be filled with all remaining arguments
         {
-            assert(positional_option_count == positional_option_calls.size()); // checked on set up.
+            assert(positional_option_count == positional_option_total); // checked on set up.
 
-            value.clear();
+            unsigned const list_position = positional_option_count;
+            prepare_container(value,
+                              std::ranges::count_if(it,
+                                                    arguments.end(),
+                                                    [](std::string_view const s)
+                                                    {
+                                                        return (s != "");
+                                                    }));
 
             while (it != arguments.end())
             {
+                value_index = argument_index(it);
                 auto res = parse_option_value(value, *it);
-                std::string id = "positional option" + std::to_string(positional_option_count);
-                throw_on_input_error<option_type>(res, id, *it);
+                if (res != option_parse_result::success)
+                    report_input_error<option_type>(res, positional_option_name(), *it, value_index);
 
                 *it = ""; // remove arg from arguments
                 it = std::find_if(it,
                                   arguments.end(),
-                                  [](std::string const & s)
+                                  [](std::string_view const s)
                                   {
                                       return (s != "");
                                   });
                 ++positional_option_count;
             }
+
+            if (diagnostics.size() == diagnostic_count)
+                check_fixed_size<option_type>(positional_option_name(list_position), value_index);
         }
         else
         {
+            value_index = argument_index(it);
             auto res = parse_option_value(value, *it);
-            std::string id = "positional option" + std::to_string(positional_option_count);
-            throw_on_input_error<option_type>(res, id, *it);
+            if (res != option_parse_result::success)
+                report_input_error<option_type>(res, positional_option_name(), *it, value_index);
 
             *it = ""; // remove arg from arguments
         }
 
+        if (diagnostics.size() != diagnostic_count)
+            return;
+
         try
         {
             validator(value);
         }
         catch (std::exception & ex)
         {
-            throw validation_error("Validation failed for positional option " + std::to_string(positional_option_count)
-                                   + ": " + ex.what());
+            add_diagnostic(diagnostic_kind::validation_error,
+                           positional_option_name(),
+                           value_index,
+                           {},
+                           [](diagnostic const & d, std::string const & what)
+                           {
+                               return "Validation failed for " + d.option_id + ": " + what;
+                           },
+                           ex.what());
         }
     }
 
+    //!\brief Vector of command line arguments. Declared first, because its allocator is used by the other members.
+    argument_list arguments;
+    //!\brief The index in `argv` of each of the format_parse::arguments; empty if they are the same.
+    std::pmr::vector<size_t> argument_indices;
+    //!\brief The option values from the environment and a configuration file. See format_parse::set_fallback_arguments.
+    argument_list fallback_arguments{arguments.get_allocator()};
+    //!\brief The "index in `argv`" of each of the format_parse::fallback_arguments, i.e. sharg::diagnostic::npos.
+    std::pmr::vector<size_t> fallback_argument_indices{arguments.get_allocator()};
+    //!\brief The positional values from a parameter file. See format_parse::set_fallback_positional_arguments.
+    argument_list fallback_positional_arguments{arguments.get_allocator()};
     //!\brief Stores get_option calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> option_calls;
+    std::pmr::vector<pmr_function<void()>> option_calls{arguments.get_allocator()};
     //!\brief Stores get_flag calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> flag_calls;
+    std::pmr::vector<pmr_function<void()>> flag_calls{arguments.get_allocator()};
     //!\brief Stores get_positional_option calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> positional_option_calls;
+    std::pmr::vector<pmr_function<void()>> positional_option_calls{arguments.get_allocator()};
     //!\brief Keeps track of the number of specified positional options.
     unsigned positional_option_count{0};
-    //!\brief Vector of command line arguments.
-    std::vector<std::string> arguments;
+    //!\brief The number of positional options that are parsed.
+    size_t positional_option_total{0};
+    //!\brief Whether too few positional arguments were already reported.
+    bool positional_arguments_missing{false};
+    //!\brief The index in `argv` of the last option value that was retrieved.
+    size_t last_value_index{diagnostic::npos};
+    //!\brief The number of values given for the container option that is currently parsed.
+    size_t stored_value_count{};
+    //!\brief The diagnostics recorded while parsing.
+    std::vector<diagnostic> diagnostics;
     //!\brief Artificial end of arguments if \-- was seen.
-    std::vector<std::string>::iterator end_of_options_it;
+    argument_list::iterator end_of_options_it;
+    //!\brief The positions in `argv` of every option and flag identifier (without dashes) that was found.
+    std::pmr::unordered_map<std::pmr::string, std::pmr::vector<size_t>, string_view_hash, string_view_equal>
+        identifier_positions{arguments.get_allocator().resource()};
 };
 
 } // namespace sharg::detail
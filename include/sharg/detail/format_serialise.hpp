@@ -0,0 +1,516 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the format_serialise class.
+ */
+
+#pragma once
+
+#include <bit>
+#include <filesystem>
+#include <limits>
+#include <sstream>
+
+#include <sharg/detail/format_parse.hpp>
+#include <sharg/enumeration_names.hpp>
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Whether the type provides sharg::custom::parsing::serialise and sharg::custom::parsing::deserialise.
+ * \ingroup parser
+ * \noapi
+ */
+template <typename value_t>
+concept custom_serialisable = requires (std::string & blob, std::string_view const bytes, value_t & value) {
+    sharg::custom::parsing<value_t>::serialise(blob, std::as_const(value));
+    sharg::custom::parsing<value_t>::deserialise(bytes, value);
+};
+
+/*!\brief The format that writes the parsed option values into a binary blob or restores them from it.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * This format is used by sharg::parser::serialise and sharg::parser::deserialise. Both replay the add_option,
+ * add_flag and add_positional_option calls of the parser on this format, which immediately writes or reads the value.
+ *
+ * ### Layout (version 1)
+ *
+ * Sizes and counts are stored as LEB128, integers and IEEE 754 floating point values as little endian.
+ *
+ * * Header: `SHRG`, the format version, the application name and the application version.
+ * * One record per option, flag or positional option, in the order they were added:
+ *   * The kind (`o`ption, `f`lag, `p`ositional option), the short identifier and the long identifier.
+ *   * The type name and the help page message of the validator. A parser that restores the blob must have been set up
+ *     with the same options; the validators are not run again.
+ *   * For options and flags, the positions of the short and the long identifier in `argv`.
+ *   * The value. Containers store their size followed by their elements.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class format_serialise : public format_base
+{
+public:
+    //!\brief The first bytes of every blob.
+    static constexpr std::string_view magic{"SHRG"};
+
+    //!\brief The version of the layout.
+    static constexpr uint64_t version{1u};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    format_serialise() = delete;                                      //!< Deleted.
+    format_serialise(format_serialise const &) = default;             //!< Defaulted.
+    format_serialise & operator=(format_serialise const &) = default; //!< Defaulted.
+    format_serialise(format_serialise &&) = default;                  //!< Defaulted.
+    format_serialise & operator=(format_serialise &&) = default;      //!< Defaulted.
+    ~format_serialise() = default;                                    //!< Defaulted.
+
+    /*!\brief Prepares writing the values that were parsed by `parsed`.
+     * \param[in] parsed The format that parsed the command line; provides the positions of the identifiers.
+     * \param[in] meta The meta data of the parser.
+     */
+    format_serialise(format_parse const & parsed, parser_meta_data const & meta) : parsed{&parsed}
+    {
+        blob.append(magic);
+        write_size(version);
+        write(meta.app_name);
+        write(meta.version);
+    }
+
+    /*!\brief Prepares restoring values from `serialised`.
+     * \param[in] serialised The blob created by sharg::parser::serialise.
+     * \param[in] meta The meta data of the parser.
+     * \param[in, out] restored The format that receives the positions of the identifiers.
+     * \throws sharg::deserialisation_error if the blob is corrupt or was created by another application or version.
+     */
+    format_serialise(std::string_view const serialised, parser_meta_data const & meta, format_parse & restored) :
+        input{serialised},
+        restored{&restored}
+    {
+        if (take(magic.size()) != magic)
+            throw deserialisation_error{"The serialised parser state is corrupt."};
+
+        if (read_size() != version)
+            throw deserialisation_error{"The serialised parser state has an unsupported version."};
+
+        std::string app_name{};
+        std::string app_version{};
+        read(app_name);
+        read(app_version);
+
+        if (app_name != meta.app_name || app_version != meta.version)
+        {
+            throw deserialisation_error{"The serialised parser state was created by " + app_name + " " + app_version
+                                        + " and cannot be restored by " + meta.app_name + " " + meta.version + "."};
+        }
+    }
+    //!\}
+
+    //!\brief Writes or restores the value of an option. See sharg::parser::add_option.
+    template <typename option_type, typename validator_t>
+    void add_option(option_type & value, config<validator_t> const & config)
+    {
+        process('o', value, config.short_id, config.long_id, config.validator);
+    }
+
+    //!\brief Writes or restores the value of an option; the default value has already been assigned by parsing.
+    template <typename option_type, typename validator_t, typename default_provider_t>
+    void add_option(option_type & value, config<validator_t> const & config, default_provider_t const &)
+    {
+        add_option(value, config);
+    }
+
+    //!\brief Writes or restores the value of a flag. See sharg::parser::add_flag.
+    template <typename validator_t>
+    void add_flag(bool & value, config<validator_t> const & config)
+    {
+        process('f', value, config.short_id, config.long_id, config.validator);
+    }
+
+    //!\brief Writes or restores the value of a positional option. See sharg::parser::add_positional_option.
+    template <typename option_type, typename validator_t>
+    void add_positional_option(option_type & value, config<validator_t> const & config)
+    {
+        process('p', value, '\0', std::string{}, config.validator);
+    }
+
+    /*!\brief Returns the blob after all options were written.
+     * \throws sharg::deserialisation_error if values are left after all options were restored.
+     */
+    std::string finish()
+    {
+        if (restored != nullptr && !input.empty())
+            throw deserialisation_error{"The serialised parser state contains more options than this parser."};
+
+        return std::move(blob);
+    }
+
+    // functions are not needed for serialisation but are part of the format interface.
+    //!\cond
+    void parse(parser_meta_data const &)
+    {}
+    void add_section(std::string const &, bool const)
+    {}
+    void add_subsection(std::string const &, bool const)
+    {}
+    void add_line(std::string const &, bool, bool const)
+    {}
+    void add_list_item(std::string const &, std::string const &, bool const)
+    {}
+    //!\endcond
+
+private:
+    /*!\brief Writes or restores the record of an option, flag or positional option.
+     * \param[in] kind `o` for options, `f` for flags, and `p` for positional options.
+     * \param[in, out] value The value to write or restore.
+     * \param[in] short_id The short identifier.
+     * \param[in] long_id The long identifier.
+     * \param[in] validator The validator of the option; only its help page message is stored.
+     */
+    template <typename option_type, typename validator_t>
+    void process(char const kind,
+                 option_type & value,
+                 char const short_id,
+                 std::string const & long_id,
+                 validator_t const & validator)
+    {
+        std::string type_name = get_type_name_as_string(value);
+
+        if constexpr (detail::is_container_option<option_type>)
+            type_name = "List of " + type_name;
+
+        std::string const validator_message = validator.get_help_page_message();
+
+        if (restored == nullptr)
+        {
+            blob.push_back(kind);
+            blob.push_back(short_id);
+            write(long_id);
+            write(type_name);
+            write(validator_message);
+
+            if (kind != 'p')
+            {
+                write_positions(std::string_view{&short_id, 1u});
+                write_positions(long_id);
+            }
+
+            write(value);
+        }
+        else
+        {
+            std::string stored_long_id{};
+            std::string stored_type_name{};
+            std::string stored_validator_message{};
+            std::string_view const stored_ids = take(2u);
+            read(stored_long_id);
+            read(stored_type_name);
+            read(stored_validator_message);
+
+            if (stored_ids[0] != kind || stored_ids[1] != short_id || stored_long_id != long_id
+                || stored_type_name != type_name || stored_validator_message != validator_message)
+            {
+                throw deserialisation_error{"The serialised parser state does not match the options of this "
+                                            "parser."};
+            }
+
+            if (kind != 'p')
+            {
+                read_positions(std::string_view{&short_id, 1u});
+                read_positions(long_id);
+            }
+
+            read(value);
+        }
+    }
+
+    //!\brief Writes the positions of the identifier `id` in `argv`.
+    void write_positions(std::string_view const id)
+    {
+        std::span<size_t const> const positions = parsed->positions(id);
+        write_size(positions.size());
+
+        for (size_t const position : positions)
+            write_size(position);
+    }
+
+    //!\brief Reads the positions of the identifier `id` in `argv` and passes them to format_serialise::restored.
+    void read_positions(std::string_view const id)
+    {
+        std::vector<size_t> positions(read_size());
+
+        for (size_t & position : positions)
+            position = read_size();
+
+        if (!positions.empty())
+            restored->restore_positions(id, positions);
+    }
+
+    //!\brief Appends an unsigned integer in LEB128 encoding, i.e. 7 bits per byte, least significant first.
+    void write_size(uint64_t value)
+    {
+        for (; value >= 0x80u; value >>= 7)
+            blob.push_back(static_cast<char>((value & 0x7Fu) | 0x80u));
+
+        blob.push_back(static_cast<char>(value));
+    }
+
+    //!\brief Reads an unsigned integer in LEB128 encoding.
+    uint64_t read_size()
+    {
+        uint64_t value{};
+
+        for (unsigned shift = 0u; shift < 64u; shift += 7u)
+        {
+            uint8_t const byte = static_cast<uint8_t>(take(1u)[0]);
+            value |= static_cast<uint64_t>(byte & 0x7Fu) << shift;
+
+            if ((byte & 0x80u) == 0u)
+                return value;
+        }
+
+        throw deserialisation_error{"The serialised parser state is corrupt."};
+    }
+
+    //!\brief Appends an unsigned integer in little endian byte order.
+    template <std::unsigned_integral uint_t>
+    void write_fixed(uint_t const value)
+    {
+        for (size_t i = 0; i < sizeof(uint_t); ++i)
+            blob.push_back(static_cast<char>(static_cast<uint64_t>(value) >> (8u * i)));
+    }
+
+    //!\brief Reads an unsigned integer in little endian byte order.
+    template <std::unsigned_integral uint_t>
+    uint_t read_fixed()
+    {
+        std::string_view const bytes = take(sizeof(uint_t));
+        uint64_t value{};
+
+        for (size_t i = 0; i < sizeof(uint_t); ++i)
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(bytes[i])) << (8u * i);
+
+        return static_cast<uint_t>(value);
+    }
+
+    //!\brief Removes and returns the next `count` bytes of the input.
+    std::string_view take(size_t const count)
+    {
+        if (input.size() < count)
+            throw deserialisation_error{"The serialised parser state is corrupt."};
+
+        std::string_view const bytes = input.substr(0u, count);
+        input.remove_prefix(count);
+        return bytes;
+    }
+
+    /*!\brief Appends a value.
+     * \details
+     *
+     * In order of precedence:
+     * * sharg::custom::parsing::serialise, stored with its size.
+     * * Arithmetic types; floating point types other than IEEE 754 float and double are stored as raw bytes.
+     * * Enumerations, as their underlying type.
+     * * std::string and std::filesystem::path, stored with their size.
+     * * Containers (sharg::detail::is_container_option), stored with their size.
+     * * Other sharg::named_enumeration, as their name.
+     * * All other types, as the text written by their stream operator. When restoring, the stream operator must read
+     *   the whole text, as it must when parsing the command line.
+     */
+    template <typename value_t>
+    void write(value_t const & value)
+    {
+        if constexpr (custom_serialisable<value_t>)
+        {
+            std::string bytes{};
+            sharg::custom::parsing<value_t>::serialise(bytes, value);
+            write(bytes);
+        }
+        else if constexpr (std::same_as<value_t, bool>)
+        {
+            write_fixed(static_cast<uint8_t>(value));
+        }
+        else if constexpr (std::integral<value_t>)
+        {
+            write_fixed(static_cast<std::make_unsigned_t<value_t>>(value));
+        }
+        else if constexpr (std::floating_point<value_t> && std::numeric_limits<value_t>::is_iec559
+                           && (sizeof(value_t) == 4u || sizeof(value_t) == 8u))
+        {
+            using uint_t = std::conditional_t<sizeof(value_t) == 4u, uint32_t, uint64_t>;
+            write_fixed(std::bit_cast<uint_t>(value));
+        }
+        else if constexpr (std::floating_point<value_t>)
+        {
+            blob.append(reinterpret_cast<char const *>(&value), sizeof(value_t));
+        }
+        else if constexpr (std::is_enum_v<value_t>)
+        {
+            write(static_cast<std::underlying_type_t<value_t>>(value));
+        }
+        else if constexpr (std::same_as<value_t, std::string>)
+        {
+            write_size(value.size());
+            blob.append(value);
+        }
+        else if constexpr (std::same_as<value_t, std::filesystem::path>)
+        {
+            write(value.string());
+        }
+        else if constexpr (detail::is_container_option<value_t>)
+        {
+            using element_t = std::ranges::range_value_t<value_t>;
+            write_size(std::ranges::distance(value));
+
+            // The cast turns proxies, e.g. of std::vector<bool>, into a value.
+            for (auto && element : value)
+                write(static_cast<element_t const &>(element));
+        }
+        else if constexpr (named_enumeration<value_t>)
+        {
+            for (auto && [name, enum_value] : sharg::enumeration_names<value_t>)
+            {
+                if (enum_value == value)
+                    return write(std::string{name});
+            }
+
+            throw design_error{"A value of a named enumeration without a name cannot be serialised."};
+        }
+        else
+        {
+            std::ostringstream stream{};
+            stream << value;
+            write(stream.str());
+        }
+    }
+
+    //!\brief Reads a value that was written by format_serialise::write.
+    template <typename value_t>
+    void read(value_t & value)
+    {
+        if constexpr (custom_serialisable<value_t>)
+        {
+            sharg::custom::parsing<value_t>::deserialise(take(read_size()), value);
+        }
+        else if constexpr (std::same_as<value_t, bool>)
+        {
+            uint8_t const byte = read_fixed<uint8_t>();
+
+            if (byte > 1u)
+                throw deserialisation_error{"The serialised parser state is corrupt."};
+
+            value = byte == 1u;
+        }
+        else if constexpr (std::integral<value_t>)
+        {
+            value = static_cast<value_t>(read_fixed<std::make_unsigned_t<value_t>>());
+        }
+        else if constexpr (std::floating_point<value_t> && std::numeric_limits<value_t>::is_iec559
+                           && (sizeof(value_t) == 4u || sizeof(value_t) == 8u))
+        {
+            using uint_t = std::conditional_t<sizeof(value_t) == 4u, uint32_t, uint64_t>;
+            value = std::bit_cast<value_t>(read_fixed<uint_t>());
+        }
+        else if constexpr (std::floating_point<value_t>)
+        {
+            std::ranges::copy(take(sizeof(value_t)), reinterpret_cast<char *>(&value));
+        }
+        else if constexpr (std::is_enum_v<value_t>)
+        {
+            std::underlying_type_t<value_t> underlying{};
+            read(underlying);
+            value = static_cast<value_t>(underlying);
+        }
+        else if constexpr (std::same_as<value_t, std::string>)
+        {
+            value = take(read_size());
+        }
+        else if constexpr (std::same_as<value_t, std::filesystem::path>)
+        {
+            value = std::filesystem::path{take(read_size())};
+        }
+        else if constexpr (detail::is_fixed_size_container_option<value_t>)
+        {
+            if (read_size() != std::tuple_size_v<value_t>)
+                throw deserialisation_error{"The serialised parser state is corrupt."};
+
+            for (auto & element : value)
+                read(element);
+        }
+        else if constexpr (detail::is_container_option<value_t>)
+        {
+            size_t const size = read_size();
+            value.clear();
+
+            if constexpr (requires { value.reserve(size); })
+                value.reserve(std::min<size_t>(size, input.size())); // Every element needs at least one byte.
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                typename value_t::value_type element{};
+                read(element);
+
+                if constexpr (requires { value.push_back(std::move(element)); })
+                    value.push_back(std::move(element));
+                else
+                    value.insert(std::move(element));
+            }
+        }
+        else if constexpr (named_enumeration<value_t>)
+        {
+            std::string_view const name = take(read_size());
+
+            for (auto && [key, enum_value] : sharg::enumeration_names<value_t>)
+            {
+                if (key == name)
+                {
+                    value = enum_value;
+                    return;
+                }
+            }
+
+            throw deserialisation_error{"The serialised parser state is corrupt."};
+        }
+        else
+        {
+            std::string_view const text = take(read_size());
+
+            // An empty text, e.g. of a default constructed value, cannot be read by most stream operators.
+            if constexpr (std::default_initializable<value_t>)
+            {
+                if (text.empty())
+                {
+                    value = value_t{};
+                    return;
+                }
+            }
+
+            // Like format_parse, the whole text must be consumed; otherwise, e.g. a text with spaces was truncated.
+            std::istringstream stream{std::string{text}};
+            stream >> value;
+
+            if (stream.fail() || !stream.eof())
+            {
+                throw deserialisation_error{"The serialised value \"" + std::string{text} + "\" of type "
+                                            + get_type_name_as_string(value) + " cannot be read completely."};
+            }
+        }
+    }
+
+    //!\brief The blob that is written.
+    std::string blob{};
+    //!\brief The remaining input when restoring.
+    std::string_view input{};
+    //!\brief The format that parsed the command line; set when writing.
+    format_parse const * parsed{nullptr};
+    //!\brief The format that receives the restored positions; set when restoring.
+    format_parse * restored{nullptr};
+};
+
+} // namespace sharg::detail
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <sharg/platform.hpp>
+
 #if !SHARG_HAS_TDL
 
 #    include <sharg/detail/format_help.hpp>
@@ -39,9 +41,7 @@ public:
 
     void parse(parser_meta_data &, std::vector<std::string> const &)
     {
-        throw validation_error{"Validation failed for option --export-help: "
-                               "Value must be one of "
-                               + detail::supported_exports + "."};
+        throw validation_error{detail::unavailable_export_message(fileFormat == FileFormat::CTD ? "ctd" : "cwl")};
     }
 
     FileFormat fileFormat;
@@ -50,8 +50,12 @@ public:
 } // namespace sharg::detail
 
 #else
+#    include <algorithm>
+#    include <cctype>
 #    include <concepts>
 #    include <numeric>
+#    include <stdexcept>
+#    include <string_view>
 
 #    include <sharg/detail/format_base.hpp>
 #    include <sharg/validators.hpp>
@@ -88,12 +92,155 @@ inline auto to_tdl(std::string const & v)
     return tdl::StringValue(v);
 }
 
+/*!\copydetails sharg::detail::to_tdl
+ * \details
+ * The names of the values of a sharg::flag_set are exported as a list, i.e. a multi-select parameter.
+ */
+template <typename enum_t>
+auto to_tdl(flag_set<enum_t> const & v)
+{
+    tdl::StringValueList names{};
+    for (enum_t const value : v)
+        names.emplace_back(detail::find_enumeration_name(value));
+    return names;
+}
+
 //!\copydetails sharg::detail::to_tdl
 auto to_tdl(auto SHARG_DOXYGEN_ONLY(v))
 {
     return tdl::BoolValue(false);
 }
 
+//!\brief The requirements of a CWL document; the class of each requirement and its entries, e.g. `coresMin: 4`.
+using cwl_requirements = std::vector<std::pair<std::string, std::vector<std::pair<std::string, std::string>>>>;
+
+/*!\brief Merges requirements into the top-level `requirements` of a CWL document.
+ * \param[in] document The CWL document in YAML block notation, as returned by tdl::convertToCWL.
+ * \param[in] requirements The requirements to add.
+ * \returns The document, ending in a line break, with the requirements.
+ * \throws std::runtime_error if the existing `requirements` are a non-empty flow collection.
+ *
+ * \details
+ *
+ * If the document has no `requirements` yet, they are appended as a mapping by class name. Otherwise, the requirements
+ * are added to the end of the existing block in its notation, i.e. a mapping by class name or a sequence of objects
+ * with a `class` entry. A requirement whose class is already listed is skipped, such that no key is duplicated.
+ */
+inline std::string merge_cwl_requirements(std::string_view const document, cwl_requirements const & requirements)
+{
+    std::vector<std::string_view> lines{};
+    for (size_t begin{}; begin < document.size();)
+    {
+        size_t const end = std::min(document.find('\n', begin), document.size());
+        lines.push_back(document.substr(begin, end - begin));
+        begin = end + 1;
+    }
+
+    auto is_block_line = [](std::string_view const line)
+    {
+        return line.empty() || line.starts_with(' ') || line == "-" || line.starts_with("- ");
+    };
+    auto indentation_of = [](std::string_view const line)
+    {
+        return std::min(line.find_first_not_of(' '), line.size());
+    };
+    auto unquote = [](std::string_view value)
+    {
+        value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+        value.remove_suffix(value.size() - std::min(value.find_last_not_of(' ') + 1, value.size()));
+        if (value.size() >= 2u && (value.front() == '"' || value.front() == '\'') && value.back() == value.front())
+            value = value.substr(1u, value.size() - 2u);
+        return value;
+    };
+
+    auto is_key = [](std::string_view const line)
+    {
+        return line == "requirements:" || line.starts_with("requirements: ");
+    };
+    size_t const key = std::ranges::find_if(lines, is_key) - lines.begin();
+    size_t insert_at = lines.size();
+    std::string indentation(2u, ' ');
+    bool as_sequence{false};
+    std::vector<std::string_view> listed{};
+
+    if (key < lines.size())
+    {
+        std::string_view const flow_value = unquote(lines[key].substr(std::string_view{"requirements:"}.size()));
+        size_t const first = key + 1u;
+        size_t last = first;
+        while (last < lines.size() && is_block_line(lines[last]))
+            ++last;
+        while (last > first && lines[last - 1u].find_first_not_of(' ') == std::string_view::npos)
+            --last;
+        insert_at = last;
+
+        if (flow_value == "[]" || flow_value == "{}")
+            as_sequence = flow_value == "[]";
+        else if (!flow_value.empty())
+            throw std::runtime_error("The requirements of the CWL document cannot be merged (this is a bug).");
+        else if (first < last)
+        {
+            size_t const indent = indentation_of(lines[first]);
+            std::string_view const first_entry = lines[first].substr(indent);
+            indentation.assign(indent, ' ');
+            as_sequence = first_entry == "-" || first_entry.starts_with("- ");
+
+            // Only the entries of the requirements themselves are considered, not those nested in them.
+            for (size_t i = first; i < last; ++i)
+            {
+                size_t const line_indent = indentation_of(lines[i]);
+                std::string_view entry = lines[i].substr(line_indent);
+
+                if (as_sequence)
+                {
+                    if (line_indent == indent && entry.starts_with("- "))
+                        entry = unquote(entry.substr(2u));
+                    else if (line_indent != indent + 2u)
+                        continue;
+
+                    if (entry.starts_with("class:"))
+                        listed.push_back(unquote(entry.substr(std::string_view{"class:"}.size())));
+                }
+                else if (line_indent == indent && entry.find(':') != std::string_view::npos)
+                {
+                    listed.push_back(unquote(entry.substr(0u, entry.find(':'))));
+                }
+            }
+        }
+    }
+
+    std::string added{};
+    for (auto const & [name, entries] : requirements)
+    {
+        if (std::ranges::find(listed, name) != listed.end())
+            continue;
+
+        if (as_sequence)
+            added += indentation + "- class: " + name + '\n';
+        else
+            added += indentation + name + (entries.empty() ? ": {}\n" : ":\n");
+
+        for (auto const & [entry_key, value] : entries)
+            added += indentation + "  " + entry_key + ": " + value + '\n';
+    }
+
+    std::string merged{};
+    for (size_t i{}; i < lines.size(); ++i)
+    {
+        if (i == insert_at)
+            merged += added;
+        merged += (i == key) ? std::string_view{"requirements:"} : lines[i];
+        merged += '\n';
+    }
+
+    if (key == lines.size())
+        merged += "requirements:\n";
+    if (insert_at == lines.size())
+        merged += added;
+
+    return merged;
+}
+
 /*!\brief A generalized format to create different tool description files.
  * \ingroup parser
  *
@@ -105,6 +252,8 @@ auto to_tdl(auto SHARG_DOXYGEN_ONLY(v))
 class format_tdl : format_base
 {
 public:
+    using format_base::default_message_element_limit;
+
     //!\brief Supported tool description file formats.
     enum class FileFormat
     {
@@ -128,6 +277,12 @@ public:
     //!\brief Targeted tool description format
     FileFormat fileFormat;
 
+    //!\brief The entries of the CWL `ResourceRequirement`, e.g. `coresMin` and its value. See sharg::config::resource.
+    std::vector<std::pair<std::string, std::string>> resource_requirements;
+
+    //!\brief Whether a value in format_tdl::resource_requirements is a JavaScript expression.
+    bool resource_requirements_use_javascript{false};
+
     /*!\brief Stores all meta information about the application
      *
      * \details
@@ -144,6 +299,9 @@ public:
      */
     parser_meta_data meta;
 
+    //!\brief The stream the tool description is printed to. See sharg::parser::parse(std::ostream &).
+    std::ostream * output_stream{&std::cout};
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -160,6 +318,18 @@ public:
     format_tdl & operator=(format_tdl &&) = default;      //!< Defaulted.
     ~format_tdl() = default;                              //!< Defaulted.
 
+    /*!\brief Adds the option with the default value returned by `default_provider`.
+     * \copydetails sharg::parser::add_option(option_type &, config<validator_type>, default_provider_type)
+     */
+    template <typename option_type, typename validator_t, typename default_provider_t>
+    void add_option(option_type & SHARG_DOXYGEN_ONLY(value),
+                    config<validator_t> const & config,
+                    default_provider_t const & default_provider)
+    {
+        option_type default_value = std::invoke(default_provider);
+        add_option(default_value, config);
+    }
+
     /*!\brief Adds a sharg::print_list_item call to be evaluated later on.
      * \copydetails sharg::parser::add_option
      */
@@ -185,6 +355,13 @@ public:
         {
             tags.insert("advanced");
         }
+        if (config.resource != resource_kind::none)
+        {
+            tags.insert(std::string{resource_name(config.resource)});
+
+            if constexpr (std::integral<option_type>)
+                add_resource_requirement(value, config);
+        }
         if constexpr (std::same_as<std::filesystem::path, option_type>)
         {
             auto valueAsStr = to_string(value);
@@ -267,7 +444,7 @@ public:
     void add_positional_option(option_type & value, config<validator_t> const & config)
     {
         // a list at the end may be empty and thus have a default value
-        auto positional_default_message = [&value]() -> std::string
+        auto positional_default_message = [this, &value]() -> std::string
         {
             if constexpr (detail::is_container_option<option_type>)
             {
@@ -324,11 +501,11 @@ public:
         meta = parser_meta;
 
         // each call will evaluate the function print_list_item()
-        for (auto f : positional_option_calls)
+        for (auto & f : positional_option_calls)
             f(meta.app_name);
 
         // each call will evaluate the function print_list_item()
-        for (auto f : parser_set_up_calls)
+        for (auto & f : parser_set_up_calls)
             f(meta.app_name);
 
         info.metaInfo = tdl::MetaInfo{
@@ -349,29 +526,43 @@ public:
         {
             info.metaInfo.executableName = executable_name[0];
         }
+        // Nest the parameters in one node per subcommand level, e.g. [raptor, build] -> build: {parameters}.
+        // The children are moved; an initializer list would copy the whole tree on every level.
         for (size_t i{1}; i < executable_name.size(); ++i)
         {
-            parameters = {tdl::Node{
+            tdl::Node node{
                 .name = executable_name[executable_name.size() - i],
                 .tags = {"basecommand"},
-                .value = parameters,
-            }};
+                .value = std::move(parameters),
+            };
+            parameters.clear();
+            parameters.push_back(std::move(node));
         }
         info.params = std::move(parameters);
 
         if (fileFormat == FileFormat::CTD)
         {
-            std::cout << tdl::convertToCTD(info);
+            *output_stream << tdl::convertToCTD(info);
         }
         else if (fileFormat == FileFormat::CWL)
         {
-            std::cout << tdl::convertToCWL(info) << "\n";
+            if (resource_requirements.empty())
+            {
+                *output_stream << tdl::convertToCWL(info) << "\n";
+                return;
+            }
+
+            cwl_requirements requirements{};
+            if (resource_requirements_use_javascript)
+                requirements.push_back({"InlineJavascriptRequirement", {}});
+            requirements.emplace_back("ResourceRequirement", resource_requirements);
+
+            *output_stream << merge_cwl_requirements(tdl::convertToCWL(info), requirements);
         }
         else
         {
             throw std::runtime_error("unsupported file format (this is a bug)");
         }
-        std::exit(EXIT_SUCCESS); // program should not continue from here
     }
 
     /*!\brief Adds a print_section call to parser_set_up_calls.
@@ -403,6 +594,47 @@ public:
     {}
 
 private:
+    /*!\brief Adds the `coresMin` or `ramMin` entry of the CWL `ResourceRequirement` for an option.
+     * \param[in] value The default value of the option.
+     * \param[in] config The configuration of the option; sharg::config::resource is set.
+     *
+     * \details
+     *
+     * The entry refers to the input of the option. If the option is optional, its default value is used when the input
+     * is `null`. The memory budget in GiB is converted to MiB. Both need a JavaScript expression.
+     * Hidden options are not inputs of the tool, hence their default value is used directly.
+     */
+    template <typename option_type, typename validator_t>
+    void add_resource_requirement(option_type const value, config<validator_t> const & config)
+    {
+        bool const in_gib = config.resource == resource_kind::memory_gib;
+        std::string const key = (config.resource == resource_kind::threads) ? "coresMin" : "ramMin";
+
+        if (config.hidden || config.long_id.empty())
+        {
+            int64_t const default_value = static_cast<int64_t>(value) * (in_gib ? 1024 : 1);
+            resource_requirements.emplace_back(key, std::to_string(default_value));
+            return;
+        }
+
+        // A CWL parameter reference: inputs.threads, or inputs['max-memory'] for names that are no JS identifiers.
+        auto is_identifier_char = [](char const c)
+        {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+        };
+        bool const is_identifier = std::ranges::all_of(config.long_id, is_identifier_char);
+        std::string const input = is_identifier ? "inputs." + config.long_id : "inputs['" + config.long_id + "']";
+        std::string expression = input;
+
+        if (!config.required)
+            expression = input + " === null ? " + std::to_string(value) + " : " + input;
+        if (in_gib)
+            expression = (config.required ? expression : "(" + expression + ")") + " * 1024";
+
+        resource_requirements_use_javascript |= expression != input;
+        resource_requirements.emplace_back(key, "\"$(" + expression + ")\"");
+    }
+
     /*!\brief Adds a function object to parser_set_up_calls **if** the annotation in `spec` does not prevent it.
      * \param[in] printer The invokable that, if added to `parser_set_up_calls`, prints information to the help page.
      * \param[in] config The option specification deciding whether to add the information to the help page.
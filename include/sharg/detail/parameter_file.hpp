@@ -0,0 +1,826 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::parameter_file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sharg/detail/config_file.hpp>
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Reads the parameter values of a CTD file or a CWL job file.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * This is the reverse direction of sharg::detail::format_tdl: The parameters have the names that the CTD and CWL
+ * exports use, i.e. the long identifier of an option or flag and `positional_<i>` for the i-th positional option.
+ * Parameters of subcommands are nested in a node (CTD) or mapping (CWL) named after the subcommand.
+ *
+ * The format is detected from the contents: A file starting with `<` is read as CTD (XML), any other file as CWL job
+ * file (YAML or JSON). Only the subset of XML and YAML that describes parameter values is supported:
+ *
+ * * CTD: `<NODE name="...">`, `<ITEM name="..." value="..."/>` and `<ITEMLIST name="..."><LISTITEM value="..."/>`.
+ *   All other elements and attributes are ignored.
+ * * CWL: Mappings, sequences and scalars in block or flow style, e.g. `threads: 4`, `names: [a, b]` or a block
+ *   sequence. `File` and `Directory` objects are read as their `path` (or `location`). Anchors, tags and multi-line
+ *   scalars are not supported.
+ */
+class parameter_file
+{
+public:
+    //!\brief A parameter and its values.
+    struct entry
+    {
+        std::vector<std::string> path;   //!< The names of the enclosing nodes, e.g. the subcommands.
+        std::string name;                //!< The name of the parameter.
+        std::vector<std::string> values; //!< The values; one value unless it is a list.
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parameter_file() = delete;                                   //!< Deleted.
+    parameter_file(parameter_file const &) = delete;             //!< Deleted.
+    parameter_file & operator=(parameter_file const &) = delete; //!< Deleted.
+    parameter_file(parameter_file &&) = delete;                  //!< Deleted.
+    parameter_file & operator=(parameter_file &&) = delete;      //!< Deleted.
+    ~parameter_file() = default;                                 //!< Defaulted.
+
+    /*!\brief Reads the parameter file at `path`.
+     * \param[in] path The path to the file.
+     * \throws sharg::validation_error if the file cannot be read.
+     * \throws sharg::user_input_error if the file contains a syntax error.
+     */
+    explicit parameter_file(std::filesystem::path const & path) : path{path}
+    {
+        mapped_file const file{path, "parameter file"};
+        text = file.contents();
+
+        std::string_view const trimmed = text.substr(std::min(text.find_first_not_of(" \t\r\n"), text.size()));
+
+        if (trimmed.starts_with('<'))
+            read_ctd();
+        else
+            read_cwl_job();
+
+        text = {}; // The mapping is released.
+    }
+    //!\}
+
+    //!\brief Returns the parameters in the order they appear in the file.
+    std::span<entry const> entries() const noexcept
+    {
+        return entries_;
+    }
+
+private:
+    //!\brief The path to the file.
+    std::filesystem::path path;
+    //!\brief The contents of the file while it is read.
+    std::string_view text{};
+    //!\brief The parameters.
+    std::vector<entry> entries_{};
+    //!\brief The number of YAML collections that enclose the value that is read.
+    size_t nesting_depth{};
+
+    //!\brief Deeper nested YAML collections are rejected instead of exhausting the stack.
+    static constexpr size_t max_nesting_depth{100u};
+
+    //!\brief Throws a sharg::user_input_error for a syntax error at `position` in the file.
+    [[noreturn]] void syntax_error(size_t const position, std::string_view const reason) const
+    {
+        size_t const line = std::ranges::count(text.substr(0u, std::min(position, text.size())), '\n') + 1u;
+        throw user_input_error{"Error in the parameter file \"" + path.string() + "\" in line " + std::to_string(line)
+                               + ": " + std::string{reason}};
+    }
+
+    /*!\name CTD
+     * \{
+     */
+    //!\brief Replaces the XML entities and character references of an attribute value.
+    std::string decode_xml(std::string_view const value, size_t const position) const
+    {
+        std::string decoded{};
+        decoded.reserve(value.size());
+
+        for (size_t i = 0u; i < value.size(); ++i)
+        {
+            if (value[i] != '&')
+            {
+                decoded += value[i];
+                continue;
+            }
+
+            size_t const end = value.find(';', i);
+            if (end == std::string_view::npos)
+                syntax_error(position, "Missing ';' after '&'.");
+
+            std::string_view const entity = value.substr(i + 1u, end - i - 1u);
+            i = end;
+
+            if (entity == "amp")
+                decoded += '&';
+            else if (entity == "lt")
+                decoded += '<';
+            else if (entity == "gt")
+                decoded += '>';
+            else if (entity == "quot")
+                decoded += '"';
+            else if (entity == "apos")
+                decoded += '\'';
+            else if (entity.starts_with('#'))
+                append_utf8(decoded, character_reference(entity.substr(1u), position));
+            else
+                syntax_error(position, "Unknown entity \"&" + std::string{entity} + ";\".");
+        }
+
+        return decoded;
+    }
+
+    //!\brief Returns the code point of a numeric character reference without `&#` and `;`.
+    uint32_t character_reference(std::string_view const reference, size_t const position) const
+    {
+        bool const is_hex = reference.starts_with('x');
+        std::string_view const digits = reference.substr(is_hex ? 1u : 0u);
+        uint32_t code_point{};
+        auto [ptr, error] = std::from_chars(digits.data(), digits.data() + digits.size(), code_point, is_hex ? 16 : 10);
+
+        if (digits.empty() || error != std::errc{} || ptr != digits.data() + digits.size() || code_point > 0x10FFFF)
+            syntax_error(position, "Invalid character reference \"&#" + std::string{reference} + ";\".");
+
+        return code_point;
+    }
+
+    //!\brief Appends `code_point` encoded as UTF-8.
+    static void append_utf8(std::string & out, uint32_t const code_point)
+    {
+        if (code_point < 0x80)
+        {
+            out += static_cast<char>(code_point);
+        }
+        else if (code_point < 0x800)
+        {
+            out += static_cast<char>(0xC0 | (code_point >> 6));
+            out += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else if (code_point < 0x10000)
+        {
+            out += static_cast<char>(0xE0 | (code_point >> 12));
+            out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else
+        {
+            out += static_cast<char>(0xF0 | (code_point >> 18));
+            out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+    }
+
+    //!\brief Returns the value of the attribute `name` of a start tag; `std::nullopt` if there is none.
+    std::optional<std::string> attribute(std::string_view tag, std::string_view const name, size_t const position) const
+    {
+        // tag is the part after the element name, e.g. ` name="threads" value="4" /`.
+        while (true)
+        {
+            tag = tag.substr(std::min(tag.find_first_not_of(" \t\r\n/"), tag.size()));
+            if (tag.empty())
+                return std::nullopt;
+
+            size_t const equals = tag.find('=');
+            if (equals == std::string_view::npos)
+                syntax_error(position, "Missing '=' after an attribute name.");
+
+            std::string_view const key = tag.substr(0u, tag.find_first_of(" \t\r\n="));
+            tag = tag.substr(tag.find_first_not_of(" \t\r\n", equals + 1u) == std::string_view::npos
+                                 ? tag.size()
+                                 : tag.find_first_not_of(" \t\r\n", equals + 1u));
+
+            if (tag.empty() || (tag.front() != '"' && tag.front() != '\''))
+                syntax_error(position, "Attribute values must be quoted.");
+
+            size_t const end = tag.find(tag.front(), 1u);
+            if (end == std::string_view::npos)
+                syntax_error(position, "Missing closing quote.");
+
+            if (key == name)
+                return decode_xml(tag.substr(1u, end - 1u), position);
+
+            tag.remove_prefix(end + 1u);
+        }
+    }
+
+    //!\brief Reads the ITEM and ITEMLIST elements of a CTD file.
+    void read_ctd()
+    {
+        std::vector<std::string> nodes{};
+        entry * list{nullptr};
+
+        for (size_t position = text.find('<'); position != std::string_view::npos; position = text.find('<', position))
+        {
+            std::string_view const rest = text.substr(position);
+            std::string_view end_marker{">"};
+
+            if (rest.starts_with("<!--"))
+                end_marker = "-->";
+            else if (rest.starts_with("<?"))
+                end_marker = "?>";
+            else if (rest.starts_with("<![CDATA["))
+                end_marker = "]]>";
+
+            size_t const end = rest.find(end_marker);
+            if (end == std::string_view::npos)
+                syntax_error(position, "Missing '" + std::string{end_marker} + "'.");
+
+            std::string_view const tag = rest.substr(1u, end - 1u);
+            bool const self_closing = tag.ends_with('/');
+            position += end + end_marker.size();
+
+            if (end_marker != ">" || tag.starts_with('!'))
+                continue;
+
+            if (tag.starts_with('/'))
+            {
+                std::string_view const element = tag.substr(1u, tag.find_first_of(" \t\r\n", 1u) - 1u);
+                if (element == "NODE" && !nodes.empty())
+                    nodes.pop_back();
+                else if (element == "ITEMLIST")
+                    list = nullptr;
+                continue;
+            }
+
+            size_t const name_end = std::min(tag.find_first_of(" \t\r\n/"), tag.size());
+            std::string_view const element = tag.substr(0u, name_end);
+            std::string_view const attributes = tag.substr(name_end);
+
+            if (element == "NODE" && !self_closing)
+            {
+                nodes.push_back(attribute(attributes, "name", position).value_or(""));
+            }
+            else if (element == "ITEM" || element == "ITEMLIST")
+            {
+                std::optional<std::string> name = attribute(attributes, "name", position);
+                if (!name)
+                    syntax_error(position, "Missing attribute \"name\".");
+
+                entries_.push_back(entry{nodes, std::move(*name), {}});
+
+                if (element == "ITEM")
+                    entries_.back().values.push_back(attribute(attributes, "value", position).value_or(""));
+                else if (!self_closing)
+                    list = &entries_.back();
+            }
+            else if (element == "LISTITEM" && list != nullptr)
+            {
+                list->values.push_back(attribute(attributes, "value", position).value_or(""));
+            }
+        }
+    }
+    //!\}
+
+    /*!\name CWL job file
+     * \{
+     */
+    //!\brief A YAML value.
+    struct yaml_value
+    {
+        //!\brief The kind of the value.
+        enum class kind_t
+        {
+            null,     //!< `null`, `~` or nothing.
+            scalar,   //!< A string, number or boolean.
+            sequence, //!< A list.
+            mapping   //!< A mapping.
+        };
+
+        kind_t kind{kind_t::null};                                 //!< The kind of the value.
+        std::string text{};                                        //!< The text of a scalar.
+        std::vector<yaml_value> items{};                           //!< The items of a sequence.
+        std::vector<std::pair<std::string, yaml_value>> members{}; //!< The members of a mapping.
+    };
+
+    //!\brief A non-empty line of a YAML document without comment.
+    struct yaml_line
+    {
+        size_t indent;         //!< The number of leading spaces.
+        std::string_view text; //!< The text after the indentation.
+        size_t position;       //!< The position of the text in the file.
+    };
+
+    //!\brief Removes leading whitespace, including line breaks.
+    static std::string_view trim_front(std::string_view text) noexcept
+    {
+        return text.substr(std::min(text.find_first_not_of(" \t\r\n"), text.size()));
+    }
+
+    //!\brief Removes trailing spaces and tabs.
+    static std::string_view trim_back(std::string_view text) noexcept
+    {
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+            text.remove_suffix(1u);
+        return text;
+    }
+
+    //!\brief Returns the position of the comment in a line, i.e. a `#` outside of quotes at the start or after a space.
+    static size_t comment_position(std::string_view const line) noexcept
+    {
+        char quote{'\0'};
+
+        for (size_t i = 0u; i < line.size(); ++i)
+        {
+            char const c = line[i];
+
+            if (quote != '\0')
+            {
+                if (c == '\\' && quote == '"')
+                    ++i;
+                else if (c == quote)
+                    quote = '\0';
+            }
+            else if (c == '"' || c == '\'')
+            {
+                quote = c;
+            }
+            else if (c == '#' && (i == 0u || line[i - 1u] == ' ' || line[i - 1u] == '\t'))
+            {
+                return i;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    //!\brief Reads a CWL job file.
+    void read_cwl_job()
+    {
+        yaml_value document{};
+        std::string_view const trimmed = trim_front(text);
+
+        if (trimmed.starts_with('{')) // JSON or a YAML flow mapping that may span multiple lines
+        {
+            std::string_view rest = trimmed;
+            document = read_flow(rest, false);
+
+            if (!trim_front(rest).empty())
+                syntax_error(text.size() - rest.size(), "Unexpected characters after the document.");
+        }
+        else
+        {
+            std::vector<yaml_line> lines{};
+
+            for (size_t start = 0u; start < text.size();)
+            {
+                size_t const end = std::min(text.find('\n', start), text.size());
+                std::string_view line = text.substr(start, end - start);
+                size_t const indent = std::min(line.find_first_not_of(' '), line.size());
+
+                line = trim_back(line.substr(0u, std::min(comment_position(line), line.size())).substr(indent));
+
+                if (!line.empty() && line != "---" && line != "...")
+                {
+                    if (line.front() == '\t')
+                        syntax_error(start, "Tabs are not allowed for indentation.");
+
+                    lines.push_back(yaml_line{indent, line, start + indent});
+                }
+
+                start = end + 1u;
+            }
+
+            size_t index{};
+            if (!lines.empty())
+                document = read_block(lines, index, lines.front().indent);
+
+            if (index != lines.size())
+                syntax_error(lines[index].position, "Unexpected indentation.");
+        }
+
+        if (document.kind == yaml_value::kind_t::null)
+            return;
+
+        if (document.kind != yaml_value::kind_t::mapping)
+            syntax_error(0u, "The document must be a mapping of parameter names to values.");
+
+        add_members(document, {});
+    }
+
+    //!\brief Adds the members of a mapping as entries; mappings that are not files are nested parameters.
+    void add_members(yaml_value const & mapping, std::vector<std::string> const & nodes)
+    {
+        for (auto const & [name, value] : mapping.members)
+        {
+            if (value.kind == yaml_value::kind_t::mapping && !is_file_object(value))
+            {
+                std::vector<std::string> nested{nodes};
+                nested.push_back(name);
+                add_members(value, nested);
+                continue;
+            }
+
+            entry & parameter = entries_.emplace_back(entry{nodes, name, {}});
+
+            if (value.kind == yaml_value::kind_t::sequence)
+            {
+                for (yaml_value const & item : value.items)
+                    if (item.kind != yaml_value::kind_t::null)
+                        parameter.values.push_back(scalar_text(item));
+            }
+            else if (value.kind != yaml_value::kind_t::null)
+            {
+                parameter.values.push_back(scalar_text(value));
+            }
+        }
+    }
+
+    //!\brief Whether a mapping is a CWL `File` or `Directory` object.
+    static bool is_file_object(yaml_value const & mapping)
+    {
+        return std::ranges::any_of(mapping.members,
+                                   [](auto const & member)
+                                   {
+                                       return member.first == "class"
+                                           && (member.second.text == "File" || member.second.text == "Directory");
+                                   });
+    }
+
+    //!\brief Returns the text of a scalar, or the path of a `File` or `Directory` object.
+    std::string scalar_text(yaml_value const & value) const
+    {
+        if (value.kind == yaml_value::kind_t::scalar)
+            return value.text;
+
+        if (value.kind == yaml_value::kind_t::mapping && is_file_object(value))
+        {
+            for (std::string_view const key : {"path", "location"})
+            {
+                for (auto const & [name, member] : value.members)
+                {
+                    if (name == key && member.kind == yaml_value::kind_t::scalar)
+                    {
+                        std::string_view location{member.text};
+                        if (location.starts_with("file://"))
+                            location.remove_prefix(7u);
+                        return std::string{location};
+                    }
+                }
+            }
+        }
+
+        throw user_input_error{"Error in the parameter file \"" + path.string()
+                               + "\": A value must be a scalar, a list of scalars, or a File or Directory object."};
+    }
+
+    //!\brief Reads a block mapping, block sequence or scalar whose first line has the indentation `indent`.
+    yaml_value read_block(std::vector<yaml_line> & lines, size_t & index, size_t const indent)
+    {
+        yaml_value value{};
+        yaml_line const & first = lines[index];
+        enter_collection(first.position);
+
+        if (first.text == "-" || first.text.starts_with("- "))
+        {
+            value.kind = yaml_value::kind_t::sequence;
+
+            while (index < lines.size() && lines[index].indent == indent
+                   && (lines[index].text == "-" || lines[index].text.starts_with("- ")))
+            {
+                yaml_line & line = lines[index];
+
+                if (line.text == "-") // The item is on the following lines.
+                {
+                    ++index;
+                    if (index < lines.size() && lines[index].indent > indent)
+                        value.items.push_back(read_block(lines, index, lines[index].indent));
+                    else
+                        value.items.emplace_back();
+                    continue;
+                }
+
+                // Read the rest of the line as if it started a block, e.g. `- path: a` continues on the next lines.
+                size_t const offset = line.text.find_first_not_of(' ', 1u);
+                line.indent += offset;
+                line.position += offset;
+                line.text.remove_prefix(offset);
+                value.items.push_back(read_block(lines, index, line.indent));
+            }
+
+            --nesting_depth;
+            return value;
+        }
+
+        if (size_t const colon = key_end(first.text); colon != std::string_view::npos)
+        {
+            value.kind = yaml_value::kind_t::mapping;
+
+            while (index < lines.size() && lines[index].indent == indent)
+            {
+                yaml_line const line = lines[index];
+                size_t const end = key_end(line.text);
+
+                if (end == std::string_view::npos)
+                    syntax_error(line.position, "Expected \"key: value\".");
+
+                std::string key = unquote_key(trim_back(line.text.substr(0u, end)), line.position);
+                std::string_view rest = trim_front(line.text.substr(end + 1u));
+                ++index;
+
+                if (!rest.empty())
+                {
+                    value.members.emplace_back(std::move(key), read_flow_line(rest, line.position));
+                }
+                else if (index < lines.size() && lines[index].indent > indent)
+                {
+                    value.members.emplace_back(std::move(key), read_block(lines, index, lines[index].indent));
+                }
+                else if (index < lines.size() && lines[index].indent == indent
+                         && (lines[index].text == "-" || lines[index].text.starts_with("- ")))
+                {
+                    // A block sequence may have the same indentation as its key.
+                    value.members.emplace_back(std::move(key), read_block(lines, index, indent));
+                }
+                else
+                {
+                    value.members.emplace_back(std::move(key), yaml_value{});
+                }
+            }
+
+            --nesting_depth;
+            return value;
+        }
+
+        --nesting_depth;
+        ++index;
+        return read_flow_line(first.text, first.position);
+    }
+
+    //!\brief Counts a collection that is entered; throws if it exceeds parameter_file::max_nesting_depth.
+    void enter_collection(size_t const position)
+    {
+        if (++nesting_depth > max_nesting_depth)
+            syntax_error(position,
+                         "The values are nested more than " + std::to_string(max_nesting_depth) + " levels deep.");
+    }
+
+    //!\brief Returns the position of the `:` that ends the key of a mapping member; npos if there is none.
+    static size_t key_end(std::string_view const line) noexcept
+    {
+        if (line.starts_with('"') || line.starts_with('\''))
+        {
+            size_t const quote_end = line.find(line.front(), 1u);
+            if (quote_end == std::string_view::npos)
+                return std::string_view::npos;
+            size_t const colon = line.find_first_not_of(' ', quote_end + 1u);
+            return (colon != std::string_view::npos && line[colon] == ':') ? colon : std::string_view::npos;
+        }
+
+        if (line.starts_with('[') || line.starts_with('{'))
+            return std::string_view::npos;
+
+        for (size_t colon = line.find(':'); colon != std::string_view::npos; colon = line.find(':', colon + 1u))
+        {
+            if (colon + 1u == line.size() || line[colon + 1u] == ' ')
+                return colon;
+        }
+
+        return std::string_view::npos;
+    }
+
+    //!\brief Removes the quotes of a key.
+    std::string unquote_key(std::string_view const key, size_t const position) const
+    {
+        if (key.starts_with('"') || key.starts_with('\''))
+        {
+            std::string_view rest = key;
+            return read_quoted(rest, position);
+        }
+
+        return std::string{key};
+    }
+
+    //!\brief Reads a value in flow style that must span the rest of the line.
+    yaml_value read_flow_line(std::string_view text_of_line, size_t const position)
+    {
+        yaml_value value = read_flow(text_of_line, false);
+
+        if (!trim_front(text_of_line).empty())
+            syntax_error(position, "Unexpected characters \"" + std::string{trim_front(text_of_line)} + "\".");
+
+        return value;
+    }
+
+    /*!\brief Reads a value in flow style from the front of `rest` and removes it.
+     * \param[in, out] rest The text starting with the value.
+     * \param[in] in_collection Whether the value is part of a flow sequence or mapping, where `,`, `]` and `}` end
+     *                          plain scalars.
+     */
+    yaml_value read_flow(std::string_view & rest, bool const in_collection)
+    {
+        rest = trim_front(rest);
+        size_t const position = text.size() - std::min(text.size(), rest.size()); // only exact for multi-line flow
+        yaml_value value{};
+
+        if (rest.starts_with('[') || rest.starts_with('{'))
+        {
+            char const close = rest.front() == '[' ? ']' : '}';
+            value.kind = close == ']' ? yaml_value::kind_t::sequence : yaml_value::kind_t::mapping;
+            rest.remove_prefix(1u);
+            enter_collection(position);
+
+            while (true)
+            {
+                rest = trim_front(rest);
+
+                if (rest.starts_with(close))
+                {
+                    rest.remove_prefix(1u);
+                    --nesting_depth;
+                    return value;
+                }
+
+                if (rest.empty())
+                    syntax_error(position, "Missing '" + std::string{close} + "'.");
+
+                if (close == ']')
+                {
+                    value.items.push_back(read_flow(rest, true));
+                }
+                else
+                {
+                    yaml_value key = read_flow(rest, true);
+                    rest = trim_front(rest);
+
+                    if (key.kind != yaml_value::kind_t::scalar || !rest.starts_with(':'))
+                        syntax_error(position, "Expected \"key: value\" in a mapping.");
+
+                    rest.remove_prefix(1u);
+                    value.members.emplace_back(std::move(key.text), read_flow(rest, true));
+                }
+
+                rest = trim_front(rest);
+
+                if (rest.starts_with(','))
+                    rest.remove_prefix(1u);
+                else if (!rest.starts_with(close))
+                    syntax_error(position, "Expected ',' or '" + std::string{close} + "'.");
+            }
+        }
+
+        if (rest.starts_with('"') || rest.starts_with('\''))
+        {
+            value.kind = yaml_value::kind_t::scalar;
+            value.text = read_quoted(rest, position);
+            return value;
+        }
+
+        // A plain scalar ends at the end of the line, or at a delimiter within a flow collection.
+        size_t end = in_collection ? rest.find_first_of(",]}\n") : rest.find('\n');
+
+        if (in_collection) // `key: value` within a flow mapping
+        {
+            for (size_t colon = rest.find(':'); colon < end; colon = rest.find(':', colon + 1u))
+            {
+                if (colon + 1u == rest.size() || rest[colon + 1u] == ' ' || rest[colon + 1u] == ',')
+                {
+                    end = colon;
+                    break;
+                }
+            }
+        }
+
+        std::string_view const plain = trim_back(rest.substr(0u, end));
+        rest.remove_prefix(std::min(end, rest.size()));
+
+        if (!plain.empty() && plain != "null" && plain != "~")
+        {
+            value.kind = yaml_value::kind_t::scalar;
+            value.text = plain;
+        }
+
+        return value;
+    }
+
+    //!\brief Reads a single or double quoted scalar from the front of `rest` and removes it.
+    std::string read_quoted(std::string_view & rest, size_t const position) const
+    {
+        char const quote = rest.front();
+        std::string value{};
+
+        for (size_t i = 1u; i < rest.size(); ++i)
+        {
+            char const c = rest[i];
+
+            if (c == quote)
+            {
+                if (quote == '\'' && i + 1u < rest.size() && rest[i + 1u] == '\'') // '' is an escaped '
+                {
+                    value += '\'';
+                    ++i;
+                    continue;
+                }
+
+                rest.remove_prefix(i + 1u);
+                return value;
+            }
+
+            if (c != '\\' || quote == '\'')
+            {
+                value += c;
+                continue;
+            }
+
+            if (++i == rest.size())
+                break;
+
+            switch (rest[i])
+            {
+                case 'n':
+                    value += '\n';
+                    break;
+                case 't':
+                    value += '\t';
+                    break;
+                case 'r':
+                    value += '\r';
+                    break;
+                case 'b':
+                    value += '\b';
+                    break;
+                case 'f':
+                    value += '\f';
+                    break;
+                case '"':
+                case '\\':
+                case '/':
+                    value += rest[i];
+                    break;
+                case 'u':
+                    append_utf8(value, read_unicode_escape(rest, i, position));
+                    break;
+                default:
+                    syntax_error(position, "Unknown escape sequence \"\\" + std::string{rest[i]} + "\".");
+            }
+        }
+
+        syntax_error(position, "Missing closing quote.");
+    }
+
+    /*!\brief Returns the code point of the escape sequence `\uXXXX` whose `u` is at `rest[i]`, and advances `i` to its
+     *        last digit.
+     * \details
+     * Like in JSON, a code point above U+FFFF is written as a UTF-16 surrogate pair, e.g. `\ud83d\ude00`.
+     */
+    uint32_t read_unicode_escape(std::string_view const rest, size_t & i, size_t const position) const
+    {
+        auto read_unit = [&]() -> uint32_t
+        {
+            std::string_view const digits = rest.substr(i + 1u, 4u);
+            uint32_t unit{};
+            auto [ptr, error] = std::from_chars(digits.data(), digits.data() + digits.size(), unit, 16);
+
+            if (digits.size() != 4u || error != std::errc{} || ptr != digits.data() + digits.size())
+                syntax_error(position, "Invalid escape sequence \"\\u" + std::string{digits} + "\".");
+
+            i += 4u;
+            return unit;
+        };
+
+        uint32_t const unit = read_unit();
+
+        if (unit >= 0xDC00 && unit <= 0xDFFF)
+            syntax_error(position, "Unpaired low surrogate in a \\u escape sequence.");
+
+        if (unit < 0xD800 || unit > 0xDBFF)
+            return unit;
+
+        if (rest.substr(i + 1u, 2u) != "\\u")
+            syntax_error(position, "Unpaired high surrogate in a \\u escape sequence.");
+
+        i += 2u;
+        uint32_t const low = read_unit();
+
+        if (low < 0xDC00 || low > 0xDFFF)
+            syntax_error(position, "Unpaired high surrogate in a \\u escape sequence.");
+
+        return 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+    }
+    //!\}
+};
+
+} // namespace sharg::detail
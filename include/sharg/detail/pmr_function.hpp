@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::pmr_function and helpers for heterogeneous string lookup.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief A move-only callable whose state is allocated from a std::pmr::memory_resource.
+ * \ingroup parser
+ * \tparam signature The call signature, e.g. `void()`.
+ *
+ * \details
+ *
+ * std::function cannot be given an allocator. The parser stores one callable per option, each capturing a copy of
+ * the sharg::config, and wants all of them to come from the memory resource given on construction.
+ */
+template <typename signature>
+class pmr_function;
+
+//!\copydoc sharg::detail::pmr_function
+template <typename result_t, typename... args_t>
+class pmr_function<result_t(args_t...)>
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pmr_function() = delete;                                 //!< Deleted.
+    pmr_function(pmr_function const &) = delete;             //!< Deleted.
+    pmr_function & operator=(pmr_function const &) = delete; //!< Deleted.
+
+    //!\brief Move constructor. The moved-from object is empty.
+    pmr_function(pmr_function && other) noexcept :
+        state{std::exchange(other.state, nullptr)},
+        resource{other.resource},
+        invoke_fn{other.invoke_fn},
+        destroy_fn{other.destroy_fn}
+    {}
+
+    //!\brief Move assignment. The moved-from object is empty.
+    pmr_function & operator=(pmr_function && other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            state = std::exchange(other.state, nullptr);
+            resource = other.resource;
+            invoke_fn = other.invoke_fn;
+            destroy_fn = other.destroy_fn;
+        }
+        return *this;
+    }
+
+    //!\brief Destroys the callable and returns its memory to the resource.
+    ~pmr_function()
+    {
+        reset();
+    }
+
+    /*!\brief Stores `fn` in memory allocated from `resource`.
+     * \tparam fn_t The type of the callable; must be invocable with `args_t...`.
+     * \param[in] fn The callable.
+     * \param[in] resource The memory resource to allocate from; must outlive this object.
+     */
+    template <typename fn_t>
+        requires (!std::same_as<std::remove_cvref_t<fn_t>, pmr_function>)
+              && std::invocable<std::decay_t<fn_t> &, args_t...>
+    pmr_function(fn_t && fn, std::pmr::memory_resource * resource) : resource{resource}
+    {
+        using stored_t = std::decay_t<fn_t>;
+
+        std::pmr::polymorphic_allocator<stored_t> allocator{resource};
+        stored_t * stored = allocator.allocate(1);
+
+        try
+        {
+            std::construct_at(stored, std::forward<fn_t>(fn));
+        }
+        catch (...)
+        {
+            allocator.deallocate(stored, 1);
+            throw;
+        }
+
+        state = stored;
+        invoke_fn = [](void * fn_state, args_t... args) -> result_t
+        {
+            return (*static_cast<stored_t *>(fn_state))(std::forward<args_t>(args)...);
+        };
+        destroy_fn = [](void * fn_state, std::pmr::memory_resource * fn_resource)
+        {
+            stored_t * fn_stored = static_cast<stored_t *>(fn_state);
+            std::destroy_at(fn_stored);
+            std::pmr::polymorphic_allocator<stored_t>{fn_resource}.deallocate(fn_stored, 1);
+        };
+    }
+    //!\}
+
+    //!\brief Invokes the stored callable.
+    result_t operator()(args_t... args) const
+    {
+        assert(state != nullptr);
+        return invoke_fn(state, std::forward<args_t>(args)...);
+    }
+
+private:
+    //!\brief Destroys the stored callable, if any.
+    void reset() noexcept
+    {
+        if (state != nullptr)
+            destroy_fn(std::exchange(state, nullptr), resource);
+    }
+
+    //!\brief The stored callable.
+    void * state{nullptr};
+    //!\brief The resource the stored callable was allocated from.
+    std::pmr::memory_resource * resource{nullptr};
+    //!\brief Invokes the stored callable.
+    result_t (*invoke_fn)(void *, args_t...){nullptr};
+    //!\brief Destroys and deallocates the stored callable.
+    void (*destroy_fn)(void *, std::pmr::memory_resource *){nullptr};
+};
+
+/*!\brief A transparent hash for strings with any allocator, used for heterogeneous lookup.
+ * \ingroup parser
+ */
+struct string_view_hash
+{
+    //!\brief Enables heterogeneous lookup.
+    using is_transparent = void;
+
+    //!\brief Hashes the characters of `str`.
+    size_t operator()(std::string_view const str) const noexcept
+    {
+        return std::hash<std::string_view>{}(str);
+    }
+};
+
+/*!\brief A transparent equality comparison for strings with any allocator, used for heterogeneous lookup.
+ * \ingroup parser
+ */
+struct string_view_equal
+{
+    //!\brief Enables heterogeneous lookup.
+    using is_transparent = void;
+
+    //!\brief Compares the characters of `lhs` and `rhs`.
+    bool operator()(std::string_view const lhs, std::string_view const rhs) const noexcept
+    {
+        return lhs == rhs;
+    }
+};
+
+} // namespace sharg::detail
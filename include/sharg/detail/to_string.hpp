@@ -10,6 +10,7 @@
 #pragma once
 
 #include <sstream>
+#include <string_view>
 
 #include <sharg/concept.hpp>
 #include <sharg/detail/concept.hpp>
@@ -18,12 +19,33 @@ namespace sharg::detail
 {
 
 //!\brief A string containing all supported export formats.
-static std::string const supported_exports =
+static std::string const supported_exports = []()
+{
+    std::string formats{};
+
+#if SHARG_HAS_EXPORT_HTML
+    formats += ", html";
+#endif
+#if SHARG_HAS_EXPORT_MAN
+    formats += ", man";
+#endif
 #if SHARG_HAS_TDL
-    "[html, man, ctd, cwl]";
-#else
-    "[html, man]";
+    formats += ", ctd, cwl";
 #endif
+    formats += ", json, bash, zsh, fish";
+
+    return "[" + formats.substr(2) + "]";
+}();
+
+/*!\brief Returns the error message for an export format that is not available in this build.
+ * \param[in] format_name The name of the requested export format, e.g. "html".
+ * \returns The message of the sharg::validation_error thrown for `--export-help format_name`.
+ */
+inline std::string unavailable_export_message(std::string_view const format_name)
+{
+    return "Validation failed for option --export-help: The export format " + std::string{format_name}
+         + " is not available in this build. Value must be one of " + supported_exports + ".";
+}
 
 //!\brief Concept for views whose value type is ostreamable.
 template <typename container_t>
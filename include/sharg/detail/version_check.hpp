@@ -266,6 +266,9 @@ public:
      * \param[in] developer_approval Whether the developer approved (update_notifications::on) or not
      *                               (update_notifications::off).
      * \param[in] user_approval      Whether the user approved (true) or not (false) or did not decide (unset optional).
+     * \param[in] disabled_by_environment Whether the environment variable SHARG_NO_VERSION_CHECK is set. The
+     *                                    sharg::parser reads it in the same scan as the variables of
+     *                                    sharg::config::environment_variable.
      *
      * The following rules apply:
      *
@@ -287,12 +290,14 @@ public:
      * if possible, what he wants to do, set the according cookie for the next time
      * and continue. If we cannot ask the user, the default kicks in (do the check).
      */
-    bool decide_if_check_is_performed(update_notifications developer_approval, std::optional<bool> user_approval)
+    bool decide_if_check_is_performed(update_notifications developer_approval,
+                                      std::optional<bool> user_approval,
+                                      bool const disabled_by_environment)
     {
         if (developer_approval == update_notifications::off)
             return false;
 
-        if (std::getenv("SHARG_NO_VERSION_CHECK") != nullptr) // environment variable was set
+        if (disabled_by_environment)
             return false;
 
         if (user_approval.has_value())
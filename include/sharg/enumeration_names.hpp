@@ -9,9 +9,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <ranges>
+#include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <sharg/platform.hpp>
 
@@ -35,6 +40,13 @@ namespace sharg::custom
  * Please note that by default the `t const`, `t &` and `t const &` specialisations of this class inherit the
  * specialisation for `t` so you usually only need to provide a specialisation for `t`.
  *
+ * ### Serialisation
+ *
+ * sharg::parser::serialise stores values of types it does not know as the text of their stream operator. A type can
+ * instead provide its own binary representation with the static member functions
+ * `void serialise(std::string & blob, t const & value)`, which appends the bytes, and
+ * `void deserialise(std::string_view bytes, t & value)`, which receives exactly the bytes appended by `serialise`.
+ *
  * \note Only use this if you cannot provide respective functions in your namespace. See the tutorial
  * \ref tutorial_parser for an example of customising a type within your own namespace.
  *
@@ -174,7 +186,8 @@ namespace sharg
 /*!\brief Return a conversion map from std::string_view to option_type.
  * \tparam your_type Type of the value to retrieve the conversion map for.
  * \param value The value is not accessed, only its type is used.
- * \returns A std::unordered_map<std::string_view, your_type> that maps a string identifier to a value of your_type.
+ * \returns A std::unordered_map<std::string_view, your_type> or a
+ *          std::array<std::pair<std::string_view, your_type>, N> that maps a string identifier to a value of your_type.
  * \ingroup misc
  * \details
  *
@@ -187,6 +200,12 @@ namespace sharg
  *   2. A free function `enumeration_names(your_type const a)` in the namespace of your type (or as `friend`) which
  *      returns a `std::unordered_map<std::string_view, your_type>>`.
  *
+ * Instead of a `std::unordered_map`, both implementations may provide a `std::array` of
+ * `std::pair<std::string_view, your_type>`. If it is `constexpr` (a `static constexpr` member or a `constexpr`
+ * function), the names are constant-initialised and sharg::parser builds its lookup tables at compile time, i.e.
+ * parsing and printing the enumeration neither allocates memory nor runs static initialisers.
+ * The pairs may be given in any order. If a value has multiple names, the first one is used for printing.
+ *
  * ### Example
  *
  * If you are working on a type in your namespace, you should implement a free function like this:
@@ -223,7 +242,7 @@ inline auto const enumeration_names = detail::adl_only::enumeration_names_cpo<op
  * ### Requirements
  *
  * * An instance of sharg::enumeration_names<option_type> must exist and be of the type
- *   `std::unordered_map<std::string, option_type>`.
+ *   `std::unordered_map<std::string, option_type>` or `std::array<std::pair<std::string_view, option_type>, N>`.
  *
  * \remark For a complete overview, take a look at \ref parser
  *
@@ -239,6 +258,211 @@ concept named_enumeration = requires
 // clang-format on
 } // namespace sharg
 
+namespace sharg::detail
+{
+
+/*!\brief Checks whether the names of a sharg::named_enumeration are a constant expression of fixed size.
+ * \ingroup misc
+ * \tparam option_type The type to check.
+ *
+ * \details
+ *
+ * This is the case if the customisation returns a std::array (or other tuple-like range) from a `constexpr` function
+ * or `static constexpr` member.
+ */
+// clang-format off
+template <typename option_type>
+concept constexpr_named_enumeration = named_enumeration<option_type> && requires
+{
+    typename std::integral_constant<
+        size_t,
+        std::tuple_size<std::remove_cvref_t<decltype(adl_only::enumeration_names_cpo<option_type>{}())>>::value>;
+    typename std::bool_constant<(adl_only::enumeration_names_cpo<option_type>{}(), true)>;
+};
+// clang-format on
+
+/*!\brief Sorted lookup tables for a sharg::detail::constexpr_named_enumeration, computed at compile time.
+ * \ingroup misc
+ * \tparam option_type The type of the enumeration.
+ */
+template <constexpr_named_enumeration option_type>
+struct enumeration_table
+{
+    //!\brief The (name, value) pairs in the order given by the customisation.
+    static constexpr auto entries = adl_only::enumeration_names_cpo<option_type>{}();
+
+    //!\brief The number of (name, value) pairs.
+    static constexpr size_t size = std::tuple_size_v<std::remove_cvref_t<decltype(entries)>>;
+
+    //!\brief Indices into sharg::detail::enumeration_table::entries, sorted by name.
+    static constexpr std::array<size_t, size> by_name = []()
+    {
+        std::array<size_t, size> indices{};
+        for (size_t i = 0; i < size; ++i)
+            indices[i] = i;
+
+        std::ranges::sort(indices,
+                          [](size_t const lhs, size_t const rhs)
+                          {
+                              return std::string_view{entries[lhs].first} < std::string_view{entries[rhs].first};
+                          });
+        return indices;
+    }();
+
+    //!\brief Indices into sharg::detail::enumeration_table::entries, sorted by value and then by position.
+    static constexpr std::array<size_t, size> by_value = []()
+    {
+        std::array<size_t, size> indices{};
+        for (size_t i = 0; i < size; ++i)
+            indices[i] = i;
+
+        if constexpr (std::totally_ordered<option_type>)
+        {
+            std::ranges::sort(indices,
+                              [](size_t const lhs, size_t const rhs)
+                              {
+                                  if (entries[lhs].second != entries[rhs].second)
+                                      return entries[lhs].second < entries[rhs].second;
+                                  return lhs < rhs;
+                              });
+        }
+        return indices;
+    }();
+};
+
+/*!\brief Looks up the value of a sharg::named_enumeration by its name.
+ * \ingroup misc
+ * \tparam option_type The type of the enumeration.
+ * \param[in] name The name to look up.
+ * \returns A pointer to the value, or `nullptr` if `name` is not a known name.
+ *
+ * \details
+ *
+ * ### Complexity
+ *
+ * Logarithmic for a sharg::detail::constexpr_named_enumeration, otherwise the complexity of `find` of the
+ * returned map.
+ */
+template <named_enumeration option_type>
+constexpr option_type const * find_enumeration_value(std::string_view const name)
+{
+    using value_type = std::remove_cvref_t<option_type>;
+
+    if constexpr (constexpr_named_enumeration<value_type>)
+    {
+        using table = enumeration_table<value_type>;
+
+        auto it = std::ranges::lower_bound(table::by_name,
+                                           name,
+                                           std::ranges::less{},
+                                           [](size_t const index)
+                                           {
+                                               return std::string_view{table::entries[index].first};
+                                           });
+
+        if (it == table::by_name.end() || std::string_view{table::entries[*it].first} != name)
+            return nullptr;
+
+        return &table::entries[*it].second;
+    }
+    else
+    {
+        auto const & names = sharg::enumeration_names<value_type>;
+
+        if constexpr (requires { names.find(name); })
+        {
+            auto it = names.find(name);
+            return it == names.end() ? nullptr : &it->second;
+        }
+        else
+        {
+            auto it = std::ranges::find(names, name, [](auto const & pair) { return std::string_view{pair.first}; });
+            return it == std::ranges::end(names) ? nullptr : &it->second;
+        }
+    }
+}
+
+/*!\brief Looks up the name of a value of a sharg::named_enumeration.
+ * \ingroup misc
+ * \tparam option_type The type of the enumeration.
+ * \param[in] value The value to look up.
+ * \returns The name of the value, or an empty std::string_view if the value has no name.
+ *
+ * \details
+ *
+ * ### Complexity
+ *
+ * Logarithmic for a sharg::detail::constexpr_named_enumeration whose values are std::totally_ordered, otherwise
+ * linear.
+ */
+template <named_enumeration option_type>
+constexpr std::string_view find_enumeration_name(option_type const & value)
+{
+    using value_type = std::remove_cvref_t<option_type>;
+
+    if constexpr (constexpr_named_enumeration<value_type> && std::totally_ordered<value_type>)
+    {
+        using table = enumeration_table<value_type>;
+
+        auto it = std::ranges::lower_bound(table::by_value,
+                                           value,
+                                           std::ranges::less{},
+                                           [](size_t const index)
+                                           {
+                                               return table::entries[index].second;
+                                           });
+
+        if (it == table::by_value.end() || table::entries[*it].second != value)
+            return {};
+
+        return table::entries[*it].first;
+    }
+    else
+    {
+        for (auto const & [key, entry] : sharg::enumeration_names<value_type>)
+        {
+            if (value == entry)
+                return key;
+        }
+
+        return {};
+    }
+}
+
+/*!\brief Returns the keys of sharg::enumeration_names<option_t> as a list, e.g. "[a, b, c]".
+ * \ingroup misc
+ * \tparam option_t Must model sharg::named_enumeration.
+ * \details
+ * The keys are sorted by their values if the values are std::totally_ordered and otherwise by name.
+ */
+template <named_enumeration option_t>
+std::string enumeration_keys()
+{
+    auto const & map = sharg::enumeration_names<option_t>;
+    std::vector<std::pair<std::string_view, option_t>> key_value_pairs(map.begin(), map.end());
+
+    std::sort(key_value_pairs.begin(),
+              key_value_pairs.end(),
+              [](auto pair1, auto pair2)
+              {
+                  if constexpr (std::totally_ordered<option_t>)
+                  {
+                      if (pair1.second != pair2.second)
+                          return pair1.second < pair2.second;
+                  }
+
+                  return pair1.first < pair2.first;
+              }); // needed for deterministic output when using unordered maps
+
+    std::string result{'['};
+    for (auto const & [key, value] : key_value_pairs)
+        result += std::string{key.data()} + ", ";
+    result.replace(result.size() - 2, 2, "]"); // replace last ", " by "]"
+    return result;
+}
+
+} // namespace sharg::detail
+
 //!\cond
 namespace std
 {
@@ -251,11 +475,8 @@ template <typename option_type>
     requires sharg::named_enumeration<remove_cvref_t<option_type>>
 inline ostream & operator<<(ostream & s, option_type && op)
 {
-    for (auto & [key, value] : sharg::enumeration_names<option_type>)
-    {
-        if (op == value)
-            return s << key;
-    }
+    if (std::string_view name = sharg::detail::find_enumeration_name(op); !name.empty())
+        return s << name;
 
     return s << "<UNKNOWN_VALUE>";
 }
@@ -216,4 +216,28 @@ public:
     {}
 };
 
+/*!\brief Parser exception thrown when a blob passed to sharg::parser::deserialise cannot be restored.
+ * \ingroup exceptions
+ * \remark For a complete overview, take a look at \ref parser
+ *
+ * \details
+ *
+ * The blob is corrupt, or it was created by another application or application version, or by a parser with
+ * different options.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+class deserialisation_error : public parser_error
+{
+public:
+    /*!\brief The constructor.
+     * \param[in] s The error message.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    deserialisation_error(std::string const & s) : parser_error(s)
+    {}
+};
+
 } // namespace sharg
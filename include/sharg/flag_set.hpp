@@ -0,0 +1,303 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::flag_set.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <sharg/enumeration_names.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Whether all values of a sharg::detail::constexpr_named_enumeration can be represented in a sharg::flag_set.
+ * \ingroup parser
+ * \tparam enum_t The type of the enumeration.
+ * \details
+ * Returns `true` if the names are not a constant expression; this is then only asserted when a value is inserted.
+ */
+template <typename enum_t>
+constexpr bool fits_into_flag_set()
+{
+    if constexpr (constexpr_named_enumeration<enum_t>)
+    {
+        for (auto const & entry : enumeration_table<enum_t>::entries)
+        {
+            auto const index = static_cast<std::underlying_type_t<enum_t>>(entry.second);
+            if (std::cmp_less(index, 0) || std::cmp_greater_equal(index, 64))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace sharg::detail
+
+namespace sharg
+{
+
+/*!\brief A set of values of a named enumeration that is stored as a bitmask.
+ * \ingroup parser
+ * \tparam enum_t The type of the enumeration; must model sharg::named_enumeration.
+ *
+ * \details
+ *
+ * A sharg::flag_set can be added to the sharg::parser like any other container option. Its values are given as a
+ * comma separated list of names (`--features fast,small`), by repeating the option (`--features fast --features
+ * small`), or both. Every name must be a key of sharg::enumeration_names<enum_t>.
+ *
+ * Each enumerator is represented by the bit whose index is the underlying value of the enumerator, i.e. the
+ * underlying values must be in `[0, 64)`. Checking whether a value is part of the set is a single bit operation:
+ *
+ * \include test/snippet/flag_set.cpp
+ *
+ * If the names are provided as a `constexpr` std::array, it is checked at compile time that all values fit into the
+ * bitmask. Otherwise, this is only asserted when a value is inserted.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <typename enum_t>
+    requires std::is_enum_v<enum_t> && named_enumeration<enum_t>
+class flag_set
+{
+public:
+    //!\brief The type of the enumeration.
+    using value_type = enum_t;
+    //!\brief The type of the bitmask.
+    using mask_type = uint64_t;
+    //!\brief The type of the size.
+    using size_type = size_t;
+
+    //!\brief The number of distinct values a sharg::flag_set can store.
+    static constexpr size_type max_size = 64u;
+
+    /*!\brief Returns the bit that represents `value`.
+     * \param[in] value The value to get the bit for.
+     * \returns A bitmask where only the bit of `value` is set.
+     */
+    static constexpr mask_type bit(value_type const value) noexcept
+    {
+        auto const index = static_cast<std::underlying_type_t<value_type>>(value);
+        assert(std::cmp_greater_equal(index, 0) && std::cmp_less(index, max_size));
+        return mask_type{1u} << index;
+    }
+
+    /*!\brief A forward iterator over the values of a sharg::flag_set in ascending order of their underlying values.
+     * \details
+     * The values are computed from the bitmask, hence dereferencing the iterator returns the value by copy.
+     */
+    class iterator
+    {
+    public:
+        //!\brief The difference type.
+        using difference_type = std::ptrdiff_t;
+        //!\brief The value type.
+        using value_type = enum_t;
+        //!\brief The reference type; the value is returned by copy.
+        using reference = enum_t;
+        //!\brief The iterator category.
+        using iterator_category = std::forward_iterator_tag;
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        iterator() = default;                             //!< Defaulted.
+        iterator(iterator const &) = default;             //!< Defaulted.
+        iterator & operator=(iterator const &) = default; //!< Defaulted.
+        iterator(iterator &&) = default;                  //!< Defaulted.
+        iterator & operator=(iterator &&) = default;      //!< Defaulted.
+        ~iterator() = default;                            //!< Defaulted.
+
+        //!\brief Constructs an iterator over the set bits of `mask`.
+        constexpr explicit iterator(mask_type const mask) noexcept : remaining{mask}
+        {}
+        //!\}
+
+        //!\brief Returns the value of the lowest remaining bit.
+        constexpr value_type operator*() const noexcept
+        {
+            assert(remaining != 0u);
+            return static_cast<value_type>(std::countr_zero(remaining));
+        }
+
+        //!\brief Advances to the next set bit.
+        constexpr iterator & operator++() noexcept
+        {
+            remaining &= remaining - 1u; // clear the lowest set bit
+            return *this;
+        }
+
+        //!\brief Advances to the next set bit.
+        constexpr iterator operator++(int) noexcept
+        {
+            iterator tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+
+        //!\brief Compares the remaining bits.
+        constexpr bool operator==(iterator const &) const noexcept = default;
+
+    private:
+        //!\brief The bits that have not been visited yet.
+        mask_type remaining{};
+    };
+
+    //!\brief The iterator type; the set cannot be modified via iterators.
+    using const_iterator = iterator;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr flag_set() noexcept = default;                             //!< Defaulted.
+    constexpr flag_set(flag_set const &) noexcept = default;             //!< Defaulted.
+    constexpr flag_set & operator=(flag_set const &) noexcept = default; //!< Defaulted.
+    constexpr flag_set(flag_set &&) noexcept = default;                  //!< Defaulted.
+    constexpr flag_set & operator=(flag_set &&) noexcept = default;      //!< Defaulted.
+    constexpr ~flag_set() noexcept = default;                            //!< Defaulted.
+
+    //!\brief Constructs the set from a list of values.
+    constexpr flag_set(std::initializer_list<value_type> const values) noexcept
+    {
+        for (value_type const value : values)
+            insert(value);
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Whether `value` is part of the set.
+    constexpr bool contains(value_type const value) const noexcept
+    {
+        return (bits & bit(value)) != 0u;
+    }
+
+    //!\brief Returns the underlying bitmask.
+    constexpr mask_type mask() const noexcept
+    {
+        return bits;
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Adds `value` to the set.
+    constexpr void insert(value_type const value) noexcept
+    {
+        bits |= bit(value);
+    }
+
+    //!\brief Removes `value` from the set.
+    constexpr void erase(value_type const value) noexcept
+    {
+        bits &= ~bit(value);
+    }
+
+    //!\brief Removes all values from the set.
+    constexpr void clear() noexcept
+    {
+        bits = 0u;
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Whether the set is empty.
+    constexpr bool empty() const noexcept
+    {
+        return bits == 0u;
+    }
+
+    //!\brief The number of values in the set.
+    constexpr size_type size() const noexcept
+    {
+        return static_cast<size_type>(std::popcount(bits));
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the value with the lowest underlying value.
+    constexpr iterator begin() const noexcept
+    {
+        return iterator{bits};
+    }
+
+    //!\brief Returns the end iterator.
+    constexpr iterator end() const noexcept
+    {
+        return iterator{};
+    }
+    //!\}
+
+    /*!\name Set operations
+     * \{
+     */
+    //!\brief Adds all values of `rhs`.
+    constexpr flag_set & operator|=(flag_set const rhs) noexcept
+    {
+        bits |= rhs.bits;
+        return *this;
+    }
+
+    //!\brief Keeps only the values that are also in `rhs`.
+    constexpr flag_set & operator&=(flag_set const rhs) noexcept
+    {
+        bits &= rhs.bits;
+        return *this;
+    }
+
+    //!\brief Returns the union of both sets.
+    friend constexpr flag_set operator|(flag_set lhs, flag_set const rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    //!\brief Returns the intersection of both sets.
+    friend constexpr flag_set operator&(flag_set lhs, flag_set const rhs) noexcept
+    {
+        return lhs &= rhs;
+    }
+    //!\}
+
+    //!\brief Compares the bitmasks.
+    constexpr bool operator==(flag_set const &) const noexcept = default;
+
+private:
+    static_assert(detail::fits_into_flag_set<enum_t>(),
+                  "The underlying values of a sharg::flag_set's enumeration must be in [0, 64).");
+
+    //!\brief The bitmask.
+    mask_type bits{};
+};
+
+} // namespace sharg
+
+namespace sharg::detail
+{
+
+//!\brief Whether `type` is a sharg::flag_set.
+template <typename type>
+inline constexpr bool is_flag_set = false;
+
+//!\brief Whether `type` is a sharg::flag_set.
+template <typename enum_t>
+inline constexpr bool is_flag_set<flag_set<enum_t>> = true;
+
+} // namespace sharg::detail
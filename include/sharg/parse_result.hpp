@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::diagnostic, sharg::parse_result and sharg::parse_status.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <sharg/exceptions.hpp>
+
+namespace sharg
+{
+
+/*!\brief The kind of a sharg::diagnostic.
+ * \ingroup parser
+ * \details
+ * Each kind corresponds to the exception of the same name that sharg::parser::parse throws.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+enum class diagnostic_kind
+{
+    user_input_error,               //!< A value could not be parsed or a subcommand is unknown.
+    unknown_option,                 //!< An option or flag was given that was not added to the parser.
+    too_many_arguments,             //!< More positional arguments were given than expected.
+    too_few_arguments,              //!< An option value or positional argument is missing.
+    required_option_missing,        //!< A required option was not given.
+    option_declared_multiple_times, //!< An option that is no list/container was given more than once.
+    validation_error                //!< A value was rejected by a validator.
+};
+
+/*!\brief What sharg::parser::parse(std::ostream &) did.
+ * \ingroup parser
+ * \details
+ *
+ * If the command line contained a special option like `--help`, the output was written to the given stream instead of
+ * terminating the program.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+enum class parse_status
+{
+    parsed,            //!< The command line was parsed into the option values.
+    help_printed,      //!< The (short or advanced) help page was printed (`-h`, `-hh`, or no arguments).
+    version_printed,   //!< The version information was printed (`--version`).
+    copyright_printed, //!< The copyright information was printed (`--copyright`).
+    exported           //!< The application description was exported (`--export-help`).
+};
+
+/*!\brief A structured description of a single error found while parsing the command line.
+ * \ingroup parser
+ * \details
+ *
+ * Diagnostics are returned by sharg::parser::try_parse. The human readable message is not created while parsing, but
+ * only when sharg::diagnostic::message is called. It is the same message that sharg::parser::parse puts into the
+ * exception.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+class diagnostic
+{
+public:
+    //!\brief The type of the function that creates the message from the diagnostic and its additional text.
+    using formatter_t = std::string (*)(diagnostic const &, std::string const &);
+
+    //!\brief The position of sharg::diagnostic::argument_index if the diagnostic does not refer to a single argument.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    diagnostic() = delete;                                //!< Deleted.
+    diagnostic(diagnostic const &) = default;             //!< Defaulted.
+    diagnostic & operator=(diagnostic const &) = default; //!< Defaulted.
+    diagnostic(diagnostic &&) = default;                  //!< Defaulted.
+    diagnostic & operator=(diagnostic &&) = default;      //!< Defaulted.
+    ~diagnostic() = default;                              //!< Defaulted.
+
+    /*!\brief Constructs a diagnostic.
+     * \param[in] kind The kind of the error.
+     * \param[in] option_id The option the error refers to, e.g. `-i/--int` or `positional option 1`.
+     * \param[in] argument_index The index of the offending command line argument.
+     * \param[in] value The offending command line argument or value.
+     * \param[in] formatter The function that creates the message from the diagnostic.
+     * \param[in] detail Additional text that is only used by the `formatter`, e.g. the message of a validator.
+     */
+    diagnostic(diagnostic_kind const kind,
+               std::string option_id,
+               size_t const argument_index,
+               std::string value,
+               formatter_t const formatter,
+               std::string detail = {}) :
+        kind{kind},
+        option_id{std::move(option_id)},
+        argument_index{argument_index},
+        value{std::move(value)},
+        formatter{formatter},
+        detail{std::move(detail)}
+    {}
+    //!\}
+
+    //!\brief The kind of the error.
+    diagnostic_kind kind;
+
+    //!\brief The option the error refers to, e.g. `-i/--int`; empty if the error does not refer to an option.
+    std::string option_id;
+
+    /*!\brief The index of the offending argument in the `argv` given to the sharg::parser.
+     * \details
+     * Index 0 is the executable name. If the error does not refer to a single argument, e.g. a required option that is
+     * missing, the index is sharg::diagnostic::npos.
+     */
+    size_t argument_index;
+
+    //!\brief The offending command line argument or value; may be empty.
+    std::string value;
+
+    //!\brief Returns the human readable error message.
+    std::string message() const
+    {
+        return formatter(*this, detail);
+    }
+
+    /*!\brief Throws the exception corresponding to sharg::diagnostic::kind with sharg::diagnostic::message.
+     * \throws sharg::parser_error Always; the dynamic type depends on sharg::diagnostic::kind.
+     */
+    [[noreturn]] void throw_exception() const
+    {
+        switch (kind)
+        {
+        case diagnostic_kind::unknown_option:
+            throw unknown_option{message()};
+        case diagnostic_kind::too_many_arguments:
+            throw too_many_arguments{message()};
+        case diagnostic_kind::too_few_arguments:
+            throw too_few_arguments{message()};
+        case diagnostic_kind::required_option_missing:
+            throw required_option_missing{message()};
+        case diagnostic_kind::option_declared_multiple_times:
+            throw option_declared_multiple_times{message()};
+        case diagnostic_kind::validation_error:
+            throw validation_error{message()};
+        default:
+            throw user_input_error{message()};
+        }
+    }
+
+private:
+    //!\brief Creates the message.
+    formatter_t formatter;
+
+    //!\brief Additional text used by sharg::diagnostic::formatter.
+    std::string detail;
+};
+
+/*!\brief The result of sharg::parser::try_parse.
+ * \ingroup parser
+ * \details
+ *
+ * Similar to a `std::expected<void, std::vector<sharg::diagnostic>>`, the result either signals success or holds the
+ * diagnostics of all errors that were found.
+ *
+ * \include test/snippet/try_parse.cpp
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+class parse_result
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parse_result() = default;                                 //!< Defaulted.
+    parse_result(parse_result const &) = default;             //!< Defaulted.
+    parse_result & operator=(parse_result const &) = default; //!< Defaulted.
+    parse_result(parse_result &&) = default;                  //!< Defaulted.
+    parse_result & operator=(parse_result &&) = default;      //!< Defaulted.
+    ~parse_result() = default;                                //!< Defaulted.
+
+    /*!\brief Constructs a result from the diagnostics found while parsing.
+     * \param[in] diagnostics The diagnostics; the result signals success if there are none.
+     */
+    explicit parse_result(std::vector<diagnostic> diagnostics) : found_diagnostics{std::move(diagnostics)}
+    {}
+    //!\}
+
+    //!\brief Returns whether parsing was successful.
+    bool has_value() const noexcept
+    {
+        return found_diagnostics.empty();
+    }
+
+    //!\copydoc has_value
+    explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    //!\brief Returns the diagnostics in the order in which the errors were found.
+    std::vector<diagnostic> const & diagnostics() const noexcept
+    {
+        return found_diagnostics;
+    }
+
+    /*!\brief Does nothing if parsing was successful.
+     * \throws sharg::parser_error The exception of the first diagnostic, see sharg::diagnostic::throw_exception.
+     */
+    void value() const
+    {
+        if (!has_value())
+            found_diagnostics.front().throw_exception();
+    }
+
+private:
+    //!\brief The diagnostics.
+    std::vector<diagnostic> found_diagnostics{};
+};
+
+} // namespace sharg
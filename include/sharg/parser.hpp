@@ -9,16 +9,32 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <span>
+#include <sstream>
+#include <unordered_map>
 #include <unordered_set>
 #include <variant>
 
 #include <sharg/config.hpp>
+#include <sharg/detail/config_file.hpp>
+#include <sharg/detail/embedded_exports.hpp>
+#include <sharg/detail/environment.hpp>
+#include <sharg/detail/format_completion.hpp>
+#include <sharg/detail/format_fingerprint.hpp>
 #include <sharg/detail/format_help.hpp>
+#include <sharg/detail/format_json.hpp>
 #include <sharg/detail/format_html.hpp>
 #include <sharg/detail/format_man.hpp>
 #include <sharg/detail/format_parse.hpp>
+#include <sharg/detail/format_serialise.hpp>
 #include <sharg/detail/format_tdl.hpp>
+#include <sharg/detail/parameter_file.hpp>
 #include <sharg/detail/version_check.hpp>
+#include <sharg/flag_set.hpp>
+#include <sharg/parse_result.hpp>
 
 namespace sharg
 {
@@ -168,6 +184,7 @@ public:
      * \param[in] arguments The command line arguments to parse.
      * \param[in] version_updates Notify users about version updates (default sharg::update_notifications::on).
      * \param[in] subcommands A list of subcommands (see \link subcommand_parse subcommand parsing \endlink).
+     * \param[in] resource The memory resource for the internal bookkeeping (default: std::pmr::get_default_resource()).
      *
      * The application name must only contain alpha-numeric characters, `_` or `-` ,
      * i.e. the following regex must evaluate to true: `"^[a-zA-Z0-9_-]+$"` .
@@ -175,15 +192,24 @@ public:
      * See the [parser tutorial](https://docs.seqan.de/sharg/main_user/tutorial_parser.html)
      * for more information about the version check functionality.
      *
+     * ### Memory resource
+     *
+     * The copies of the arguments, the identifiers, and the stored sharg::config of every option are allocated from
+     * `resource`, e.g. a std::pmr::monotonic_buffer_resource that is released in one step after parsing.
+     * The `resource` must outlive the parser.
+     *
      * \details
      * \stableapi{Since version 1.0.}
+     * The `resource` parameter is \experimentalapi{Experimental since version 1.1.2.}
      */
     parser(std::string const & app_name,
            std::vector<std::string> const & arguments,
            update_notifications version_updates = update_notifications::on,
-           std::vector<std::string> subcommands = {}) :
+           std::vector<std::string> subcommands = {},
+           std::pmr::memory_resource * resource = std::pmr::get_default_resource()) :
+        resource{resource},
         version_check_dev_decision{version_updates},
-        arguments{arguments}
+        arguments{arguments.begin(), arguments.end(), resource}
     {
         add_subcommands(subcommands);
         info.app_name = app_name;
@@ -194,9 +220,15 @@ public:
            int const argc,
            char const * const * const argv,
            update_notifications version_updates = update_notifications::on,
-           std::vector<std::string> subcommands = {}) :
-        parser{app_name, std::vector<std::string>{argv, argv + argc}, version_updates, std::move(subcommands)}
-    {}
+           std::vector<std::string> subcommands = {},
+           std::pmr::memory_resource * resource = std::pmr::get_default_resource()) :
+        resource{resource},
+        version_check_dev_decision{version_updates},
+        arguments{argv, argv + argc, resource}
+    {
+        add_subcommands(subcommands);
+        info.app_name = app_name;
+    }
 
     //!\brief The destructor.
     ~parser()
@@ -231,6 +263,7 @@ public:
      * \throws sharg::design_error if the option is required and has a default_message.
      * \throws sharg::design_error if the option identifier was already used.
      * \throws sharg::design_error if the option identifier is not a valid identifier.
+     * \throws sharg::design_error if `config.resource` is set for a non-integral option or for a second option.
      *
      * \details
      * \stableapi{Since version 1.0.}
@@ -238,12 +271,12 @@ public:
     template <typename option_type, typename validator_type>
         requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
               && std::invocable<validator_type, option_type>
-    void add_option(option_type & value, config<validator_type> const & config)
+    void add_option(option_type & value, config<validator_type> config)
     {
         check_parse_not_called("add_option");
-        verify_option_config(config);
+        verify_option_config<option_type>(config);
 
-        auto operation = [this, &value, config]()
+        auto operation = [&value, config = std::move(config)](format_type & format)
         {
             auto visit_fn = [&value, &config](auto & f)
             {
@@ -253,7 +286,63 @@ public:
             std::visit(std::move(visit_fn), format);
         };
 
-        operations.push_back(std::move(operation));
+        operations.emplace_back(std::move(operation), resource);
+    }
+
+    /*!\brief Adds an option whose default value is only computed if it is needed.
+     *
+     * \tparam option_type See sharg::parser::add_option.
+     * \tparam validator_type See sharg::parser::add_option.
+     * \tparam default_provider_type A callable without arguments returning a value convertible to `option_type`.
+     *
+     * \param[in, out] value The variable in which to store the given command line argument or the default value.
+     * \param[in] config A configuration object to customise the sharg::parser behaviour. See sharg::config.
+     * \param[in] default_provider Computes the default value.
+     *
+     * \throws sharg::design_error if sharg::parser::parse was already called.
+     * \throws sharg::design_error if the option is required.
+     * \throws sharg::design_error if the option identifier was already used.
+     * \throws sharg::design_error if the option identifier is not a valid identifier.
+     * \throws sharg::design_error if `config.resource` is set for a non-integral option or for a second option.
+     *
+     * \details
+     *
+     * Use this overload if computing the default value is expensive, e.g. when it depends on the number of available
+     * cores or the size of an index. The `default_provider` is called
+     *
+     * - after parsing, if the option was not given on the command line. The returned value is assigned to `value`
+     *   without validating it.
+     * - when printing the help page (or exporting it), unless `config.default_message` is set.
+     *
+     * It is not called when the option was given on the command line, or when the version or copyright information is
+     * printed. The `default_provider` is copied into the parser.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    template <typename option_type, typename validator_type, typename default_provider_type>
+        requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
+              && std::invocable<validator_type, option_type> && std::invocable<default_provider_type const &>
+              && std::convertible_to<std::invoke_result_t<default_provider_type const &>, option_type>
+    void add_option(option_type & value, config<validator_type> config, default_provider_type default_provider)
+    {
+        check_parse_not_called("add_option");
+        verify_option_config<option_type>(config);
+
+        if (config.required)
+            throw design_error{"A required option cannot have a default provider."};
+
+        auto operation =
+            [&value, config = std::move(config), default_provider = std::move(default_provider)](format_type & format)
+        {
+            auto visit_fn = [&value, &config, &default_provider](auto & f)
+            {
+                f.add_option(value, config, default_provider);
+            };
+
+            std::visit(std::move(visit_fn), format);
+        };
+
+        operations.emplace_back(std::move(operation), resource);
     }
 
     /*!\brief Adds a flag to the sharg::parser.
@@ -271,7 +360,7 @@ public:
      */
     template <typename validator_type>
         requires std::invocable<validator_type, bool>
-    void add_flag(bool & value, config<validator_type> const & config)
+    void add_flag(bool & value, config<validator_type> config)
     {
         check_parse_not_called("add_flag");
         verify_flag_config(config);
@@ -279,7 +368,7 @@ public:
         if (value)
             throw design_error("A flag's default value must be false.");
 
-        auto operation = [this, &value, config]()
+        auto operation = [&value, config = std::move(config)](format_type & format)
         {
             auto visit_fn = [&value, &config](auto & f)
             {
@@ -289,7 +378,7 @@ public:
             std::visit(std::move(visit_fn), format);
         };
 
-        operations.push_back(std::move(operation));
+        operations.emplace_back(std::move(operation), resource);
     }
 
     /*!\brief Adds a positional option to the sharg::parser.
@@ -322,7 +411,7 @@ public:
     template <typename option_type, typename validator_type>
         requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
               && std::invocable<validator_type, option_type>
-    void add_positional_option(option_type & value, config<validator_type> const & config)
+    void add_positional_option(option_type & value, config<validator_type> config)
     {
         check_parse_not_called("add_positional_option");
         verify_positional_option_config(config);
@@ -330,7 +419,7 @@ public:
         if constexpr (detail::is_container_option<option_type>)
             has_positional_list_option = true; // keep track of a list option because there must be only one!
 
-        auto operation = [this, &value, config]()
+        auto operation = [&value, config = std::move(config)](format_type & format)
         {
             auto visit_fn = [&value, &config](auto & f)
             {
@@ -340,7 +429,117 @@ public:
             std::visit(std::move(visit_fn), format);
         };
 
-        operations.push_back(std::move(operation));
+        operations.emplace_back(std::move(operation), resource);
+    }
+
+    /*!\brief Adds the option `--config` to read option values from a configuration file.
+     * \param[in] default_files The files that are read if `--config` is not given. The first existing file is used.
+     * \throws sharg::design_error if sharg::parser::parse was already called.
+     * \throws sharg::design_error if the identifier `config` was already used.
+     *
+     * \details
+     *
+     * The configuration file is merged with the command line: An option or flag is only read from the file if neither
+     * of its identifiers was given on the command line and its sharg::config::environment_variable is not set. Values
+     * from the file are parsed and validated like values given on the command line, and count as given for
+     * sharg::parser::is_option_set.
+     *
+     * Each line of the file is one of the following:
+     *
+     * * `key = value` sets the option with the long identifier `key`. Repeat the line to give multiple values to a
+     *   container option.
+     * * `key = [value, value]` gives multiple values to a container option.
+     * * `key = true` (or `1`) sets the flag with the long identifier `key`; `false` (or `0`) leaves it unset.
+     * * `[name]` starts the section of the subcommand `name`, e.g. `[build]` or `[build.index]` for nested
+     *   subcommands. Keys before the first section belong to the top-level parser.
+     * * `# comment` or `; comment`, or an empty line.
+     *
+     * Values can be quoted with `"` (supports the escape sequences `\\`, `\"`, `\n`, `\t` and `\r`) or `'` (taken
+     * literally); unquoted values end at a `#`. Only options with a long identifier can be set. Unknown keys and
+     * syntax errors are reported like errors on the command line.
+     *
+     * A sub-parser created by sharg::parser::get_sub_parser reads its section from the same file. It only needs to
+     * call this function itself to accept `--config` after the subcommand.
+     *
+     * ### Example
+     *
+     * \include test/snippet/config_file.cpp
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void add_config_file_option(std::vector<std::filesystem::path> default_files = {})
+    {
+        check_parse_not_called("add_config_file_option");
+
+        if (id_exists(std::string{"config"}))
+            throw design_error{"Long identifier 'config' was already used before."};
+
+        config_file_option_enabled = true;
+        default_config_files = std::move(default_files);
+
+        auto operation = [files = default_config_files](format_type & format)
+        {
+            auto visit_fn = [&files](auto & f)
+            {
+                if constexpr (requires { f.add_config_file_option(files); })
+                    f.add_config_file_option(files);
+            };
+
+            std::visit(std::move(visit_fn), format);
+        };
+
+        operations.emplace_back(std::move(operation), resource);
+    }
+
+    /*!\brief Adds the option `--import-params` to read option values from a CTD file or a CWL job file.
+     * \throws sharg::design_error if sharg::parser::parse was already called or if the long identifier
+     *         `import-params` is already used.
+     *
+     * \details
+     *
+     * Workflow systems like KNIME or CWL runners describe a tool with the files created by `--export-help ctd` and
+     * `--export-help cwl`, and store the chosen values in a CTD file or a CWL job file (YAML or JSON). With
+     * `--import-params file`, the tool reads such a file directly. The parameter names are the ones of the export,
+     * i.e. the long identifier of an option or flag and `positional_<i>` for the i-th positional option (counted
+     * from 0).
+     *
+     * * Options and flags that are given on the command line take precedence over the file. The values from the file
+     *   take precedence over environment variables (sharg::config::environment_variable) and the configuration file
+     *   (sharg::parser::add_config_file_option).
+     * * The positional options are only read from the file if no positional argument is given on the command line.
+     * * Parameters with an empty value or the value `null` are ignored. Flags accept true (1) and false (0).
+     * * The parameters of a subcommand are read from the node (CTD) or mapping (CWL) named after the subcommand.
+     *
+     * The format is detected from the contents of the file. See sharg::detail::parameter_file for the supported
+     * subset of XML and YAML. Unknown parameters and invalid values are reported like errors on the command line.
+     *
+     * ### Example
+     *
+     * \include test/snippet/import_params.cpp
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void add_import_params_option()
+    {
+        check_parse_not_called("add_import_params_option");
+
+        if (id_exists(std::string{"import-params"}))
+            throw design_error{"Long identifier 'import-params' was already used before."};
+
+        import_params_option_enabled = true;
+
+        auto operation = [](format_type & format)
+        {
+            auto visit_fn = [](auto & f)
+            {
+                if constexpr (requires { f.add_import_params_option(); })
+                    f.add_import_params_option();
+            };
+
+            std::visit(std::move(visit_fn), format);
+        };
+
+        operations.emplace_back(std::move(operation), resource);
     }
     //!\}
 
@@ -360,6 +559,9 @@ public:
      *
      * \details
      *
+     * The exception describes the first error in the user input. To get all errors without exceptions, use
+     * sharg::parser::try_parse.
+     *
      * When no specific key words are supplied, the sharg::parser
      * starts to process the command line for specified options, flags and
      * positional options.
@@ -369,10 +571,18 @@ public:
      *
      * - **-h/\--help** Prints the help page.
      * - **-hh/\--advanced-help** Prints the help page including advanced options.
+     * - <b>\--help=pattern</b> Prints only the options, flags, list items and lines whose identifiers or description
+     *   contain the pattern (ignoring case), including advanced options. <b>\--help-section=name</b> prints only
+     *   the elements of the sections and subsections whose title contains the name. Both can be combined.
      * - <b>\--version</b> Prints the version information.
-     * - <b>\--export-help [format]</b> Prints the application description in the given format (html/man/ctd).
+     * - <b>\--export-help [format]</b> Prints the application description in the given format
+     *   (html/man/ctd/cwl/json), or a completion script for the given shell (bash/zsh/fish). With
+     *   <b>\--all-subcommands</b>, the descriptions of all subcommands are printed as well (see
+     *   sharg::parser::set_subcommand_setup).
      * - <b>\--version-check false/0/true/1</b> Disable/enable update notifications.
      *
+     * To write the output to a stream and return instead of exiting, use sharg::parser::parse(std::ostream &).
+     *
      * Example:
      *
      * \include test/snippet/parser_2.cpp
@@ -413,30 +623,73 @@ public:
      */
     void parse()
     {
-        if (parse_was_called)
-            throw design_error("The function parse() must only be called once!");
-
-        parse_was_called = true;
-
-        // User input sanitization must happen before version check!
-        verify_app_and_subcommand_names();
-
-        // Determine the format and subcommand.
-        determine_format_and_subcommand();
+        parse_impl(true, nullptr).value();
+    }
 
-        // Apply all defered operations to the parser, e.g., `add_option`, `add_flag`, `add_positional_option`.
-        for (auto & operation : operations)
-            operation();
+    /*!\brief Initiates the actual command line parsing without terminating the program on special options.
+     * \param[out] stream The stream the output of special options like `--help` is written to.
+     * \returns Whether the command line was parsed or which output was written to `stream`.
+     * \throws sharg::design_error if this function was already called before.
+     * \throws sharg::parser_error and its derived exceptions like sharg::parser::parse.
+     *
+     * \details
+     *
+     * This function behaves like sharg::parser::parse, but the help page, the version and copyright information, and
+     * the exported application description are written to `stream` and this function returns instead of calling
+     * `std::exit`. The option values are only set if sharg::parse_status::parsed is returned.
+     *
+     * This allows hosting an application in a long-running process, e.g. a job server, that answers `--help`
+     * requests without restarting. Such hosts usually construct the parser with sharg::update_notifications::off.
+     *
+     * \include test/snippet/parse_status.cpp
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    parse_status parse(std::ostream & stream)
+    {
+        parse_impl(true, &stream).value();
 
-        // The version check, which might exit the program, must be called before calling parse on the format.
-        run_version_check();
+        auto status_fn = []<typename format_t>(format_t const &)
+        {
+            if constexpr (std::same_as<format_t, detail::format_version>)
+                return parse_status::version_printed;
+            else if constexpr (std::same_as<format_t, detail::format_copyright>)
+                return parse_status::copyright_printed;
+            else if constexpr (std::same_as<format_t, detail::format_html> || std::same_as<format_t, detail::format_man>
+                               || std::same_as<format_t, detail::format_tdl>
+                               || std::same_as<format_t, detail::format_json>
+                               || std::same_as<format_t, detail::format_completion>
+                               || std::same_as<format_t, detail::format_fingerprint>)
+                return parse_status::exported;
+            else if constexpr (std::derived_from<format_t, detail::format_help>) // format_help and format_short_help
+                return parse_status::help_printed;
+            else
+                return parse_status::parsed;
+        };
 
-        // Parse the command line arguments.
-        parse_format();
+        return std::visit(std::move(status_fn), format);
+    }
 
-        // Exit after parsing any special format.
-        if (!std::holds_alternative<detail::format_parse>(format))
-            std::exit(EXIT_SUCCESS);
+    /*!\brief Initiates the actual command line parsing without throwing on user errors.
+     * \returns A sharg::parse_result holding a sharg::diagnostic for each error in the user input.
+     * \throws sharg::design_error if the parser was set up incorrectly or try_parse() or parse() was called before.
+     *
+     * \details
+     *
+     * This function behaves like sharg::parser::parse, but instead of throwing the first sharg::parser_error, it
+     * continues parsing and returns all errors it found. Special options like `--help` still terminate the program.
+     * The value of an option is not validated if it could not be parsed.
+     *
+     * The messages are only created when calling sharg::diagnostic::message. sharg::parser::parse throws the
+     * exception of the first diagnostic.
+     *
+     * \include test/snippet/try_parse.cpp
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    parse_result try_parse()
+    {
+        return parse_impl(false, nullptr);
     }
 
     /*!\brief Returns a reference to the sub-parser instance if
@@ -464,10 +717,13 @@ public:
      * \details
      *
      * You can only ask for option identifiers that were added to the parser beforehand via
-     * `sharg::parser::add_option`.
+     * `sharg::parser::add_option` or `sharg::parser::add_flag`.
      * As in the `sharg::parser::add_option` call, pass short identifiers as a `char` and long identifiers
      * as a `std::string` or a type that a `std::string` is constructible from (e.g. a `const char *`).
      *
+     * The identifiers are recorded while parsing, i.e. this function does not search the command line.
+     * See also sharg::parser::occurrences and sharg::parser::positions.
+     *
      * ### Example
      *
      * \include test/snippet/is_option_set.cpp
@@ -489,31 +745,147 @@ public:
         requires std::same_as<id_type, char> || std::constructible_from<std::string, id_type>
     bool is_option_set(id_type const & id) const
     // clang-format on
+    {
+        return !positions(id).empty();
+    }
+
+    /*!\brief Returns how often the option or flag identifier (`id`) was given on the command line.
+     * \tparam id_type Either type `char` or a type that a `std::string` is constructible from.
+     * \param[in] id The short (`char`) or long (`std::string`) option identifier.
+     * \returns The number of times `id` was given; only counts the given identifier, not its counterpart.
+     * \throws sharg::design_error if the function is used incorrectly (see sharg::parser::is_option_set).
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    // clang-format off
+    template <typename id_type>
+        requires std::same_as<id_type, char> || std::constructible_from<std::string, id_type>
+    size_t occurrences(id_type const & id) const
+    // clang-format on
+    {
+        return positions(id).size();
+    }
+
+    /*!\brief Returns the positions in the command line at which the option or flag identifier (`id`) was given.
+     * \tparam id_type Either type `char` or a type that a `std::string` is constructible from.
+     * \param[in] id The short (`char`) or long (`std::string`) option identifier.
+     * \returns The indices in the arguments given to the parser (`argv`), in increasing order.
+     * \throws sharg::design_error if the function is used incorrectly (see sharg::parser::is_option_set).
+     *
+     * \details
+     *
+     * Index 0 is the executable name, e.g. for `./app -i 1 --int 2`, the positions of `'i'` are `[1]` and the positions
+     * of `"int"` are `[3]`. The positions refer to the identifiers, not their values. Several short flags given in a
+     * single argument (`-xyz`) share the same position. The positions in a sub-parser refer to its own arguments, i.e.
+     * the subcommand has index 0.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    // clang-format off
+    template <typename id_type>
+        requires std::same_as<id_type, char> || std::constructible_from<std::string, id_type>
+    std::span<size_t const> positions(id_type const & id) const
+    // clang-format on
     {
         if (!parse_was_called)
             throw design_error{"You can only ask which options have been set after calling the function `parse()`."};
 
-        // the detail::format_parse::find_option_id call in the end expects either a char or std::string
-        using char_or_string_t = std::conditional_t<std::same_as<id_type, char>, char, std::string>;
-        char_or_string_t short_or_long_id = {id}; // e.g. convert char * to string here if necessary
-
-        if constexpr (!std::same_as<id_type, char>) // long id was given
+        if constexpr (std::same_as<id_type, char>)
+        {
+            return recorded_positions(std::string_view{&id, 1u});
+        }
+        else
         {
-            if (short_or_long_id.size() == 1)
+            auto long_id_positions = [this](std::string_view const long_id)
             {
-                throw design_error{"Long option identifiers must be longer than one character! If " + short_or_long_id
-                                   + "' was meant to be a short identifier, please pass it as a char ('') not a string"
-                                     " (\"\")!"};
-            }
+                if (long_id.size() == 1u)
+                {
+                    throw design_error{"Long option identifiers must be longer than one character! If "
+                                       + std::string{long_id}
+                                       + "' was meant to be a short identifier, please pass it as a char ('') not a "
+                                         "string (\"\")!"};
+                }
+
+                return recorded_positions(long_id);
+            };
+
+            if constexpr (std::convertible_to<id_type const &, std::string_view>)
+                return long_id_positions(id);
+            else
+                return long_id_positions(std::string{id}); // e.g. a type that is only constructible to std::string
+        }
+    }
+
+    /*!\brief Returns the parsed option values as a binary blob that sharg::parser::deserialise can restore.
+     * \returns The values of all options, flags and positional options, and the positions of the identifiers.
+     * \throws sharg::design_error if sharg::parser::parse was not called or did not parse the command line.
+     *
+     * \details
+     *
+     * A worker process that sets up the same options as this parser can restore the values without receiving and
+     * validating the command line again. The blob starts with a format version, the application name and its version,
+     * and stores the type and the validator description of each option, such that a blob is only restored by a
+     * matching parser. The values of a sub-parser are not contained and must be serialised by the sub-parser.
+     *
+     * Option types can control their representation by specialising sharg::custom::parsing.
+     *
+     * ### Example
+     *
+     * \include test/snippet/serialise.cpp
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    std::string serialise() const
+    {
+        detail::format_parse const * parsed = std::get_if<detail::format_parse>(&format);
+
+        if (!parse_was_called || parsed == nullptr)
+        {
+            throw design_error{"You can only serialise the parser after the function `parse()` parsed the command "
+                               "line."};
         }
 
-        if (!used_ids.contains(std::string{id}))
-            throw design_error{"You can only ask for option identifiers that you added with add_option() before."};
+        format_type target{std::in_place_type<detail::format_serialise>, *parsed, info};
+
+        for (auto & operation : operations)
+            operation(target);
+
+        return std::get<detail::format_serialise>(target).finish();
+    }
+
+    /*!\brief Restores the option values from a blob created by sharg::parser::serialise, instead of parsing.
+     * \param[in] blob The serialised parser state.
+     * \throws sharg::design_error if sharg::parser::parse or sharg::parser::deserialise was already called.
+     * \throws sharg::deserialisation_error if the blob is corrupt, or was created by another application or
+     *         application version, or by a parser with different options.
+     *
+     * \details
+     *
+     * The values are written to the variables that were bound with sharg::parser::add_option,
+     * sharg::parser::add_flag and sharg::parser::add_positional_option. Validators are not called again.
+     * Afterwards, the parser behaves as if sharg::parser::parse was called, e.g. sharg::parser::is_option_set
+     * can be used. A blob can only be restored in full; if an exception is thrown, some variables may already have been
+     * overwritten.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void deserialise(std::string_view const blob)
+    {
+        check_parse_not_called("deserialise");
+        parse_was_called = true;
+
+        format = detail::format_parse{detail::format_parse::argument_list{resource},
+                                      std::pmr::vector<size_t>{resource}};
+        format_type source{std::in_place_type<detail::format_serialise>,
+                           blob,
+                           info,
+                           std::get<detail::format_parse>(format)};
 
-        // we only need to search for an option before the `option_end_identifier` (`--`)
-        auto option_end = std::find(format_arguments.begin(), format_arguments.end(), option_end_identifier);
-        auto option_it = detail::format_parse::find_option_id(format_arguments.begin(), option_end, short_or_long_id);
-        return option_it != option_end;
+        for (auto & operation : operations)
+            operation(source);
+
+        std::get<detail::format_serialise>(source).finish();
     }
 
     //!\name Structuring the Help Page
@@ -533,7 +905,7 @@ public:
     {
         check_parse_not_called("add_section");
 
-        auto operation = [this, title, advanced_only]()
+        auto operation = [title, advanced_only](format_type & format)
         {
             auto visit_fn = [&title, advanced_only](auto & f)
             {
@@ -543,7 +915,7 @@ public:
             std::visit(std::move(visit_fn), format);
         };
 
-        operations.push_back(std::move(operation));
+        operations.emplace_back(std::move(operation), resource);
     }
 
     /*!\brief Adds an help page subsection to the sharg::parser.
@@ -560,7 +932,7 @@ public:
     {
         check_parse_not_called("add_subsection");
 
-        auto operation = [this, title, advanced_only]()
+        auto operation = [title, advanced_only](format_type & format)
         {
             auto visit_fn = [&title, advanced_only](auto & f)
             {
@@ -570,7 +942,7 @@ public:
             std::visit(std::move(visit_fn), format);
         };
 
-        operations.push_back(std::move(operation));
+        operations.emplace_back(std::move(operation), resource);
     }
 
     /*!\brief Adds an help page text line to the sharg::parser.
@@ -588,7 +960,7 @@ public:
     {
         check_parse_not_called("add_line");
 
-        auto operation = [this, text, is_paragraph, advanced_only]()
+        auto operation = [text, is_paragraph, advanced_only](format_type & format)
         {
             auto visit_fn = [&text, is_paragraph, advanced_only](auto & f)
             {
@@ -598,7 +970,7 @@ public:
             std::visit(std::move(visit_fn), format);
         };
 
-        operations.push_back(std::move(operation));
+        operations.emplace_back(std::move(operation), resource);
     }
 
     /*!\brief Adds an help page list item (key-value) to the sharg::parser.
@@ -625,7 +997,7 @@ public:
     {
         check_parse_not_called("add_list_item");
 
-        auto operation = [this, key, desc, advanced_only]()
+        auto operation = [key, desc, advanced_only](format_type & format)
         {
             auto visit_fn = [&key, &desc, advanced_only](auto & f)
             {
@@ -635,7 +1007,7 @@ public:
             std::visit(std::move(visit_fn), format);
         };
 
-        operations.push_back(std::move(operation));
+        operations.emplace_back(std::move(operation), resource);
     }
 
     /*!\brief Adds subcommands to the parser.
@@ -658,6 +1030,49 @@ public:
         auto const [first, last] = std::ranges::unique(parser_subcommands);
         parser_subcommands.erase(first, last);
     }
+
+    /*!\brief Sets the function that adds the options of a sub-parser and enables `--all-subcommands`.
+     * \param[in] setup Adds the options, flags and positional options to the sub-parser it is called with.
+     * \throws sharg::design_error if sharg::parser::parse was already called.
+     *
+     * \details
+     *
+     * The options of a sub-parser are usually added by the application after the top-level parser returned. To
+     * export the descriptions of all subcommands with a single call, e.g. the CWL files, the top-level parser needs
+     * to set up each sub-parser itself. With `--export-help <format> --all-subcommands`, the top-level parser prints
+     * its own description, then creates the sub-parser of each subcommand as if it was called with
+     * `--export-help <format>`, calls `setup` with it and prints its description.
+     *
+     * `setup` is the function the application uses to set up a sub-parser anyway; it must not parse the sub-parser.
+     * The subcommand can be distinguished by the sharg::parser_meta_data::app_name of the sub-parser, e.g.
+     * `app-build`. The descriptions are printed in the order of the subcommands. JSON descriptions are printed as a
+     * JSON array, CWL documents are separated by `---` and completion scripts by an empty line.
+     *
+     * ### Example
+     *
+     * \include test/snippet/all_subcommands.cpp
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void set_subcommand_setup(std::function<void(parser &)> setup)
+    {
+        check_parse_not_called("set_subcommand_setup");
+
+        subcommand_setup = std::move(setup);
+
+        auto operation = [](format_type & format)
+        {
+            auto visit_fn = [](auto & f)
+            {
+                if constexpr (requires { f.add_all_subcommands_option(); })
+                    f.add_all_subcommands_option();
+            };
+
+            std::visit(std::move(visit_fn), format);
+        };
+
+        operations.emplace_back(std::move(operation), resource);
+    }
     //!\}
 
     /*!\brief Aggregates all parser related meta data (see sharg::parser_meta_data struct).
@@ -713,12 +1128,21 @@ public:
     parser_meta_data info;
 
 private:
+    //!\brief The memory resource for the internal bookkeeping. Declared first, because the other members use it.
+    std::pmr::memory_resource * resource{std::pmr::get_default_resource()};
+
     //!\brief Keeps track of whether the parse function has been called already.
     bool parse_was_called{false};
 
     //!\brief Keeps track of whether the user has added a positional list option to check if this was the very last.
     bool has_positional_list_option{false};
 
+    //!\brief Whether an option is the number of threads. See sharg::config::resource.
+    bool has_thread_count_option{false};
+
+    //!\brief Whether an option is the memory budget. See sharg::config::resource.
+    bool has_memory_budget_option{false};
+
     //!\brief Set on construction and indicates whether the developer deactivates the version check calls completely.
     update_notifications version_check_dev_decision{};
 
@@ -731,18 +1155,26 @@ private:
     //!\brief The future object that keeps track of the detached version check call thread.
     std::future<bool> version_check_future;
 
-    //!\brief Validates the application name to ensure an escaped server call.
-    std::regex app_name_regex{"^[a-zA-Z0-9_-]+$"};
-
-    //!\brief Signals the parser that no options follow this string but only positional arguments.
-    static constexpr std::string_view const option_end_identifier{"--"};
-
     //!\brief Stores the sub-parser in case \link subcommand_parse subcommand parsing \endlink is enabled.
     std::unique_ptr<parser> sub_parser{nullptr};
 
     //!\brief Stores the sub-parser names in case \link subcommand_parse subcommand parsing \endlink is enabled.
     std::vector<std::string> subcommands{};
 
+    //!\brief The formats the deferred operations can be applied to.
+    using format_type = std::variant<detail::format_parse,
+                                     detail::format_help,
+                                     detail::format_short_help,
+                                     detail::format_version,
+                                     detail::format_html,
+                                     detail::format_man,
+                                     detail::format_tdl,
+                                     detail::format_copyright,
+                                     detail::format_serialise,
+                                     detail::format_fingerprint,
+                                     detail::format_json,
+                                     detail::format_completion>;
+
     /*!\brief The format of the parser that decides the behavior when
      *        calling the sharg::parser::parse function.
      *
@@ -750,42 +1182,104 @@ private:
      *
      * The format is set in the function parser::init.
      */
-    std::variant<detail::format_parse,
-                 detail::format_help,
-                 detail::format_short_help,
-                 detail::format_version,
-                 detail::format_html,
-                 detail::format_man,
-                 detail::format_tdl,
-                 detail::format_copyright>
-        format{detail::format_short_help{}};
+    format_type format{detail::format_short_help{}};
+
+    /*!\brief The name of the special format in sharg::detail::embedded_exports, e.g. `help` or `cwl`; empty if the
+     *        format cannot be embedded.
+     */
+    std::string_view embedded_export_key{};
+
+    //!\brief The position of `--all-subcommands` in parser::arguments, if given. See parser::export_subcommands.
+    std::optional<size_t> all_subcommands_argument_index{};
+
+    //!\brief Sets up the sub-parsers for `--all-subcommands`. See sharg::parser::set_subcommand_setup.
+    std::function<void(parser &)> subcommand_setup{};
 
     //!\brief List of option/flag identifiers (excluding -/--) that are already used.
-    std::unordered_set<std::string> used_ids{"h", "hh", "help", "advanced-help", "export-help", "version", "copyright"};
+    std::pmr::unordered_set<std::pmr::string, detail::string_view_hash, detail::string_view_equal> used_ids{
+        {"h", "hh", "help", "advanced-help", "help-section", "export-help", "all-subcommands", "version", "copyright"},
+        0u,
+        detail::string_view_hash{},
+        detail::string_view_equal{},
+        resource};
 
     //!\brief The command line arguments that will be passed to the format.
-    std::vector<std::string> format_arguments{};
+    detail::format_parse::argument_list format_arguments{resource};
+
+    //!\brief The index in parser::arguments of each of the parser::format_arguments.
+    std::pmr::vector<size_t> format_argument_indices{resource};
+
+    //!\brief The diagnostics recorded by parser::try_parse.
+    std::vector<diagnostic> diagnostics{};
 
     //!\brief The original command line arguments.
-    std::vector<std::string> arguments{};
+    detail::format_parse::argument_list arguments{resource};
 
     //!\brief The command that lead to calling this parser, e.g. [./build/bin/raptor, build]
     std::vector<std::string> executable_name{};
 
     //!\brief Set of option identifiers (including -/--) that have been added via `add_option`.
-    std::unordered_set<std::string> options{};
+    std::pmr::unordered_set<std::pmr::string, detail::string_view_hash, detail::string_view_equal> options{resource};
+
+    //!\brief Set of long flag identifiers (excluding --) that have been added via `add_flag`.
+    std::pmr::unordered_set<std::pmr::string, detail::string_view_hash, detail::string_view_equal> flag_ids{resource};
+
+    //!\brief The identifiers (including -/--) of options and flags by sharg::config::environment_variable.
+    std::pmr::unordered_map<std::pmr::string, std::pmr::string, detail::string_view_hash, detail::string_view_equal>
+        environment_bindings{resource};
+
+    //!\brief The names and values of the variables in parser::environment_bindings that are set.
+    std::pmr::vector<std::pair<std::pmr::string, std::pmr::string>> environment_values{resource};
+
+    //!\brief Whether the environment variable SHARG_NO_VERSION_CHECK is set.
+    bool version_check_disabled_by_environment{false};
+
+    //!\brief The identifiers (including -/--) of options and flags whose value was read from a parameter file or an
+    //!       environment variable. Values from sources with lower precedence are ignored for these.
+    std::pmr::unordered_set<std::pmr::string, detail::string_view_hash, detail::string_view_equal> fallback_ids{
+        resource};
+
+    //!\brief The values from a parameter file, the environment and the configuration file.
+    detail::format_parse::argument_list fallback_arguments{resource};
+
+    //!\brief Whether sharg::parser::add_config_file_option was called.
+    bool config_file_option_enabled{false};
+
+    //!\brief The configuration files that are read if `--config` is not given.
+    std::vector<std::filesystem::path> default_config_files{};
+
+    //!\brief The configuration file given with `--config` or inherited from the top-level parser.
+    std::optional<std::filesystem::path> config_file_path{};
+
+    //!\brief The index in parser::arguments of the value of `--config`; sharg::diagnostic::npos if not given.
+    size_t config_file_argument_index{diagnostic::npos};
+
+    //!\brief Whether sharg::parser::add_import_params_option was called.
+    bool import_params_option_enabled{false};
+
+    //!\brief The parameter file given with `--import-params` or inherited from the top-level parser.
+    std::optional<std::filesystem::path> import_params_path{};
+
+    //!\brief The index in parser::arguments of the value of `--import-params`; sharg::diagnostic::npos if not given.
+    size_t import_params_argument_index{diagnostic::npos};
+
+    //!\brief The values of the positional options from the parameter file. See parser::read_import_params.
+    detail::format_parse::argument_list fallback_positional_arguments{resource};
 
     //!\brief Vector of functions that stores all calls.
-    std::vector<std::function<void()>> operations;
+    std::pmr::vector<detail::pmr_function<void(format_type &)>> operations{resource};
 
     /*!\brief Handles format and subcommand detection.
-     * \throws sharg::too_few_arguments if option --export-help was specified without a value
-     * \throws sharg::too_few_arguments if option --version-check was specified without a value
-     * \throws sharg::validation_error if the value passed to option --export-help was invalid.
-     * \throws sharg::validation_error if the value passed to option --version-check was invalid.
-     * \throws sharg::user_input_error if the subcommand is unknown.
      * \details
      *
+     * A sharg::diagnostic is recorded and the detection is stopped if
+     * - option --export-help, --help-section or --version-check was specified without a value
+     *   (sharg::diagnostic_kind::too_few_arguments),
+     * - the value passed to option --export-help or --version-check was invalid
+     *   (sharg::diagnostic_kind::validation_error),
+     * - the subcommand is unknown (sharg::diagnostic_kind::user_input_error).
+     *
+     *
      * This function adds all command line parameters to the format_arguments member variable
      * to take advantage of the vector functionality later on. Additionally,
      * the format member variable is set, depending on which parameters are given
@@ -796,24 +1290,57 @@ private:
      * - **-h/\--help** sets the format to sharg::detail::format_help
      * - **-hh/\--advanced-help** sets the format to sharg::detail::format_help
      *                           and show_advanced_options to `true`.
+     * - <b>\--help=pattern</b> and <b>\--help-section=name</b> set the format to sharg::detail::format_help with a
+     *   sharg::detail::help_filter.
      * - <b>\--version</b> sets the format to sharg::detail::format_version.
      * - <b>\--export-help html</b> sets the format to sharg::detail::format_html.
      * - <b>\--export-help man</b> sets the format to sharg::detail::format_man.
      * - <b>\--export-help cwl</b> sets the format to sharg::detail::format_tdl{FileFormat::CWL}.
      * - <b>\--export-help ctd</b> sets the format to sharg::detail::format_tdl{FileFormat::CTD}.
+     * - <b>\--export-help json</b> sets the format to sharg::detail::format_json.
+     * - <b>\--export-help bash</b>, <b>zsh</b> and <b>fish</b> set the format to sharg::detail::format_completion.
      * - else the format is that to sharg::detail::format_parse
      *
-     * If `--export-help` is specified with a value other than html, man, cwl or ctd, an sharg::parser_error is thrown.
+     * <b>\--config file</b> sets the configuration file if sharg::parser::add_config_file_option was called. The file
+     * is read by parser::read_config_file.
+     *
+     * <b>\--import-params file</b> sets the parameter file if sharg::parser::add_import_params_option was called. The
+     * file is read by parser::read_import_params.
+     *
+     * If `--export-help` is specified with a value other than html, man, cwl, ctd, json, bash, zsh or fish, or if the
+     * requested format was compiled out (see `SHARG_HAS_EXPORT_HTML`, `SHARG_HAS_EXPORT_MAN` and `SHARG_HAS_TDL`), a
+     * sharg::diagnostic_kind::validation_error is recorded. The same holds for `--all-subcommands` without
+     * `--export-help`.
      */
     void determine_format_and_subcommand()
     {
         assert(!arguments.empty());
 
+        // The messages of these diagnostics do not depend on other information.
+        auto add_diagnostic = [this](diagnostic_kind const kind,
+                                     std::string option_id,
+                                     size_t const index,
+                                     std::string message)
+        {
+            diagnostics.emplace_back(kind,
+                                     std::move(option_id),
+                                     index,
+                                     std::string{arguments[index]},
+                                     [](diagnostic const &, std::string const & text)
+                                     {
+                                         return text;
+                                     },
+                                     std::move(message));
+        };
+
         auto it = arguments.begin();
         std::string_view arg{*it};
 
         executable_name.emplace_back(arg);
 
+        // --help=<pattern> and --help-section=<name> can be combined.
+        detail::help_filter help_filter{};
+
         // Helper function for reading the next argument. This makes it more obvious that we are
         // incrementing `it` (version-check, and export-help).
         auto read_next_arg = [this, &it, &arg]() -> bool
@@ -828,22 +1355,14 @@ private:
         };
 
         // Helper function for finding and processing subcommands.
-        auto found_subcommand = [this, &it, &arg]() -> bool
+        auto found_subcommand = [this, &it, &arg, &add_diagnostic]() -> bool
         {
             if (subcommands.empty())
                 return false;
 
             if (std::ranges::find(subcommands, arg) != subcommands.end())
             {
-                sub_parser = std::make_unique<parser>(info.app_name + "-" + arg.data(),
-                                                      std::vector<std::string>{it, arguments.end()},
-                                                      update_notifications::off);
-
-                // Add the original calls to the front, e.g. ["raptor"],
-                // s.t. ["raptor", "build"] will be the list after constructing the subparser
-                sub_parser->executable_name.insert(sub_parser->executable_name.begin(),
-                                                   executable_name.begin(),
-                                                   executable_name.end());
+                create_sub_parser(std::vector<std::string>(it, arguments.end()));
                 return true;
             }
             else
@@ -858,7 +1377,7 @@ private:
                         message += command + ", ";
                     message.replace(message.size() - 2, 2, "]. Use -h/--help for more information.");
 
-                    throw user_input_error{message};
+                    add_diagnostic(diagnostic_kind::user_input_error, {}, it - arguments.begin(), std::move(message));
                 }
             }
 
@@ -869,15 +1388,17 @@ private:
         for (; read_next_arg();)
         {
             // The argument is a known option.
-            if (options.contains(std::string{arg}))
+            if (options.contains(arg))
             {
                 // No futher checks are needed.
                 format_arguments.emplace_back(arg);
+                format_argument_indices.push_back(it - arguments.begin());
 
                 // Consume the next argument (the option value) if possible.
                 if (read_next_arg())
                 {
                     format_arguments.emplace_back(arg);
+                    format_argument_indices.push_back(it - arguments.begin());
                     continue;
                 }
                 else // Too few arguments. This is handled by format_parse.
@@ -887,25 +1408,61 @@ private:
             }
 
             // If we have a subcommand, all further arguments are passed to the subparser.
-            if (found_subcommand())
+            if (found_subcommand() || !diagnostics.empty())
                 break;
 
+            size_t const option_index = it - arguments.begin();
+
             if (arg == "-h" || arg == "--help")
             {
                 format = detail::format_help{subcommands, version_check_dev_decision, false};
+                embedded_export_key = "help";
             }
-            else if (arg == "-hh" || arg == "--advanced-help")
-            {
-                format = detail::format_help{subcommands, version_check_dev_decision, true};
-            }
-            else if (arg == "--version")
+            else if (arg.starts_with("--help="))
             {
-                format = detail::format_version{};
+                help_filter.pattern = arg.substr(std::string_view{"--help="}.size());
+                format = detail::format_help{subcommands, version_check_dev_decision, false, help_filter};
+                embedded_export_key = {};
             }
-            else if (arg == "--copyright")
+            else if (arg == "--help-section" || arg.starts_with("--help-section="))
             {
-                format = detail::format_copyright{};
-            }
+                arg.remove_prefix(std::string_view{"--help-section"}.size());
+
+                if (arg.empty()) // --help-section Options
+                {
+                    if (!read_next_arg())
+                    {
+                        add_diagnostic(diagnostic_kind::too_few_arguments,
+                                       "--help-section",
+                                       option_index,
+                                       "Option --help-section must be followed by a value.");
+                        break;
+                    }
+                }
+                else // --help-section=Options
+                {
+                    arg.remove_prefix(1u);
+                }
+
+                help_filter.section = arg;
+                format = detail::format_help{subcommands, version_check_dev_decision, false, help_filter};
+                embedded_export_key = {};
+            }
+            else if (arg == "-hh" || arg == "--advanced-help")
+            {
+                format = detail::format_help{subcommands, version_check_dev_decision, true};
+                embedded_export_key = "advanced-help";
+            }
+            else if (arg == "--version")
+            {
+                format = detail::format_version{};
+                embedded_export_key = "version";
+            }
+            else if (arg == "--copyright")
+            {
+                format = detail::format_copyright{};
+                embedded_export_key = "copyright";
+            }
             else if (arg == "--export-help" || arg.starts_with("--export-help="))
             {
                 arg.remove_prefix(std::string_view{"--export-help"}.size());
@@ -914,42 +1471,162 @@ private:
                 if (arg.empty())
                 {
                     if (!read_next_arg())
-                        throw too_few_arguments{"Option --export-help must be followed by a value."};
+                    {
+                        add_diagnostic(diagnostic_kind::too_few_arguments,
+                                       "--export-help",
+                                       option_index,
+                                       "Option --export-help must be followed by a value.");
+                        break;
+                    }
                 }
                 else // --export-help=man
                 {
                     arg.remove_prefix(1u);
                 }
 
-                if (arg == "html")
+                size_t const value_index = it - arguments.begin();
+                embedded_export_key = arg;
+
+                if (arg == "html" && SHARG_HAS_EXPORT_HTML)
                     format = detail::format_html{subcommands, version_check_dev_decision};
-                else if (arg == "man")
+                else if (arg == "man" && SHARG_HAS_EXPORT_MAN)
                     format = detail::format_man{subcommands, version_check_dev_decision};
-                else if (arg == "ctd")
+                else if (arg == "ctd" && SHARG_HAS_TDL)
                     format = detail::format_tdl{detail::format_tdl::FileFormat::CTD};
-                else if (arg == "cwl")
+                else if (arg == "cwl" && SHARG_HAS_TDL)
                     format = detail::format_tdl{detail::format_tdl::FileFormat::CWL};
+                else if (arg == "json")
+                    format = detail::format_json{subcommands};
+                else if (arg == "bash")
+                    format = detail::format_completion{detail::format_completion::shell::bash,
+                                                       subcommands,
+                                                       version_check_dev_decision};
+                else if (arg == "zsh")
+                    format = detail::format_completion{detail::format_completion::shell::zsh,
+                                                       subcommands,
+                                                       version_check_dev_decision};
+                else if (arg == "fish")
+                    format = detail::format_completion{detail::format_completion::shell::fish,
+                                                       subcommands,
+                                                       version_check_dev_decision};
+                else if (arg == "fingerprint") // Used by the CMake function sharg_embed_exports; not documented.
+                {
+                    format = detail::format_fingerprint{subcommands, version_check_dev_decision};
+                    embedded_export_key = {};
+                }
+                else if (arg == "html" || arg == "man" || arg == "ctd" || arg == "cwl")
+                    add_diagnostic(diagnostic_kind::validation_error,
+                                   "--export-help",
+                                   value_index,
+                                   detail::unavailable_export_message(arg));
                 else
-                    throw validation_error{"Validation failed for option --export-help: "
-                                           "Value must be one of "
-                                           + detail::supported_exports + "."};
+                    add_diagnostic(diagnostic_kind::validation_error,
+                                   "--export-help",
+                                   value_index,
+                                   "Validation failed for option --export-help: Value must be one of "
+                                       + detail::supported_exports + ".");
             }
             else if (arg == "--version-check")
             {
                 if (!read_next_arg())
-                    throw too_few_arguments{"Option --version-check must be followed by a value."};
+                {
+                    add_diagnostic(diagnostic_kind::too_few_arguments,
+                                   "--version-check",
+                                   option_index,
+                                   "Option --version-check must be followed by a value.");
+                    break;
+                }
 
                 if (arg == "1" || arg == "true")
                     version_check_user_decision = true;
                 else if (arg == "0" || arg == "false")
                     version_check_user_decision = false;
                 else
-                    throw validation_error{"Value for option --version-check must be true (1) or false (0)."};
+                    add_diagnostic(diagnostic_kind::validation_error,
+                                   "--version-check",
+                                   it - arguments.begin(),
+                                   "Value for option --version-check must be true (1) or false (0).");
+            }
+            else if (arg == "--all-subcommands" && subcommand_setup && !subcommands.empty())
+            {
+                all_subcommands_argument_index = option_index;
+            }
+            else if (config_file_option_enabled && (arg == "--config" || arg.starts_with("--config=")))
+            {
+                arg.remove_prefix(std::string_view{"--config"}.size());
+
+                // --config file.ini
+                if (arg.empty())
+                {
+                    if (!read_next_arg())
+                    {
+                        add_diagnostic(diagnostic_kind::too_few_arguments,
+                                       "--config",
+                                       option_index,
+                                       "Option --config must be followed by a value.");
+                        break;
+                    }
+                }
+                else // --config=file.ini
+                {
+                    arg.remove_prefix(1u);
+                }
+
+                config_file_path = std::filesystem::path{arg};
+                config_file_argument_index = it - arguments.begin();
+            }
+            else if (import_params_option_enabled && (arg == "--import-params" || arg.starts_with("--import-params=")))
+            {
+                arg.remove_prefix(std::string_view{"--import-params"}.size());
+
+                // --import-params job.yml
+                if (arg.empty())
+                {
+                    if (!read_next_arg())
+                    {
+                        add_diagnostic(diagnostic_kind::too_few_arguments,
+                                       "--import-params",
+                                       option_index,
+                                       "Option --import-params must be followed by a value.");
+                        break;
+                    }
+                }
+                else // --import-params=job.yml
+                {
+                    arg.remove_prefix(1u);
+                }
+
+                import_params_path = std::filesystem::path{arg};
+                import_params_argument_index = it - arguments.begin();
             }
             else
             {
                 // Flags, positional options, options using an alternative syntax (--optionValue, --option=value), etc.
                 format_arguments.emplace_back(arg);
+                format_argument_indices.push_back(option_index);
+            }
+
+            if (!diagnostics.empty())
+                break;
+        }
+
+        if (!diagnostics.empty())
+            return;
+
+        if (all_subcommands_argument_index)
+        {
+            bool const is_export = std::holds_alternative<detail::format_html>(format)
+                                || std::holds_alternative<detail::format_man>(format)
+                                || std::holds_alternative<detail::format_tdl>(format)
+                                || std::holds_alternative<detail::format_json>(format)
+                                || std::holds_alternative<detail::format_completion>(format);
+            if (!is_export)
+            {
+                add_diagnostic(diagnostic_kind::validation_error,
+                               "--all-subcommands",
+                               *all_subcommands_argument_index,
+                               "Option --all-subcommands can only be used together with --export-help.");
+                return;
             }
         }
 
@@ -957,10 +1634,395 @@ private:
         if (!std::holds_alternative<detail::format_short_help>(format))
             return;
 
-        // All special options have been handled. If there are arguments left or we have a subparser,
-        // we call format_parse. Oterhwise, we print the short help (default variant).
-        if (!format_arguments.empty() || sub_parser)
-            format = detail::format_parse(format_arguments);
+        read_import_params();
+        read_environment();
+
+        // All special options have been handled. If there are arguments left, values from a parameter file, the
+        // environment or a configuration file, or we have a subparser, we call format_parse. Oterhwise, we print the
+        // short help (default variant).
+        if (!format_arguments.empty() || !fallback_ids.empty() || !fallback_positional_arguments.empty()
+            || config_file_to_read().has_value() || import_params_path || sub_parser)
+        {
+            format = detail::format_parse(detail::format_parse::argument_list{format_arguments, resource},
+                                          std::pmr::vector<size_t>{format_argument_indices, resource});
+            read_config_file();
+
+            auto & parse_format = std::get<detail::format_parse>(format);
+            parse_format.set_fallback_arguments(fallback_arguments);
+            parse_format.set_fallback_positional_arguments(fallback_positional_arguments);
+        }
+    }
+
+    /*!\brief Creates the sub-parser of a subcommand.
+     * \param[in] sub_arguments The arguments of the sub-parser, starting with the subcommand.
+     */
+    void create_sub_parser(std::vector<std::string> sub_arguments)
+    {
+        std::string app_name = info.app_name + "-" + sub_arguments[0];
+        sub_parser = std::make_unique<parser>(std::move(app_name),
+                                              std::move(sub_arguments),
+                                              update_notifications::off,
+                                              std::vector<std::string>{},
+                                              resource);
+
+        // Add the original calls to the front, e.g. ["raptor"],
+        // s.t. ["raptor", "build"] will be the list after constructing the subparser
+        sub_parser->executable_name.insert(sub_parser->executable_name.begin(),
+                                           executable_name.begin(),
+                                           executable_name.end());
+        // The sub-parser reads its section of the same configuration file.
+        sub_parser->config_file_path = config_file_to_read();
+        sub_parser->import_params_path = import_params_path;
+    }
+
+    //!\brief Returns the file given with `--config`, or else the first existing default configuration file.
+    std::optional<std::filesystem::path> config_file_to_read() const
+    {
+        if (config_file_path)
+            return config_file_path;
+
+        for (std::filesystem::path const & file : default_config_files)
+        {
+            std::error_code error{};
+            if (std::filesystem::exists(file, error))
+                return file;
+        }
+
+        return std::nullopt;
+    }
+
+    /*!\brief Records a sharg::diagnostic for a value from the environment or the configuration file.
+     * \param[in] kind The kind of the error.
+     * \param[in] option_id The identifier of the option, if known.
+     * \param[in] index The index in `argv` the error refers to; sharg::diagnostic::npos for the environment.
+     * \param[in] value The offending value.
+     * \param[in] message The error message.
+     */
+    void add_fallback_diagnostic(diagnostic_kind const kind,
+                                 std::string option_id,
+                                 size_t const index,
+                                 std::string value,
+                                 std::string message)
+    {
+        diagnostics.emplace_back(kind,
+                                 std::move(option_id),
+                                 index,
+                                 std::move(value),
+                                 [](diagnostic const &, std::string const & text)
+                                 {
+                                     return text;
+                                 },
+                                 std::move(message));
+    }
+
+    /*!\brief Reads the parameter file given with `--import-params` into parser::fallback_arguments and
+     *        parser::fallback_positional_arguments.
+     * \details
+     *
+     * Only the parameters of this parser are read: The top-level parser reads all parameters that are not nested in
+     * a node named after one of its subcommands; a sub-parser reads the parameters of the node named after its
+     * subcommand (e.g. `build`) or its application name (e.g. `raptor-build`).
+     * A sharg::diagnostic is recorded if
+     * - the file cannot be read (sharg::diagnostic_kind::validation_error),
+     * - the file contains a syntax error or a flag with a value other than true/false
+     *   (sharg::diagnostic_kind::user_input_error),
+     * - a parameter is not the long identifier of an option or flag, or the name of a positional option
+     *   (sharg::diagnostic_kind::unknown_option).
+     */
+    void read_import_params()
+    {
+        if (!import_params_path)
+            return;
+
+        std::filesystem::path const & path = *import_params_path;
+
+        auto add_diagnostic = [this](diagnostic_kind const kind,
+                                     std::string option_id,
+                                     std::string value,
+                                     std::string message)
+        {
+            add_fallback_diagnostic(kind,
+                                    std::move(option_id),
+                                    import_params_argument_index,
+                                    std::move(value),
+                                    std::move(message));
+        };
+
+        auto belongs_to_this_parser = [this](std::vector<std::string> const & nodes)
+        {
+            if (executable_name.size() > 1u) // sub-parser
+                return !nodes.empty() && (nodes.back() == executable_name.back() || nodes.back() == info.app_name);
+
+            return nodes.empty()
+                || std::ranges::none_of(subcommands,
+                                        [this, &nodes](std::string const & command)
+                                        {
+                                            return nodes.back() == command
+                                                || nodes.back() == info.app_name + "-" + command;
+                                        });
+        };
+
+        // The name of the i-th positional option in the CTD and CWL export is `positional_<i>`.
+        auto positional_index = [](std::string_view name) -> std::optional<size_t>
+        {
+            if (!name.starts_with("positional_"))
+                return std::nullopt;
+
+            name.remove_prefix(std::string_view{"positional_"}.size());
+            size_t index{};
+            auto [ptr, error] = std::from_chars(name.data(), name.data() + name.size(), index);
+
+            if (name.empty() || error != std::errc{} || ptr != name.data() + name.size())
+                return std::nullopt;
+
+            return index;
+        };
+
+        try
+        {
+            detail::parameter_file const file{path};
+            detail::format_parse::argument_list values{resource};
+            std::map<size_t, std::vector<std::string> const *> positional_values{};
+
+            for (detail::parameter_file::entry const & entry : file.entries())
+            {
+                if (!belongs_to_this_parser(entry.path) || entry.values.empty())
+                    continue;
+
+                std::pmr::string id{"--", resource};
+                id += entry.name;
+
+                if (options.contains(id))
+                {
+                    fallback_ids.insert(id);
+
+                    for (std::string const & value : entry.values)
+                    {
+                        std::pmr::string & argument = values.emplace_back(id);
+                        argument += '=';
+                        argument += value;
+                    }
+                }
+                else if (flag_ids.contains(entry.name))
+                {
+                    fallback_ids.insert(id);
+                    std::string const & value = entry.values.front();
+
+                    if (value == "1" || value == "true")
+                        values.push_back(std::move(id));
+                    else if (value != "0" && value != "false")
+                        add_diagnostic(diagnostic_kind::user_input_error,
+                                       std::string{id},
+                                       value,
+                                       "Value for flag " + std::string{id} + " in the parameter file \""
+                                           + path.string() + "\" must be true (1) or false (0).");
+                }
+                else if (std::optional<size_t> const index = positional_index(entry.name))
+                {
+                    positional_values[*index] = &entry.values;
+                }
+                else
+                {
+                    add_diagnostic(diagnostic_kind::unknown_option,
+                                   {},
+                                   entry.name,
+                                   "Unknown option " + entry.name + " in the parameter file \"" + path.string()
+                                       + "\". See -h/--help for program information.");
+                }
+            }
+
+            fallback_arguments.insert(fallback_arguments.end(),
+                                      std::make_move_iterator(values.begin()),
+                                      std::make_move_iterator(values.end()));
+
+            for (auto const & [index, entry_values] : positional_values)
+                fallback_positional_arguments.insert(fallback_positional_arguments.end(),
+                                                     entry_values->begin(),
+                                                     entry_values->end());
+        }
+        catch (validation_error const & ex)
+        {
+            add_diagnostic(diagnostic_kind::validation_error,
+                           "--import-params",
+                           path.string(),
+                           std::string{"Validation failed for option --import-params: "} + ex.what());
+        }
+        catch (user_input_error const & ex)
+        {
+            add_diagnostic(diagnostic_kind::user_input_error, "--import-params", path.string(), ex.what());
+        }
+    }
+
+    /*!\brief Scans the environment once for the variables in parser::environment_bindings and for
+     *        SHARG_NO_VERSION_CHECK.
+     * \details
+     *
+     * Each variable is looked up in parser::environment_bindings, instead of calling `std::getenv` for each option
+     * and for the version check. The values are stored in parser::environment_values.
+     */
+    void snapshot_environment()
+    {
+        if (environment_bindings.empty() && version_check_dev_decision == update_notifications::off)
+            return;
+
+        detail::for_each_environment_variable(
+            [this](std::string_view const name, std::string_view const value)
+            {
+                if (name == "SHARG_NO_VERSION_CHECK")
+                    version_check_disabled_by_environment = true;
+
+                if (environment_bindings.contains(name))
+                    environment_values.emplace_back(std::pmr::string{name, resource},
+                                                    std::pmr::string{value, resource});
+            });
+    }
+
+    /*!\brief Reads the values of the options and flags bound to environment variables into parser::fallback_arguments.
+     * \details
+     *
+     * The values were collected by parser::snapshot_environment. They are written in the notation of the command
+     * line, e.g. `--threads=4`, s.t. sharg::detail::format_parse converts and validates them like command line
+     * arguments.
+     *
+     * A sharg::diagnostic_kind::user_input_error is recorded if a flag has a value other than true/false.
+     */
+    void read_environment()
+    {
+        for (auto const & [name, value] : environment_values)
+        {
+            std::pmr::string const & id = environment_bindings.find(name)->second;
+
+            if (!fallback_ids.insert(id).second) // The parameter file takes precedence.
+                continue;
+
+            if (options.contains(id))
+            {
+                std::pmr::string & argument = fallback_arguments.emplace_back(id);
+                argument += '=';
+                argument += value;
+            }
+            else if (value == "1" || value == "true")
+            {
+                fallback_arguments.emplace_back(id);
+            }
+            else if (value != "0" && value != "false")
+            {
+                add_fallback_diagnostic(diagnostic_kind::user_input_error,
+                                        std::string{id},
+                                        diagnostic::npos,
+                                        std::string{value},
+                                        "Value for flag " + std::string{id} + " in the environment variable "
+                                            + std::string{name} + " must be true (1) or false (0).");
+            }
+        }
+    }
+
+    /*!\brief Reads the configuration file and passes the values of the known options and flags to
+     *        sharg::detail::format_parse.
+     * \details
+     *
+     * Only the section of this parser is read, e.g. `build` for the sub-parser of `raptor build`.
+     * A sharg::diagnostic is recorded if
+     * - the file cannot be read (sharg::diagnostic_kind::validation_error),
+     * - the file contains a syntax error or a flag with a value other than true/false
+     *   (sharg::diagnostic_kind::user_input_error),
+     * - a key is not the long identifier of an option or flag (sharg::diagnostic_kind::unknown_option).
+     */
+    void read_config_file()
+    {
+        std::optional<std::filesystem::path> const path = config_file_to_read();
+
+        if (!path)
+            return;
+
+        auto add_diagnostic = [this](diagnostic_kind const kind,
+                                     std::string option_id,
+                                     std::string value,
+                                     std::string message)
+        {
+            add_fallback_diagnostic(kind, std::move(option_id), config_file_argument_index, std::move(value), message);
+        };
+
+        std::string section{};
+        for (size_t i = 1u; i < executable_name.size(); ++i)
+            section += (i == 1u ? "" : ".") + executable_name[i];
+
+        try
+        {
+            detail::config_file const file{*path};
+            detail::format_parse::argument_list values{resource};
+
+            for (detail::config_file::entry const & entry : file.entries())
+            {
+                if (entry.section != section)
+                    continue;
+
+                std::pmr::string id{"--", resource};
+                id += entry.key;
+
+                if (fallback_ids.contains(id)) // The parameter file and the environment take precedence.
+                    continue;
+
+                std::string const location = "in the configuration file \"" + path->string() + "\" in line "
+                                           + std::to_string(entry.line);
+
+                if (options.contains(id))
+                {
+                    id += '=';
+                    id += entry.value;
+                    values.push_back(std::move(id));
+                }
+                else if (flag_ids.contains(entry.key))
+                {
+                    if (entry.value == "1" || entry.value == "true")
+                        values.push_back(std::move(id));
+                    else if (entry.value != "0" && entry.value != "false")
+                        add_diagnostic(diagnostic_kind::user_input_error,
+                                       std::string{id},
+                                       std::string{entry.value},
+                                       "Value for flag " + std::string{id} + " " + location
+                                           + " must be true (1) or false (0).");
+                }
+                else
+                {
+                    add_diagnostic(diagnostic_kind::unknown_option,
+                                   {},
+                                   std::string{entry.key},
+                                   "Unknown option " + std::string{entry.key} + " " + location
+                                       + ". See -h/--help for program information.");
+                }
+            }
+
+            fallback_arguments.insert(fallback_arguments.end(),
+                                      std::make_move_iterator(values.begin()),
+                                      std::make_move_iterator(values.end()));
+        }
+        catch (validation_error const & ex)
+        {
+            add_diagnostic(diagnostic_kind::validation_error,
+                           "--config",
+                           path->string(),
+                           std::string{"Validation failed for option --config: "} + ex.what());
+        }
+        catch (user_input_error const & ex)
+        {
+            add_diagnostic(diagnostic_kind::user_input_error, "--config", path->string(), ex.what());
+        }
+    }
+
+    /*!\brief Returns the positions at which an identifier was given, as recorded by sharg::detail::format_parse.
+     * \param[in] id The short or long identifier without dashes.
+     * \throws sharg::design_error if the identifier was not added to the parser.
+     */
+    std::span<size_t const> recorded_positions(std::string_view const id) const
+    {
+        if (!used_ids.contains(id))
+            throw design_error{"You can only ask for option identifiers that you added with add_option() before."};
+
+        if (auto * parse_format = std::get_if<detail::format_parse>(&format))
+            return parse_format->positions(id);
+
+        return {};
     }
 
     /*!\brief Checks whether the long identifier has already been used before.
@@ -973,7 +2035,10 @@ private:
     {
         if (detail::format_parse::is_empty_id(id))
             return false;
-        return (!(used_ids.insert(std::string({id}))).second);
+        if constexpr (std::same_as<id_type, char>)
+            return !used_ids.emplace(std::string_view{&id, 1u}).second;
+        else
+            return !used_ids.emplace(std::string_view{id}).second;
     }
 
     /*!\brief Verifies that the short and the long identifiers are correctly formatted.
@@ -1018,18 +2083,42 @@ private:
     }
 
     //!brief Verify the configuration given to a sharg::parser::add_option call.
-    template <typename validator_t>
+    template <typename option_type, typename validator_t>
     void verify_option_config(config<validator_t> const & config)
     {
         verify_identifiers(config.short_id, config.long_id);
+        bind_environment_variable(config);
 
         if (config.short_id != '\0')
-            options.emplace(std::string{"-"} + config.short_id);
+        {
+            char const dashed_id[2]{'-', config.short_id};
+            options.emplace(std::string_view{dashed_id, 2u});
+        }
         if (!config.long_id.empty())
-            options.emplace(std::string{"--"} + config.long_id);
+        {
+            std::pmr::string dashed_id{"--", resource};
+            dashed_id += config.long_id;
+            options.insert(std::move(dashed_id));
+        }
 
         if (config.required && !config.default_message.empty())
             throw design_error{"A required option cannot have a default message."};
+
+        if (config.resource == resource_kind::none)
+            return;
+
+        if constexpr (!std::integral<option_type> || std::same_as<option_type, bool>)
+            throw design_error{"Only an integral option can control a resource (sharg::config::resource)."};
+
+        bool & has_resource_option =
+            (config.resource == resource_kind::threads) ? has_thread_count_option : has_memory_budget_option;
+
+        if (has_resource_option)
+            throw design_error{(config.resource == resource_kind::threads)
+                                   ? "Only one option can be the number of threads."
+                                   : "Only one option can be the memory budget."};
+
+        has_resource_option = true;
     }
 
     //!brief Verify the configuration given to a sharg::parser::add_flag call.
@@ -1037,9 +2126,16 @@ private:
     void verify_flag_config(config<validator_t> const & config)
     {
         verify_identifiers(config.short_id, config.long_id);
+        bind_environment_variable(config);
 
         if (!config.default_message.empty())
             throw design_error{"A flag may not have a default message because the default is always `false`."};
+
+        if (config.resource != resource_kind::none)
+            throw design_error{"A flag cannot control a resource (sharg::config::resource)."};
+
+        if (!config.long_id.empty())
+            flag_ids.emplace(config.long_id);
     }
 
     //!brief Verify the configuration given to a sharg::parser::add_positional_option call.
@@ -1062,6 +2158,31 @@ private:
 
         if (!config.default_message.empty())
             throw design_error{"A positional option may not have a default message because it is always required."};
+
+        if (!config.environment_variable.empty())
+            throw design_error{"A positional option cannot be bound to an environment variable."};
+
+        if (config.resource != resource_kind::none)
+            throw design_error{"A positional option cannot control a resource (sharg::config::resource)."};
+    }
+
+    /*!\brief Adds sharg::config::environment_variable to parser::environment_bindings, if given.
+     * \throws sharg::design_error if the environment variable was already bound to another option or flag.
+     */
+    template <typename validator_t>
+    void bind_environment_variable(config<validator_t> const & config)
+    {
+        if (config.environment_variable.empty())
+            return;
+
+        std::pmr::string id{config.long_id.empty() ? "-" : "--", resource};
+        if (config.long_id.empty())
+            id += config.short_id;
+        else
+            id += config.long_id;
+
+        if (!environment_bindings.emplace(std::string_view{config.environment_variable}, std::move(id)).second)
+            throw design_error{"Environment variable '" + config.environment_variable + "' was already used before."};
     }
 
     /*!\brief Throws a sharg::design_error if parse() was already called.
@@ -1088,9 +2209,21 @@ private:
      */
     inline void verify_app_and_subcommand_names() const
     {
+        // Equivalent to matching "^[a-zA-Z0-9_-]+$", but without constructing a std::regex for every parser.
+        auto is_valid_name = [](std::string_view const name)
+        {
+            return !name.empty()
+                && std::ranges::all_of(name,
+                                       [](char const c)
+                                       {
+                                           return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+                                               || (c >= '0' && c <= '9') || c == '_' || c == '-';
+                                       });
+        };
+
         // Before creating the detail::version_checker, we have to make sure that
         // malicious code cannot be injected through the app name.
-        if (!std::regex_match(info.app_name, app_name_regex))
+        if (!is_valid_name(info.app_name))
         {
             throw design_error{("The application name must only contain alpha-numeric characters or '_' and '-' "
                                 "(regex: \"^[a-zA-Z0-9_-]+$\").")};
@@ -1098,7 +2231,7 @@ private:
 
         for (auto & sub : this->subcommands)
         {
-            if (!std::regex_match(sub, app_name_regex))
+            if (!is_valid_name(sub))
             {
                 throw design_error{"The subcommand name must only contain alpha-numeric characters or '_' and '-' "
                                    "(regex: \"^[a-zA-Z0-9_-]+$\")."};
@@ -1106,6 +2239,22 @@ private:
         }
     }
 
+    /*!\brief Applies the settings of sharg::parser::info that are needed early and all deferred operations to `target`.
+     * \param[in, out] target The format to set up, e.g. sharg::parser::format.
+     */
+    void apply_operations(format_type & target) const
+    {
+        std::visit(
+            [this](auto & f)
+            {
+                f.default_message_element_limit = info.default_message_element_limit;
+            },
+            target);
+
+        for (auto & operation : operations)
+            operation(target);
+    }
+
     /*!\brief Runs the version check if the user has not disabled it.
      * \details
      * If the user has not disabled the version check, the function will start a detached thread that will call the
@@ -1113,9 +2262,15 @@ private:
      */
     inline void run_version_check()
     {
+        // Constructing the detail::version_checker is not free (it compiles a std::regex), so skip it if possible.
+        if (version_check_dev_decision == update_notifications::off)
+            return;
+
         detail::version_checker app_version{info.app_name, info.version, info.url};
 
-        if (app_version.decide_if_check_is_performed(version_check_dev_decision, version_check_user_decision))
+        if (app_version.decide_if_check_is_performed(version_check_dev_decision,
+                                                     version_check_user_decision,
+                                                     version_check_disabled_by_environment))
         {
             // must be done before calling parse on the format because this might std::exit
             std::promise<bool> app_version_prom;
@@ -1124,21 +2279,169 @@ private:
         }
     }
 
+    /*!\brief Looks up the output of the special format in the exports embedded at build time.
+     * \returns The embedded output, or `std::nullopt` if it must be rendered.
+     * \details
+     * See `sharg_embed_exports` in `sharg-config.cmake`. The embedded output is only used if the fingerprint of this
+     * parser (see sharg::detail::format_fingerprint) matches the fingerprint of the parser it was created with.
+     * Help pages and version information are rendered if the standard output is a terminal, because they are then
+     * highlighted and wrapped to the width of the terminal.
+     */
+    std::optional<std::string_view> find_embedded_export() const
+    {
+        if (detail::embedded_exports().empty() || embedded_export_key.empty()
+            || std::holds_alternative<detail::format_parse>(format))
+        {
+            return std::nullopt;
+        }
+
+        bool const is_help_page = std::holds_alternative<detail::format_help>(format)
+                               || std::holds_alternative<detail::format_version>(format)
+                               || std::holds_alternative<detail::format_copyright>(format);
+
+        if (is_help_page && detail::stdout_is_terminal())
+            return std::nullopt;
+
+        format_type target{std::in_place_type<detail::format_fingerprint>, subcommands, version_check_dev_decision};
+        apply_operations(target);
+
+        std::string command{};
+        for (std::string const & name : executable_name)
+            command += (command.empty() ? "" : " ") + name;
+
+        return detail::find_embedded_export(embedded_export_key,
+                                            std::get<detail::format_fingerprint>(target).finish(info),
+                                            command);
+    }
+
+    /*!\brief Implements sharg::parser::parse and sharg::parser::try_parse.
+     * \param[in] stop_at_first_error Whether to stop parsing at the first error. See sharg::detail::format_parse.
+     * \param[out] stream The stream special formats print to. If `nullptr`, they print to std::cout and the program
+     *                    exits afterwards.
+     * \returns The diagnostics of the errors that were found.
+     * \throws sharg::design_error if the parser was set up incorrectly or try_parse() or parse() was called before.
+     */
+    parse_result parse_impl(bool const stop_at_first_error, std::ostream * const stream)
+    {
+        if (parse_was_called)
+            throw design_error("The function parse() must only be called once!");
+
+        parse_was_called = true;
+
+        // User input sanitization must happen before version check!
+        verify_app_and_subcommand_names();
+
+        // Read the environment once, for the options and for the version check.
+        snapshot_environment();
+
+        // Determine the format and subcommand.
+        determine_format_and_subcommand();
+
+        // The format is not known if the special options were used incorrectly.
+        if (!diagnostics.empty())
+            return parse_result{std::move(diagnostics)};
+
+        // Output embedded at build time replaces rendering the special format.
+        std::optional<std::string_view> const embedded = find_embedded_export();
+
+        // Apply all defered operations to the parser, e.g., `add_option`, `add_flag`, `add_positional_option`.
+        if (!embedded)
+            apply_operations(format);
+
+        // The version check, which might exit the program, must be called before calling parse on the format.
+        run_version_check();
+
+        // With --all-subcommands, the description of the top-level parser is printed together with the others.
+        std::ostringstream top_level_page{};
+        std::ostream * const page_stream = all_subcommands_argument_index ? &top_level_page : stream;
+
+        // Parse the command line arguments.
+        if (embedded)
+        {
+            std::ostream & out = (page_stream != nullptr) ? *page_stream : std::cout;
+            out.write(embedded->data(), embedded->size());
+            out.flush();
+        }
+        else
+        {
+            parse_format(stop_at_first_error, page_stream);
+        }
+
+        if (all_subcommands_argument_index)
+            export_subcommands(top_level_page.str(), stream);
+
+        // Exit after parsing any special format, unless the output is written to a stream.
+        if (stream == nullptr && !std::holds_alternative<detail::format_parse>(format))
+            std::exit(EXIT_SUCCESS);
+
+        return parse_result{std::move(diagnostics)};
+    }
+
+    /*!\brief Prints the descriptions of the top-level parser and of each subcommand for
+     *        `--export-help <format> --all-subcommands`.
+     * \param[in] top_level_page The description of this parser.
+     * \param[out] stream The stream to print to; std::cout if `nullptr`.
+     * \details
+     * Each sub-parser is created as if the subcommand was called with `--export-help <format>` and set up by the
+     * function given to sharg::parser::set_subcommand_setup. See there for how the descriptions are separated.
+     */
+    void export_subcommands(std::string const & top_level_page, std::ostream * const stream)
+    {
+        std::ostream & out = (stream != nullptr) ? *stream : std::cout;
+        std::string const format_name{embedded_export_key};
+        bool const is_json = format_name == "json";
+
+        if (is_json) // Each description is a JSON object.
+            out << "[\n";
+
+        out << top_level_page;
+
+        for (std::string const & name : subcommands)
+        {
+            create_sub_parser({name, "--export-help", format_name});
+            subcommand_setup(*sub_parser);
+
+            if (is_json)
+                out << ",\n";
+            else if (format_name == "cwl") // Separate the YAML documents.
+                out << "---\n";
+            else if (format_name == "bash" || format_name == "zsh" || format_name == "fish")
+                out << '\n';
+
+            sub_parser->parse_impl(true, &out).value();
+        }
+
+        // The sub-parser of the last subcommand must not be mistaken for the one the user called.
+        sub_parser.reset();
+
+        if (is_json)
+            out << "]\n";
+
+        out.flush();
+    }
+
     /*!\brief Parses the command line arguments according to the format.
-     * \throws sharg::option_declared_multiple_times if an option that is not a list was declared multiple times.
-     * \throws sharg::user_input_error if an incorrect argument is given as (positional) option value.
-     * \throws sharg::required_option_missing if the user did not provide a required option.
-     * \throws sharg::too_many_arguments if the command line call contained more arguments than expected.
-     * \throws sharg::too_few_arguments if the command line call contained less arguments than expected.
-     * \throws sharg::validation_error if the argument was not excepted by the provided validator.
+     * \param[in] stop_at_first_error Whether to stop parsing at the first error. See sharg::detail::format_parse.
+     * \param[out] stream The stream special formats print to; std::cout if `nullptr`.
      * \details
-     * This function calls the parse function of the format member variable.
+     * This function calls the parse function of the format member variable. The errors found by
+     * sharg::detail::format_parse are stored in parser::diagnostics.
      */
-    inline void parse_format()
+    inline void parse_format(bool const stop_at_first_error, std::ostream * const stream)
     {
-        auto format_parse_fn = [this]<typename format_t>(format_t & f)
+        auto format_parse_fn = [this, stop_at_first_error, stream]<typename format_t>(format_t & f)
         {
-            if constexpr (std::same_as<format_t, detail::format_tdl>)
+            if constexpr (requires { f.output_stream; })
+            {
+                if (stream != nullptr)
+                    f.output_stream = stream;
+            }
+
+            if constexpr (std::same_as<format_t, detail::format_parse>)
+                diagnostics = f.try_parse(stop_at_first_error);
+            else if constexpr (std::same_as<format_t, detail::format_tdl>
+                               || std::same_as<format_t, detail::format_json>
+                               || std::same_as<format_t, detail::format_completion>)
                 f.parse(info, executable_name);
             else
                 f.parse(info);
@@ -1148,4 +2451,25 @@ private:
     }
 };
 
+#if SHARG_COMPILED_LIBRARY
+//!\cond
+// Instantiated once in sharg::sharg_compiled.
+extern template void parser::add_option(int32_t &, config<detail::default_validator>);
+extern template void parser::add_option(uint32_t &, config<detail::default_validator>);
+extern template void parser::add_option(int64_t &, config<detail::default_validator>);
+extern template void parser::add_option(uint64_t &, config<detail::default_validator>);
+extern template void parser::add_option(double &, config<detail::default_validator>);
+extern template void parser::add_option(std::string &, config<detail::default_validator>);
+extern template void parser::add_option(std::filesystem::path &, config<detail::default_validator>);
+extern template void parser::add_option(std::vector<std::string> &, config<detail::default_validator>);
+extern template void parser::add_option(std::vector<std::filesystem::path> &, config<detail::default_validator>);
+extern template void parser::add_flag(bool &, config<detail::default_validator>);
+extern template void parser::add_positional_option(std::string &, config<detail::default_validator>);
+extern template void parser::add_positional_option(std::filesystem::path &, config<detail::default_validator>);
+extern template void parser::add_positional_option(std::vector<std::string> &, config<detail::default_validator>);
+extern template void parser::add_positional_option(std::vector<std::filesystem::path> &,
+                                                   config<detail::default_validator>);
+//!\endcond
+#endif
+
 } // namespace sharg
@@ -0,0 +1,359 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::parser_schema.
+ */
+
+#pragma once
+
+#include <initializer_list>
+#include <istream>
+#include <optional>
+
+#include <sharg/parser.hpp>
+
+namespace sharg
+{
+
+namespace detail
+{
+
+/*!\brief Splits a command line into arguments.
+ * \ingroup parser
+ * \param[in] command_line The command line to split.
+ * \returns The arguments.
+ * \throws sharg::user_input_error if a quote is not terminated.
+ *
+ * \details
+ *
+ * Arguments are separated by whitespace. Like in a POSIX shell, single quotes preserve all characters,
+ * double quotes preserve all characters except for backslash escapes, and a backslash outside of quotes escapes the
+ * next character. No other expansion is performed.
+ */
+inline std::vector<std::string> split_command_line(std::string_view const command_line)
+{
+    std::vector<std::string> arguments{};
+    std::string current{};
+    bool in_argument{false};
+    char quote{'\0'};
+
+    for (auto it = command_line.begin(); it != command_line.end(); ++it)
+    {
+        char const c = *it;
+
+        if (quote == '\'')
+        {
+            if (c == '\'')
+                quote = '\0';
+            else
+                current += c;
+        }
+        else if (c == '\\' && std::next(it) != command_line.end())
+        {
+            current += *++it;
+            in_argument = true;
+        }
+        else if (quote == '"')
+        {
+            if (c == '"')
+                quote = '\0';
+            else
+                current += c;
+        }
+        else if (c == '\'' || c == '"')
+        {
+            quote = c;
+            in_argument = true;
+        }
+        else if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            if (in_argument)
+                arguments.push_back(std::exchange(current, std::string{}));
+            in_argument = false;
+        }
+        else
+        {
+            current += c;
+            in_argument = true;
+        }
+    }
+
+    if (quote != '\0')
+        throw user_input_error{"The command line contains an unterminated quote: " + std::string{command_line}};
+
+    if (in_argument)
+        arguments.push_back(std::move(current));
+
+    return arguments;
+}
+
+} // namespace detail
+
+template <typename options_t>
+    requires std::copy_constructible<options_t>
+class config_file_watcher;
+
+/*!\brief A reusable description of a command line interface that parses many argument vectors.
+ * \ingroup parser
+ * \tparam options_t The type holding the parsed values; Must be copy constructible.
+ *
+ * \details
+ *
+ * The sharg::parser binds each option to a variable and can only parse once. Applications that execute many small
+ * jobs in one process (e.g. a worker that loads a large index once) would need a new sharg::parser per job.
+ *
+ * A sharg::parser_schema instead binds each option to a data member of `options_t`. The options are added once and
+ * verified on the spot (throwing the same sharg::design_error as sharg::parser would); their parse steps are stored
+ * in a table that every parse reuses. Afterwards, the schema can parse any number of argument vectors; each call
+ * returns a fresh `options_t` that is initialised with the defaults given on construction.
+ *
+ * \include test/snippet/parser_schema.cpp
+ *
+ * ### Differences to sharg::parser
+ *
+ * * The arguments do not contain the executable name, i.e. `{"-i", "in.fa"}` instead of `{"./app", "-i", "in.fa"}`.
+ * * Special options like `--help`, `--version`, `--export-help` or `--version-check` are not available, because
+ *   they would terminate the process. They are reported as unknown options.
+ * * No version check is performed.
+ * * Subcommands are not supported.
+ *
+ * ### Thread safety
+ *
+ * All parse functions are `const` and do not modify the schema. They may be called concurrently if the validators
+ * are safe to be called concurrently (all validators provided by sharg are).
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <typename options_t>
+    requires std::copy_constructible<options_t>
+class parser_schema
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parser_schema(parser_schema const &) = delete;             //!< Deleted.
+    parser_schema & operator=(parser_schema const &) = delete; //!< Deleted.
+    parser_schema(parser_schema &&) = default;                 //!< Defaulted.
+    parser_schema & operator=(parser_schema &&) = default;     //!< Defaulted.
+    ~parser_schema() = default;                                //!< Defaulted.
+
+    /*!\brief Constructs an empty schema.
+     * \param[in] defaults The values every parse result is initialised with.
+     */
+    explicit parser_schema(options_t defaults = options_t{}) :
+        defaults{std::make_unique<options_t>(std::move(defaults))}
+    {}
+    //!\}
+
+    /*!\name Adding options
+     * \brief Add (positional) options and flags to the schema.
+     * \{
+     */
+    /*!\brief Adds an option that is stored in the data member `member`.
+     * \tparam option_type The type of the data member. See sharg::parser::add_option.
+     * \tparam validator_type The type of validator to be applied to the option value. Must model sharg::validator.
+     * \param[in] member A pointer to the data member of `options_t` to store the value in.
+     * \param[in] config A configuration object to customise the behaviour. See sharg::config.
+     * \throws sharg::design_error See sharg::parser::add_option.
+     */
+    template <typename option_type, typename validator_type>
+        requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
+              && std::invocable<validator_type, option_type>
+    void add_option(option_type options_t::*member, config<validator_type> const & config)
+    {
+        verifier->add_option((*defaults).*member, config);
+        add_operation(config.long_id, table_type::kind::option, table_type::option_step(member, config), member);
+    }
+
+    /*!\brief Adds a flag that is stored in the data member `member`.
+     * \param[in] member A pointer to the data member of `options_t` to store the value in.
+     * \param[in] config A configuration object to customise the behaviour. See sharg::config.
+     * \throws sharg::design_error See sharg::parser::add_flag.
+     */
+    template <typename validator_type>
+        requires std::invocable<validator_type, bool>
+    void add_flag(bool options_t::*member, config<validator_type> const & config)
+    {
+        verifier->add_flag((*defaults).*member, config);
+        add_operation(config.long_id, table_type::kind::flag, table_type::flag_step(member, config), member);
+    }
+
+    /*!\brief Adds a positional option that is stored in the data member `member`.
+     * \tparam option_type The type of the data member. See sharg::parser::add_positional_option.
+     * \tparam validator_type The type of validator to be applied to the option value. Must model sharg::validator.
+     * \param[in] member A pointer to the data member of `options_t` to store the value in.
+     * \param[in] config A configuration object to customise the behaviour. See sharg::config.
+     * \throws sharg::design_error See sharg::parser::add_positional_option.
+     */
+    template <typename option_type, typename validator_type>
+        requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
+              && std::invocable<validator_type, option_type>
+    void add_positional_option(option_type options_t::*member, config<validator_type> const & config)
+    {
+        verifier->add_positional_option((*defaults).*member, config);
+        add_operation({},
+                      table_type::kind::positional_option,
+                      table_type::positional_option_step(member, config),
+                      member);
+    }
+    //!\}
+
+    /*!\name Parsing
+     * \brief Parse argument vectors into fresh value storage.
+     * \{
+     */
+    /*!\brief Parses one argument vector.
+     * \param[in] arguments The arguments, without the executable name.
+     * \returns The parsed values.
+     * \throws sharg::parser_error See sharg::parser::parse.
+     */
+    options_t parse(std::vector<std::string> arguments) const
+    {
+        // All bookkeeping of a single parse is released at once.
+        std::pmr::monotonic_buffer_resource arena{};
+        options_t options{*defaults};
+        detail::format_parse format{detail::format_parse::argument_list{arguments.begin(), arguments.end(), &arena}};
+        parse_result{format.try_parse(table, options, true)}.value();
+
+        return options;
+    }
+
+    /*!\brief Parses one argument vector, e.g. `schema.parse({"-i", "in.fa"})`.
+     * \param[in] arguments The arguments, without the executable name.
+     * \returns The parsed values.
+     * \throws sharg::parser_error See sharg::parser::parse.
+     * \details
+     * Without this overload, a braced list of two strings would also match the overload for a command line.
+     */
+    options_t parse(std::initializer_list<std::string> arguments) const
+    {
+        return parse(std::vector<std::string>{arguments});
+    }
+
+    /*!\brief Parses one command line, e.g. `-i "my file.fa" -t 4`.
+     * \param[in] command_line The command line, without the executable name.
+     * \returns The parsed values.
+     * \throws sharg::parser_error See sharg::parser::parse.
+     * \throws sharg::user_input_error if the command line contains an unterminated quote.
+     * \details
+     * The command line is split into arguments as described for sharg::detail::split_command_line.
+     */
+    options_t parse(std::string_view const command_line) const
+    {
+        return parse(detail::split_command_line(command_line));
+    }
+
+    /*!\brief Parses one job per line of `jobs` and passes the result to `callback`.
+     * \tparam callback_t The type of the callback; Must be invocable with `options_t &&`.
+     * \param[in] jobs The stream to read the jobs from.
+     * \param[in] callback The callback that is invoked for every parsed job.
+     * \returns The number of jobs.
+     * \throws sharg::parser_error See sharg::parser::parse. Jobs after the erroneous one are not processed.
+     * \details
+     * Empty lines and lines starting with `#` are skipped. To continue after erroneous jobs, read the lines
+     * yourself and call sharg::parser_schema::parse(std::string_view) const for each of them.
+     */
+    template <typename callback_t>
+        requires std::invocable<callback_t, options_t &&>
+    size_t parse_jobs(std::istream & jobs, callback_t && callback) const
+    {
+        std::string line{};
+        return parse_jobs(
+            [&jobs, &line]() -> std::optional<std::vector<std::string>>
+            {
+                while (std::getline(jobs, line))
+                {
+                    std::string_view const view{line};
+                    size_t const first = view.find_first_not_of(" \t\r");
+                    if (first != std::string_view::npos && view[first] != '#')
+                        return detail::split_command_line(view);
+                }
+                return std::nullopt;
+            },
+            std::forward<callback_t>(callback));
+    }
+
+    /*!\brief Parses jobs provided by `next_job` and passes the results to `callback`.
+     * \tparam job_source_t The type of the job source; Must return a `std::optional<std::vector<std::string>>`.
+     * \tparam callback_t The type of the callback; Must be invocable with `options_t &&`.
+     * \param[in] next_job Returns the arguments of the next job, or `std::nullopt` if there are no more jobs.
+     * \param[in] callback The callback that is invoked for every parsed job.
+     * \returns The number of jobs.
+     * \throws sharg::parser_error See sharg::parser::parse. Jobs after the erroneous one are not processed.
+     */
+    template <typename job_source_t, typename callback_t>
+        requires std::convertible_to<std::invoke_result_t<job_source_t>, std::optional<std::vector<std::string>>>
+              && std::invocable<callback_t, options_t &&>
+    size_t parse_jobs(job_source_t && next_job, callback_t && callback) const
+    {
+        size_t job_count{};
+
+        for (std::optional<std::vector<std::string>> arguments = next_job(); arguments.has_value();
+             arguments = next_job())
+        {
+            callback(parse(std::move(*arguments)));
+            ++job_count;
+        }
+
+        return job_count;
+    }
+    //!\}
+
+private:
+    //!\brief Befriend sharg::config_file_watcher to grant access to the operations and the defaults.
+    friend class config_file_watcher<options_t>;
+
+    //!\brief The type of the parse steps of the options.
+    using table_type = detail::format_parse::option_table<options_t>;
+
+    //!\brief An option, flag or positional option that was added to the schema.
+    struct operation
+    {
+        //!\brief The long identifier; empty for positional options and options without one.
+        std::string long_id;
+        //!\brief Whether it is an option, flag or positional option.
+        typename table_type::kind kind;
+        //!\brief Retrieves the value into the data member of the given options.
+        typename table_type::step_type step;
+        //!\brief Resets the data member of the first argument to the value in the second one.
+        std::function<void(options_t &, options_t const &)> reset;
+    };
+
+    //!\brief Records an added option and appends its parse step to sharg::parser_schema::table.
+    template <typename member_t>
+    void add_operation(std::string long_id,
+                       typename table_type::kind const kind,
+                       typename table_type::step_type step,
+                       member_t options_t::*member)
+    {
+        table.add(kind, step);
+        operations.push_back(operation{std::move(long_id),
+                                       kind,
+                                       std::move(step),
+                                       [member](options_t & options, options_t const & defaults)
+                                       {
+                                           options.*member = defaults.*member;
+                                       }});
+    }
+
+    //!\brief The values every parse result is initialised with. Stable address for the verifier.
+    std::unique_ptr<options_t> defaults;
+
+    /*!\brief A sharg::parser that is never parsed, used to verify the configuration when options are added.
+     * \details
+     * The verifier binds to the data members of sharg::parser_schema::defaults.
+     */
+    std::unique_ptr<parser> verifier{
+        std::make_unique<parser>("parser_schema", std::vector<std::string>{"parser_schema"}, update_notifications::off)};
+
+    //!\brief The added options in the order they were added.
+    std::vector<operation> operations{};
+
+    //!\brief The parse steps of all added options, set up once and used by every parse.
+    table_type table{};
+};
+
+} // namespace sharg
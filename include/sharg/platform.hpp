@@ -33,6 +33,60 @@ static_assert(__cplusplus >= 201709L, "SHARG requires C++20, make sure that you
 #    error SHARG include directory not set correctly. Forgot to add -I ${INSTALLDIR}/include to your CXXFLAGS?
 #endif
 
+// ============================================================================
+//  Export formats
+// ============================================================================
+
+/*!\brief Whether `--export-help html` is available. Set to 0 to compile out sharg::detail::format_html.
+ * \details
+ * The CMake option `SHARG_NO_EXPORT_HTML` sets this to 0.
+ */
+#ifndef SHARG_HAS_EXPORT_HTML
+#    define SHARG_HAS_EXPORT_HTML 1
+#endif
+
+/*!\brief Whether `--export-help man` is available. Set to 0 to compile out sharg::detail::format_man.
+ * \details
+ * The CMake option `SHARG_NO_EXPORT_MAN` sets this to 0.
+ */
+#ifndef SHARG_HAS_EXPORT_MAN
+#    define SHARG_HAS_EXPORT_MAN 1
+#endif
+
+/*!\brief Whether `--export-help ctd` and `--export-help cwl` are available. Requires the TDL library.
+ * \details
+ * The CMake configuration sets this to 1 if TDL was found and to 0 otherwise.
+ */
+#ifndef SHARG_HAS_TDL
+#    define SHARG_HAS_TDL 0
+#endif
+
+// ============================================================================
+//  Compiled library
+// ============================================================================
+
+/*!\brief Whether the explicit instantiations of the optional `sharg::sharg_compiled` library are used.
+ * \details
+ * Linking against the CMake target `sharg::sharg_compiled` sets this to 1, which declares the instantiations
+ * in src/sharg_compiled.cpp as `extern template`.
+ */
+#ifndef SHARG_COMPILED_LIBRARY
+#    define SHARG_COMPILED_LIBRARY 0
+#endif
+
+// ============================================================================
+//  Help page
+// ============================================================================
+
+/*!\brief The default of sharg::parser_meta_data::default_message_element_limit.
+ * \details
+ * The number of elements of a container default that are shown on the help page. Prefer setting the member of the
+ * meta data of a parser; if this macro is defined, it must have the same value in all translation units.
+ */
+#ifndef SHARG_DEFAULT_MESSAGE_ELEMENT_LIMIT
+#    define SHARG_DEFAULT_MESSAGE_ELEMENT_LIMIT 32
+#endif
+
 // ============================================================================
 //  Documentation
 // ============================================================================
@@ -0,0 +1,1577 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the locale independent floating point implementation of sharg/std/charconv.
+ *
+ * \details
+ *
+ * * to_chars computes the shortest representation that round-trips with the Ryu algorithm
+ *   (Ulf Adams, "Ryū: fast float-to-string conversion", PLDI 2018) for float and double.
+ * * from_chars uses the Clinger fast path and the Eisel-Lemire algorithm (Daniel Lemire, "Number Parsing at a
+ *   Gigabyte per Second", Software: Practice and Experience 51(8), 2021) for float and double. Inputs with more
+ *   than 19 significant digits whose rounding cannot be decided this way are compared exactly using big integers.
+ * * long double is delegated to the C library, but the decimal point is adapted to the current locale.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cfloat>
+#include <charconv>
+#include <clocale>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <sharg/std/detail/charconv_float_tables.hpp>
+
+namespace sharg::contrib::charconv_float::detail
+{
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Floating point properties
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief The IEEE-754 properties of a floating point type that are needed for the conversion.
+template <typename value_type>
+struct binary_format;
+
+//!\brief The IEEE-754 binary32 properties.
+template <>
+struct binary_format<float>
+{
+    using bits_type = uint32_t;                                 //!< The unsigned integer of the same size.
+    static constexpr int mantissa_bits = 23;                    //!< Number of explicitly stored mantissa bits.
+    static constexpr int exponent_bias = 127;                   //!< The exponent bias.
+    static constexpr int infinite_power = 0xFF;                 //!< The biased exponent of infinity.
+    static constexpr int smallest_power_of_ten = -65;           //!< Smaller powers of ten always round to zero.
+    static constexpr int largest_power_of_ten = 38;             //!< Larger powers of ten always round to infinity.
+    static constexpr int min_exponent_round_to_even = -17;      //!< Smallest exponent for which ties are possible.
+    static constexpr int max_exponent_round_to_even = 10;       //!< Largest exponent for which ties are possible.
+    static constexpr int max_exponent_fast_path = 10;           //!< Largest exactly representable power of ten.
+    static constexpr uint64_t max_mantissa_fast_path = 1 << 24; //!< Largest exactly representable integer.
+    static constexpr size_t max_digits = 114;                   //!< Maximum number of digits that affect rounding.
+};
+
+//!\brief The IEEE-754 binary64 properties.
+template <>
+struct binary_format<double>
+{
+    using bits_type = uint64_t;                                           //!< The unsigned integer of the same size.
+    static constexpr int mantissa_bits = 52;                              //!< Number of explicitly stored mantissa bits.
+    static constexpr int exponent_bias = 1023;                            //!< The exponent bias.
+    static constexpr int infinite_power = 0x7FF;                          //!< The biased exponent of infinity.
+    static constexpr int smallest_power_of_ten = -342;                    //!< Smaller powers of ten round to zero.
+    static constexpr int largest_power_of_ten = 308;                      //!< Larger powers of ten round to infinity.
+    static constexpr int min_exponent_round_to_even = -4;                 //!< Smallest exponent for which ties are possible.
+    static constexpr int max_exponent_round_to_even = 23;                 //!< Largest exponent for which ties are possible.
+    static constexpr int max_exponent_fast_path = 22;                     //!< Largest exactly representable power of ten.
+    static constexpr uint64_t max_mantissa_fast_path = uint64_t{1} << 53; //!< Largest exactly representable integer.
+    static constexpr size_t max_digits = 769;                             //!< Maximum number of digits that affect rounding.
+};
+
+//!\brief Whether the fast float/double implementation can be used for `value_type`.
+template <typename value_type>
+concept ieee_floating_point = (std::same_as<value_type, float> || std::same_as<value_type, double>)
+                           && std::numeric_limits<value_type>::is_iec559;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 128 bit arithmetic
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief An unsigned 128 bit integer.
+struct uint128
+{
+    uint64_t low;  //!< The lower 64 bits.
+    uint64_t high; //!< The upper 64 bits.
+};
+
+//!\brief Computes the full 128 bit product of two 64 bit integers.
+inline uint128 full_multiplication(uint64_t const a, uint64_t const b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using native_uint128 = unsigned __int128;
+    native_uint128 const product = static_cast<native_uint128>(a) * b;
+    return {static_cast<uint64_t>(product), static_cast<uint64_t>(product >> 64)};
+#else
+    uint64_t const a_low = static_cast<uint32_t>(a);
+    uint64_t const a_high = a >> 32;
+    uint64_t const b_low = static_cast<uint32_t>(b);
+    uint64_t const b_high = b >> 32;
+
+    uint64_t const low_low = a_low * b_low;
+    uint64_t const low_high = a_low * b_high;
+    uint64_t const high_low = a_high * b_low;
+    uint64_t const high_high = a_high * b_high;
+
+    uint64_t const middle = (low_low >> 32) + static_cast<uint32_t>(low_high) + static_cast<uint32_t>(high_low);
+    return {(middle << 32) | static_cast<uint32_t>(low_low),
+            high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32)};
+#endif
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// to_chars: shortest representation (Ryu)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief A decimal floating point number `mantissa * 10^exponent`.
+struct decimal_fp
+{
+    uint64_t mantissa; //!< The decimal digits.
+    int32_t exponent;  //!< The decimal exponent.
+};
+
+//!\brief Returns `ceil(log2(5^e))` for `0 <= e <= 3528`, i.e. the number of bits of `5^e`.
+inline constexpr int32_t pow5_bits(int32_t const e) noexcept
+{
+    return static_cast<int32_t>((static_cast<uint32_t>(e) * 1217359) >> 19) + 1;
+}
+
+//!\brief Returns `floor(log10(2^e))` for `0 <= e <= 1650`.
+inline constexpr uint32_t log10_pow2(int32_t const e) noexcept
+{
+    return (static_cast<uint32_t>(e) * 78913) >> 18;
+}
+
+//!\brief Returns `floor(log10(5^e))` for `0 <= e <= 2620`.
+inline constexpr uint32_t log10_pow5(int32_t const e) noexcept
+{
+    return (static_cast<uint32_t>(e) * 732923) >> 20;
+}
+
+//!\brief Returns whether `value` is divisible by `5^p`.
+template <typename uint_t>
+inline constexpr bool multiple_of_power_of_5(uint_t value, uint32_t const p) noexcept
+{
+    uint32_t count = 0;
+    for (; value != 0 && value % 5 == 0; value /= 5)
+        ++count;
+    return count >= p;
+}
+
+//!\brief Returns whether `value` is divisible by `2^p`.
+template <typename uint_t>
+inline constexpr bool multiple_of_power_of_2(uint_t const value, uint32_t const p) noexcept
+{
+    return (value & ((uint_t{1} << p) - 1)) == 0;
+}
+
+//!\brief Computes `(m * mul) >> j` for a 128 bit `mul` and `64 < j < 128`.
+inline uint64_t mul_shift_64(uint64_t const m, std::array<uint64_t, 2> const & mul, int32_t const j) noexcept
+{
+    uint128 const low_product = full_multiplication(m, mul[0]);
+    uint128 const high_product = full_multiplication(m, mul[1]);
+
+    uint64_t const sum_low = high_product.low + low_product.high;
+    uint64_t const sum_high = high_product.high + (sum_low < high_product.low);
+    int32_t const shift = j - 64;
+
+    return (sum_high << (64 - shift)) | (sum_low >> shift);
+}
+
+//!\brief Computes `(m * factor) >> shift` for a 64 bit `factor` and `32 < shift < 96`.
+inline uint32_t mul_shift_32(uint32_t const m, uint64_t const factor, int32_t const shift) noexcept
+{
+    uint64_t const bits0 = static_cast<uint64_t>(m) * static_cast<uint32_t>(factor);
+    uint64_t const bits1 = static_cast<uint64_t>(m) * (factor >> 32);
+    uint64_t const sum = (bits0 >> 32) + bits1;
+    return static_cast<uint32_t>(sum >> (shift - 32));
+}
+
+//!\brief The number of bits used for the tables sharg::contrib::charconv_float::detail::pow5_inv_split and pow5_split.
+inline constexpr int32_t pow5_bitcount = 125;
+
+/*!\brief Computes the shortest decimal representation of a finite, positive double that round-trips.
+ * \param[in] ieee_mantissa The stored mantissa bits.
+ * \param[in] ieee_exponent The stored (biased) exponent bits.
+ */
+inline decimal_fp shortest_decimal(uint64_t const ieee_mantissa, uint32_t const ieee_exponent) noexcept
+{
+    using format = binary_format<double>;
+
+    int32_t e2{};
+    uint64_t m2{};
+    if (ieee_exponent == 0)
+    {
+        e2 = 1 - format::exponent_bias - format::mantissa_bits - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = static_cast<int32_t>(ieee_exponent) - format::exponent_bias - format::mantissa_bits - 2;
+        m2 = (uint64_t{1} << format::mantissa_bits) | ieee_mantissa;
+    }
+    bool const accept_bounds = (m2 & 1) == 0;
+
+    // Step 2: Determine the interval of valid decimal representations.
+    uint64_t const mv = 4 * m2;
+    uint32_t const mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+
+    // Step 3: Convert to a decimal power base using 128-bit arithmetic.
+    uint64_t vr{};
+    uint64_t vp{};
+    uint64_t vm{};
+    int32_t e10{};
+    bool vm_is_trailing_zeros = false;
+    bool vr_is_trailing_zeros = false;
+
+    if (e2 >= 0)
+    {
+        uint32_t const q = log10_pow2(e2) - (e2 > 3);
+        e10 = static_cast<int32_t>(q);
+        int32_t const k = pow5_bitcount + pow5_bits(static_cast<int32_t>(q)) - 1;
+        int32_t const i = -e2 + static_cast<int32_t>(q) + k;
+        vr = mul_shift_64(4 * m2, pow5_inv_split[q], i);
+        vp = mul_shift_64(4 * m2 + 2, pow5_inv_split[q], i);
+        vm = mul_shift_64(4 * m2 - 1 - mm_shift, pow5_inv_split[q], i);
+
+        if (q <= 21)
+        {
+            // Only one of mp, mv, and mm can be a multiple of 5, if any.
+            if (mv % 5 == 0)
+                vr_is_trailing_zeros = multiple_of_power_of_5(mv, q);
+            else if (accept_bounds)
+                vm_is_trailing_zeros = multiple_of_power_of_5(mv - 1 - mm_shift, q);
+            else
+                vp -= multiple_of_power_of_5(mv + 2, q);
+        }
+    }
+    else
+    {
+        uint32_t const q = log10_pow5(-e2) - (-e2 > 1);
+        e10 = static_cast<int32_t>(q) + e2;
+        int32_t const i = -e2 - static_cast<int32_t>(q);
+        int32_t const k = pow5_bits(i) - pow5_bitcount;
+        int32_t const j = static_cast<int32_t>(q) - k;
+        vr = mul_shift_64(4 * m2, pow5_split[i], j);
+        vp = mul_shift_64(4 * m2 + 2, pow5_split[i], j);
+        vm = mul_shift_64(4 * m2 - 1 - mm_shift, pow5_split[i], j);
+
+        if (q <= 1)
+        {
+            // {vr,vp,vm} is trailing zeros if {mv,mp,mm} has at least q trailing 0 bits.
+            vr_is_trailing_zeros = true;
+            if (accept_bounds)
+                vm_is_trailing_zeros = mm_shift == 1;
+            else
+                --vp;
+        }
+        else if (q < 63)
+        {
+            vr_is_trailing_zeros = multiple_of_power_of_2(mv, q);
+        }
+    }
+
+    // Step 4: Find the shortest decimal representation in the interval of valid representations.
+    int32_t removed = 0;
+    uint8_t last_removed_digit = 0;
+    uint64_t output{};
+
+    if (vm_is_trailing_zeros || vr_is_trailing_zeros)
+    {
+        // General case, which happens rarely (~0.7%).
+        for (; vp / 10 > vm / 10; ++removed)
+        {
+            vm_is_trailing_zeros &= vm % 10 == 0;
+            vr_is_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = static_cast<uint8_t>(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+        }
+
+        if (vm_is_trailing_zeros)
+        {
+            for (; vm % 10 == 0; ++removed)
+            {
+                vr_is_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = static_cast<uint8_t>(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+            }
+        }
+
+        if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+            last_removed_digit = 4; // Round even if the exact number is .....50..0.
+
+        output = vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) || last_removed_digit >= 5);
+    }
+    else
+    {
+        // Specialized for the common case (~99.3%).
+        bool round_up = false;
+        for (; vp / 10 > vm / 10; ++removed)
+        {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+        }
+
+        output = vr + (vr == vm || round_up);
+    }
+
+    return {output, e10 + removed};
+}
+
+/*!\brief Computes the shortest decimal representation of a finite, positive float that round-trips.
+ * \param[in] ieee_mantissa The stored mantissa bits.
+ * \param[in] ieee_exponent The stored (biased) exponent bits.
+ */
+inline decimal_fp shortest_decimal(uint32_t const ieee_mantissa, uint32_t const ieee_exponent) noexcept
+{
+    using format = binary_format<float>;
+    constexpr int32_t float_pow5_bitcount = pow5_bitcount - 64;
+
+    // The upper 64 bits of the double tables are the correctly rounded (down) values of the float tables.
+    // The inverse multipliers are defined as floor(2^x / 5^y) + 1, so we have to add 1.
+    auto mul_pow5_inv_div_pow2 = [](uint32_t const m, uint32_t const q, int32_t const j)
+    {
+        return mul_shift_32(m, pow5_inv_split[q][1] + 1, j);
+    };
+    auto mul_pow5_div_pow2 = [](uint32_t const m, uint32_t const i, int32_t const j)
+    {
+        return mul_shift_32(m, pow5_split[i][1], j);
+    };
+
+    int32_t e2{};
+    uint32_t m2{};
+    if (ieee_exponent == 0)
+    {
+        e2 = 1 - format::exponent_bias - format::mantissa_bits - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = static_cast<int32_t>(ieee_exponent) - format::exponent_bias - format::mantissa_bits - 2;
+        m2 = (uint32_t{1} << format::mantissa_bits) | ieee_mantissa;
+    }
+    bool const accept_bounds = (m2 & 1) == 0;
+
+    // Step 2: Determine the interval of valid decimal representations.
+    uint32_t const mv = 4 * m2;
+    uint32_t const mp = 4 * m2 + 2;
+    uint32_t const mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+    uint32_t const mm = 4 * m2 - 1 - mm_shift;
+
+    // Step 3: Convert to a decimal power base using 64-bit arithmetic.
+    uint32_t vr{};
+    uint32_t vp{};
+    uint32_t vm{};
+    int32_t e10{};
+    bool vm_is_trailing_zeros = false;
+    bool vr_is_trailing_zeros = false;
+    uint8_t last_removed_digit = 0;
+
+    if (e2 >= 0)
+    {
+        uint32_t const q = log10_pow2(e2);
+        e10 = static_cast<int32_t>(q);
+        int32_t const k = float_pow5_bitcount + pow5_bits(static_cast<int32_t>(q)) - 1;
+        int32_t const i = -e2 + static_cast<int32_t>(q) + k;
+        vr = mul_pow5_inv_div_pow2(mv, q, i);
+        vp = mul_pow5_inv_div_pow2(mp, q, i);
+        vm = mul_pow5_inv_div_pow2(mm, q, i);
+
+        if (q != 0 && (vp - 1) / 10 <= vm / 10)
+        {
+            // We need to know one removed digit even if we are not going to loop below.
+            int32_t const l = float_pow5_bitcount + pow5_bits(static_cast<int32_t>(q - 1)) - 1;
+            last_removed_digit =
+                static_cast<uint8_t>(mul_pow5_inv_div_pow2(mv, q - 1, -e2 + static_cast<int32_t>(q) - 1 + l) % 10);
+        }
+
+        if (q <= 9)
+        {
+            // The largest power of 5 that fits in 24 bits is 5^10, but q <= 9 seems to be safe as well.
+            // Only one of mp, mv, and mm can be a multiple of 5, if any.
+            if (mv % 5 == 0)
+                vr_is_trailing_zeros = multiple_of_power_of_5(mv, q);
+            else if (accept_bounds)
+                vm_is_trailing_zeros = multiple_of_power_of_5(mm, q);
+            else
+                vp -= multiple_of_power_of_5(mp, q);
+        }
+    }
+    else
+    {
+        uint32_t const q = log10_pow5(-e2);
+        e10 = static_cast<int32_t>(q) + e2;
+        int32_t const i = -e2 - static_cast<int32_t>(q);
+        int32_t const k = pow5_bits(i) - float_pow5_bitcount;
+        int32_t j = static_cast<int32_t>(q) - k;
+        vr = mul_pow5_div_pow2(mv, static_cast<uint32_t>(i), j);
+        vp = mul_pow5_div_pow2(mp, static_cast<uint32_t>(i), j);
+        vm = mul_pow5_div_pow2(mm, static_cast<uint32_t>(i), j);
+
+        if (q != 0 && (vp - 1) / 10 <= vm / 10)
+        {
+            j = static_cast<int32_t>(q) - 1 - (pow5_bits(i + 1) - float_pow5_bitcount);
+            last_removed_digit = static_cast<uint8_t>(mul_pow5_div_pow2(mv, static_cast<uint32_t>(i + 1), j) % 10);
+        }
+
+        if (q <= 1)
+        {
+            // {vr,vp,vm} is trailing zeros if {mv,mp,mm} has at least q trailing 0 bits.
+            vr_is_trailing_zeros = true;
+            if (accept_bounds)
+                vm_is_trailing_zeros = mm_shift == 1;
+            else
+                --vp;
+        }
+        else if (q < 31)
+        {
+            vr_is_trailing_zeros = multiple_of_power_of_2(mv, q - 1);
+        }
+    }
+
+    // Step 4: Find the shortest decimal representation in the interval of valid representations.
+    int32_t removed = 0;
+    uint32_t output{};
+
+    if (vm_is_trailing_zeros || vr_is_trailing_zeros)
+    {
+        // General case, which happens rarely (~4.0%).
+        for (; vp / 10 > vm / 10; ++removed)
+        {
+            vm_is_trailing_zeros &= vm % 10 == 0;
+            vr_is_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = static_cast<uint8_t>(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+        }
+
+        if (vm_is_trailing_zeros)
+        {
+            for (; vm % 10 == 0; ++removed)
+            {
+                vr_is_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = static_cast<uint8_t>(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+            }
+        }
+
+        if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+            last_removed_digit = 4; // Round even if the exact number is .....50..0.
+
+        output = vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) || last_removed_digit >= 5);
+    }
+    else
+    {
+        // Specialized for the common case (~96.0%).
+        for (; vp / 10 > vm / 10; ++removed)
+        {
+            last_removed_digit = static_cast<uint8_t>(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+        }
+
+        output = vr + (vr == vm || last_removed_digit >= 5);
+    }
+
+    return {output, e10 + removed};
+}
+
+//!\brief Writes the decimal digits of `value` to `buffer` and returns the number of digits.
+inline int32_t write_digits(char * buffer, uint64_t value) noexcept
+{
+    char reversed[20];
+    int32_t length = 0;
+
+    do
+    {
+        reversed[length++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    while (value != 0);
+
+    std::reverse_copy(reversed, reversed + length, buffer);
+    return length;
+}
+
+/*!\brief Writes the exact decimal digits of the integer `mantissa * 2^exponent` to `buffer`.
+ * \returns The number of digits.
+ * \details
+ * Only used for values below 10^23, i.e. at most 24 digits are written.
+ */
+inline int32_t write_exact_integer(char * buffer, uint64_t const mantissa, int32_t const exponent) noexcept
+{
+    if (exponent <= 0)
+        return write_digits(buffer, mantissa >> -exponent);
+
+    // Little endian decimal digits, doubled `exponent` times.
+    std::array<uint8_t, 32> digits{};
+    int32_t length = 0;
+    for (uint64_t value = mantissa; value != 0; value /= 10)
+        digits[length++] = static_cast<uint8_t>(value % 10);
+
+    for (int32_t i = 0; i < exponent; ++i)
+    {
+        uint8_t carry = 0;
+        for (int32_t position = 0; position < length; ++position)
+        {
+            uint8_t const doubled = static_cast<uint8_t>(digits[position] * 2 + carry);
+            digits[position] = doubled % 10;
+            carry = doubled / 10;
+        }
+        if (carry != 0)
+            digits[length++] = carry;
+    }
+
+    for (int32_t position = 0; position < length; ++position)
+        buffer[position] = static_cast<char>('0' + digits[length - 1 - position]);
+
+    return length;
+}
+
+/*!\brief Writes a finite, positive number given by its shortest digits in the shortest of fixed and scientific
+ *        notation, preferring fixed notation on ties (as std::to_chars without format does).
+ * \param[in] first        The begin of the output range.
+ * \param[in] last         The end of the output range.
+ * \param[in] digits       The shortest decimal digits.
+ * \param[in] digit_count  The number of digits.
+ * \param[in] exponent     The decimal exponent, i.e. the value is `digits * 10^exponent`.
+ * \param[in] exact_digits A callable that writes the exact integer digits of the value to a buffer of size 32 and
+ *                         returns the number of digits. Only called if the value is an integer printed in fixed
+ *                         notation with trailing zeros.
+ */
+template <typename exact_digits_t>
+inline std::to_chars_result write_shortest(char * first,
+                                           char * const last,
+                                           char const * const digits,
+                                           int32_t const digit_count,
+                                           int32_t const exponent,
+                                           exact_digits_t && exact_digits) noexcept
+{
+    int32_t const scientific_exponent = digit_count - 1 + exponent;
+    int32_t const absolute_scientific_exponent = scientific_exponent < 0 ? -scientific_exponent : scientific_exponent;
+    int32_t const exponent_length =
+        absolute_scientific_exponent >= 1000 ? 4 : (absolute_scientific_exponent >= 100 ? 3 : 2);
+    int32_t const scientific_length = digit_count + (digit_count > 1) + 2 + exponent_length;
+
+    int32_t fixed_length{};
+    if (exponent >= 0)
+        fixed_length = digit_count + exponent;
+    else if (digit_count + exponent > 0)
+        fixed_length = digit_count + 1;
+    else
+        fixed_length = 2 - exponent;
+
+    if (fixed_length <= scientific_length)
+    {
+        if (last - first < fixed_length)
+            return {last, std::errc::value_too_large};
+
+        if (exponent > 0)
+        {
+            // The exact value is printed, which may differ from the shortest digits followed by zeros.
+            char exact[32];
+            int32_t const exact_length = exact_digits(exact);
+            if (last - first < exact_length)
+                return {last, std::errc::value_too_large};
+            return {std::copy(exact, exact + exact_length, first), std::errc{}};
+        }
+        else if (exponent == 0)
+        {
+            return {std::copy(digits, digits + digit_count, first), std::errc{}};
+        }
+        else if (digit_count + exponent > 0)
+        {
+            first = std::copy(digits, digits + digit_count + exponent, first);
+            *first++ = '.';
+            return {std::copy(digits + digit_count + exponent, digits + digit_count, first), std::errc{}};
+        }
+        else
+        {
+            *first++ = '0';
+            *first++ = '.';
+            first = std::fill_n(first, -exponent - digit_count, '0');
+            return {std::copy(digits, digits + digit_count, first), std::errc{}};
+        }
+    }
+
+    if (last - first < scientific_length)
+        return {last, std::errc::value_too_large};
+
+    *first++ = digits[0];
+    if (digit_count > 1)
+    {
+        *first++ = '.';
+        first = std::copy(digits + 1, digits + digit_count, first);
+    }
+    *first++ = 'e';
+    *first++ = scientific_exponent < 0 ? '-' : '+';
+    // At least two digits, at most four for long double.
+    for (int32_t position = exponent_length - 1, remaining = absolute_scientific_exponent; position >= 0; --position)
+    {
+        first[position] = static_cast<char>('0' + remaining % 10);
+        remaining /= 10;
+    }
+
+    return {first + exponent_length, std::errc{}};
+}
+
+/*!\brief Computes the shortest round-trip representation of a finite, positive long double.
+ * \details
+ * There is no fast algorithm for the various long double formats. Instead, the precision is increased until the
+ * value round-trips. The streams use the classic locale.
+ */
+inline std::to_chars_result long_double_to_chars(char * const first, char * const last, long double const value)
+{
+    std::ostringstream output{};
+    output.imbue(std::locale::classic());
+
+    std::string representation{};
+    for (int precision = 0; precision < std::numeric_limits<long double>::max_digits10; ++precision)
+    {
+        output.str({});
+        output << std::scientific << std::setprecision(precision) << value;
+        representation = output.str();
+
+        std::istringstream input{representation};
+        input.imbue(std::locale::classic());
+        long double parsed{};
+        if (input >> parsed && parsed == value)
+            break;
+    }
+
+    // representation is "d.ddde[+-]xx"
+    size_t const e_position = representation.find('e');
+    char digits[std::numeric_limits<long double>::max_digits10 + 1];
+    int32_t digit_count = 0;
+    for (size_t i = 0; i < e_position; ++i)
+    {
+        if (representation[i] != '.')
+            digits[digit_count++] = representation[i];
+    }
+    while (digit_count > 1 && digits[digit_count - 1] == '0')
+        --digit_count;
+
+    int32_t const exponent = std::atoi(representation.c_str() + e_position + 1) - (digit_count - 1);
+
+    return write_shortest(first,
+                          last,
+                          digits,
+                          digit_count,
+                          exponent,
+                          [value](char * buffer)
+                          {
+                              std::ostringstream exact{};
+                              exact.imbue(std::locale::classic());
+                              exact << std::fixed << std::setprecision(0) << value;
+                              std::string const exact_digits = exact.str();
+                              size_t const length = std::min<size_t>(exact_digits.size(), 32u);
+                              std::copy_n(exact_digits.data(), length, buffer);
+                              return static_cast<int32_t>(length);
+                          });
+}
+
+//!\brief Implementation of std::to_chars for floating point values without format and precision.
+template <typename value_type>
+    requires std::is_floating_point_v<value_type>
+inline std::to_chars_result to_chars(char * first, char * const last, value_type const value) noexcept
+{
+    if (std::signbit(value))
+    {
+        if (first == last)
+            return {last, std::errc::value_too_large};
+        *first++ = '-';
+    }
+
+    auto write_literal = [&first, last](std::string_view const literal) -> std::to_chars_result
+    {
+        if (last - first < static_cast<std::ptrdiff_t>(literal.size()))
+            return {last, std::errc::value_too_large};
+        return {std::copy(literal.begin(), literal.end(), first), std::errc{}};
+    };
+
+    if (std::isnan(value))
+        return write_literal("nan");
+    if (std::isinf(value))
+        return write_literal("inf");
+    if (value == 0)
+        return write_literal("0");
+
+    if constexpr (ieee_floating_point<value_type>)
+    {
+        using format = binary_format<value_type>;
+        using bits_type = typename format::bits_type;
+
+        bits_type const bits = std::bit_cast<bits_type>(value);
+        bits_type const ieee_mantissa = bits & ((bits_type{1} << format::mantissa_bits) - 1);
+        uint32_t const ieee_exponent =
+            static_cast<uint32_t>(bits >> format::mantissa_bits) & static_cast<uint32_t>(format::infinite_power);
+
+        decimal_fp const decimal = shortest_decimal(ieee_mantissa, ieee_exponent);
+
+        char digits[20];
+        int32_t const digit_count = write_digits(digits, decimal.mantissa);
+
+        return write_shortest(first,
+                              last,
+                              digits,
+                              digit_count,
+                              decimal.exponent,
+                              [ieee_mantissa, ieee_exponent](char * buffer)
+                              {
+                                  uint64_t mantissa = ieee_mantissa;
+                                  int32_t exponent = 1 - format::exponent_bias - format::mantissa_bits;
+                                  if (ieee_exponent != 0)
+                                  {
+                                      mantissa |= uint64_t{1} << format::mantissa_bits;
+                                      exponent = static_cast<int32_t>(ieee_exponent) - format::exponent_bias
+                                               - format::mantissa_bits;
+                                  }
+                                  return write_exact_integer(buffer, mantissa, exponent);
+                              });
+    }
+    else
+    {
+        try
+        {
+            return long_double_to_chars(first, last, std::abs(value));
+        }
+        catch (...)
+        {
+            return {last, std::errc::value_too_large};
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// from_chars: Eisel-Lemire
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief A binary floating point number given by its stored mantissa bits and biased exponent.
+struct adjusted_mantissa
+{
+    uint64_t mantissa; //!< The stored mantissa bits (without the implicit bit).
+    int32_t power2;    //!< The biased exponent.
+
+    //!\brief Defaulted.
+    friend bool operator==(adjusted_mantissa const &, adjusted_mantissa const &) = default;
+};
+
+/*!\brief Computes `w * 10^q` rounded to the nearest `value_type` with the Eisel-Lemire algorithm.
+ * \details
+ * The result is correctly rounded if `w` holds all significant digits of the decimal number.
+ */
+template <typename value_type>
+inline adjusted_mantissa compute_float(int64_t const q, uint64_t w) noexcept
+{
+    using format = binary_format<value_type>;
+
+    if (w == 0 || q < format::smallest_power_of_ten)
+        return {0, 0};
+    if (q > format::largest_power_of_ten)
+        return {0, format::infinite_power};
+
+    int const leading_zeros = std::countl_zero(w);
+    w <<= leading_zeros;
+
+    // The 128 bit truncated product of w and 5^q. The lower part is only computed if needed.
+    constexpr uint64_t precision_mask = ~uint64_t{0} >> (format::mantissa_bits + 3);
+    size_t const index = static_cast<size_t>(q - format::smallest_power_of_ten)
+                       + static_cast<size_t>(format::smallest_power_of_ten - binary_format<double>::smallest_power_of_ten);
+    uint128 product = full_multiplication(w, pow5_128[index][1]);
+    if ((product.high & precision_mask) == precision_mask)
+    {
+        uint128 const second_product = full_multiplication(w, pow5_128[index][0]);
+        product.low += second_product.high;
+        if (second_product.high > product.low)
+            ++product.high;
+    }
+
+    int const upper_bit = static_cast<int>(product.high >> 63);
+    int const shift = upper_bit + 64 - format::mantissa_bits - 3;
+
+    adjusted_mantissa answer{};
+    answer.mantissa = product.high >> shift;
+    // floor(log2(10^q)) + 63, then re-biased.
+    int32_t const power = static_cast<int32_t>(((152170 + 65536) * q) >> 16) + 63;
+    answer.power2 = power + upper_bit - leading_zeros + format::exponent_bias;
+
+    if (answer.power2 <= 0) // Subnormal.
+    {
+        if (-answer.power2 + 1 >= 64)
+            return {0, 0};
+
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += (answer.mantissa & 1); // Round up.
+        answer.mantissa >>= 1;
+        answer.power2 = (answer.mantissa < (uint64_t{1} << format::mantissa_bits)) ? 0 : 1;
+        return answer;
+    }
+
+    // We usually round up, but if we fall right in between and we have an even basis, we need to round down.
+    if (product.low <= 1 && q >= format::min_exponent_round_to_even && q <= format::max_exponent_round_to_even
+        && (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == product.high)
+    {
+        answer.mantissa &= ~uint64_t{1};
+    }
+
+    answer.mantissa += (answer.mantissa & 1); // Round up.
+    answer.mantissa >>= 1;
+    if (answer.mantissa >= (uint64_t{2} << format::mantissa_bits))
+    {
+        answer.mantissa = uint64_t{1} << format::mantissa_bits;
+        ++answer.power2; // Undo previous addition.
+    }
+
+    answer.mantissa &= ~(uint64_t{1} << format::mantissa_bits);
+    if (answer.power2 >= format::infinite_power)
+        return {0, format::infinite_power};
+
+    return answer;
+}
+
+//!\brief A fixed size unsigned big integer for the exact comparison in the slow path of from_chars.
+class big_integer
+{
+public:
+    //!\brief Multiplies by a small factor.
+    void multiply(uint32_t const factor) noexcept
+    {
+        uint64_t carry = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            uint64_t const product = static_cast<uint64_t>(limbs[i]) * factor + carry;
+            limbs[i] = static_cast<uint32_t>(product);
+            carry = product >> 32;
+        }
+        if (carry != 0)
+            limbs[size++] = static_cast<uint32_t>(carry);
+    }
+
+    //!\brief Adds a small summand.
+    void add(uint32_t summand) noexcept
+    {
+        for (size_t i = 0; summand != 0; ++i)
+        {
+            if (i == size)
+                limbs[size++] = 0;
+            uint64_t const sum = static_cast<uint64_t>(limbs[i]) + summand;
+            limbs[i] = static_cast<uint32_t>(sum);
+            summand = static_cast<uint32_t>(sum >> 32);
+        }
+    }
+
+    //!\brief Multiplies by `5^exponent`.
+    void multiply_pow5(uint32_t exponent) noexcept
+    {
+        for (; exponent >= 13; exponent -= 13)
+            multiply(1220703125u); // 5^13
+        uint32_t factor = 1;
+        for (; exponent > 0; --exponent)
+            factor *= 5;
+        multiply(factor);
+    }
+
+    //!\brief Multiplies by `2^exponent`.
+    void shift_left(uint32_t const exponent) noexcept
+    {
+        if (size == 0)
+            return;
+
+        size_t const limb_shift = exponent / 32;
+        uint32_t const bit_shift = exponent % 32;
+
+        if (bit_shift != 0)
+        {
+            uint32_t carry = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                uint32_t const limb = limbs[i];
+                limbs[i] = (limb << bit_shift) | carry;
+                carry = limb >> (32 - bit_shift);
+            }
+            if (carry != 0)
+                limbs[size++] = carry;
+        }
+
+        if (limb_shift != 0)
+        {
+            std::copy_backward(limbs.begin(), limbs.begin() + size, limbs.begin() + size + limb_shift);
+            std::fill_n(limbs.begin(), limb_shift, 0u);
+            size += limb_shift;
+        }
+    }
+
+    //!\brief Compares two big integers.
+    friend std::strong_ordering operator<=>(big_integer const & lhs, big_integer const & rhs) noexcept
+    {
+        if (lhs.size != rhs.size)
+            return lhs.size <=> rhs.size;
+
+        for (size_t i = lhs.size; i > 0; --i)
+        {
+            if (lhs.limbs[i - 1] != rhs.limbs[i - 1])
+                return lhs.limbs[i - 1] <=> rhs.limbs[i - 1];
+        }
+
+        return std::strong_ordering::equal;
+    }
+
+private:
+    //!\brief Enough for 800 decimal digits times 5^1150 times 2^1200.
+    std::array<uint32_t, 320> limbs{};
+    //!\brief The number of used limbs.
+    size_t size{0};
+};
+
+//!\brief The location of the digits of a decimal number in the input.
+struct decimal_digits
+{
+    char const * integer_begin;  //!< Begin of the integer part.
+    char const * integer_end;    //!< End of the integer part.
+    char const * fraction_begin; //!< Begin of the fractional part.
+    char const * fraction_end;   //!< End of the fractional part.
+    int64_t exponent;            //!< The explicit exponent, i.e. the value after 'e'.
+};
+
+/*!\brief Decides between two adjacent candidates by comparing the decimal number exactly with their midpoint.
+ * \param[in] digits The input digits.
+ * \param[in] lower  The smaller candidate.
+ * \param[in] upper  The larger candidate (the successor of `lower`).
+ */
+template <typename value_type>
+inline adjusted_mantissa round_exactly(decimal_digits const & digits,
+                                       adjusted_mantissa const lower,
+                                       adjusted_mantissa const upper) noexcept
+{
+    using format = binary_format<value_type>;
+
+    // The decimal digits, without leading zeros. Digits beyond max_digits can only break ties.
+    big_integer decimal{};
+    size_t digit_count = 0;
+    int64_t decimal_exponent = digits.exponent;
+    bool truncated = false;
+
+    auto add_digit = [&](char const c, bool const is_fraction)
+    {
+        if (digit_count == 0 && c == '0')
+        {
+            decimal_exponent -= is_fraction;
+            return;
+        }
+
+        if (digit_count < format::max_digits)
+        {
+            decimal.multiply(10);
+            decimal.add(static_cast<uint32_t>(c - '0'));
+            ++digit_count;
+            decimal_exponent -= is_fraction;
+        }
+        else
+        {
+            decimal_exponent += !is_fraction;
+            truncated |= c != '0';
+        }
+    };
+
+    for (char const * it = digits.integer_begin; it != digits.integer_end; ++it)
+        add_digit(*it, false);
+    for (char const * it = digits.fraction_begin; it != digits.fraction_end; ++it)
+        add_digit(*it, true);
+
+    if (truncated) // Strictly greater than the retained digits, but smaller than the next representable midpoint.
+    {
+        decimal.multiply(10);
+        decimal.add(1);
+        --decimal_exponent;
+    }
+
+    // The midpoint (2 * m + 1) * 2^(e - 1) between lower and upper.
+    uint64_t mantissa = lower.mantissa;
+    int64_t binary_exponent = 1 - format::exponent_bias - format::mantissa_bits;
+    if (lower.power2 != 0)
+    {
+        mantissa |= uint64_t{1} << format::mantissa_bits;
+        binary_exponent = lower.power2 - format::exponent_bias - format::mantissa_bits;
+    }
+    mantissa = 2 * mantissa + 1;
+    --binary_exponent;
+
+    big_integer midpoint{};
+    midpoint.add(static_cast<uint32_t>(mantissa >> 32));
+    midpoint.shift_left(32);
+    midpoint.add(static_cast<uint32_t>(mantissa));
+
+    // decimal * 10^decimal_exponent <=> midpoint * 2^binary_exponent
+    if (decimal_exponent >= 0)
+        decimal.multiply_pow5(static_cast<uint32_t>(decimal_exponent));
+    else
+        midpoint.multiply_pow5(static_cast<uint32_t>(-decimal_exponent));
+
+    int64_t const common_binary_exponent = std::min(decimal_exponent, binary_exponent);
+    decimal.shift_left(static_cast<uint32_t>(decimal_exponent - common_binary_exponent));
+    midpoint.shift_left(static_cast<uint32_t>(binary_exponent - common_binary_exponent));
+
+    std::strong_ordering const order = decimal <=> midpoint;
+    if (order < 0)
+        return lower;
+    if (order > 0)
+        return upper;
+    return (lower.mantissa & 1) == 0 ? lower : upper; // Round to even.
+}
+
+//!\brief Returns whether `c` is a decimal digit.
+inline constexpr bool is_digit(char const c) noexcept
+{
+    return c >= '0' && c <= '9';
+}
+
+//!\brief Returns the value of a hexadecimal digit or -1.
+inline constexpr int hex_digit_value(char const c) noexcept
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+//!\brief Case-insensitively checks whether [first, last) starts with the lower case `prefix`.
+inline constexpr bool starts_with_lower(char const * first, char const * const last, std::string_view const prefix)
+{
+    if (last - first < static_cast<std::ptrdiff_t>(prefix.size()))
+        return false;
+
+    for (char const c : prefix)
+    {
+        char const current = *first++;
+        if (current != c && current != c - 'a' + 'A')
+            return false;
+    }
+    return true;
+}
+
+/*!\brief Parses an optional exponent `[+-]digits` starting at `it`.
+ * \returns The end of the exponent or `it` if there are no digits.
+ */
+inline char const * parse_exponent(char const * it, char const * const last, int64_t & exponent) noexcept
+{
+    bool negative = false;
+    if (it != last && (*it == '+' || *it == '-'))
+        negative = *it++ == '-';
+
+    if (it == last || !is_digit(*it))
+        return nullptr;
+
+    exponent = 0;
+    for (; it != last && is_digit(*it); ++it)
+    {
+        if (exponent < 100000) // Larger exponents over- or underflow anyway.
+            exponent = exponent * 10 + (*it - '0');
+    }
+
+    if (negative)
+        exponent = -exponent;
+    return it;
+}
+
+//!\brief Assembles the value from its sign and adjusted mantissa.
+template <typename value_type>
+inline value_type assemble(bool const negative, adjusted_mantissa const am) noexcept
+{
+    using format = binary_format<value_type>;
+    using bits_type = typename format::bits_type;
+
+    bits_type bits = static_cast<bits_type>(am.mantissa)
+                   | (static_cast<bits_type>(am.power2) << format::mantissa_bits);
+    if (negative)
+        bits |= bits_type{1} << (sizeof(bits_type) * 8 - 1);
+    return std::bit_cast<value_type>(bits);
+}
+
+/*!\brief Parses a hexadecimal floating point number (without prefix) and rounds it to nearest, ties to even.
+ * \returns The end of the parsed pattern, or nullptr if no digits were found.
+ */
+template <typename value_type>
+inline char const *
+parse_hex(char const * it, char const * const last, adjusted_mantissa & result, bool & out_of_range) noexcept
+{
+    using format = binary_format<value_type>;
+
+    uint64_t mantissa = 0;
+    int64_t exponent = 0;
+    bool sticky = false;
+    bool has_digits = false;
+
+    auto add_digit = [&](int const value, bool const is_fraction)
+    {
+        has_digits = true;
+        if (mantissa < (uint64_t{1} << 60))
+        {
+            mantissa = mantissa * 16 + static_cast<uint64_t>(value);
+            exponent -= is_fraction ? 4 : 0;
+        }
+        else
+        {
+            exponent += is_fraction ? 0 : 4;
+            sticky |= value != 0;
+        }
+    };
+
+    for (; it != last && hex_digit_value(*it) >= 0; ++it)
+        add_digit(hex_digit_value(*it), false);
+
+    if (it != last && *it == '.')
+    {
+        char const * fraction = it + 1;
+        for (; fraction != last && hex_digit_value(*fraction) >= 0; ++fraction)
+            add_digit(hex_digit_value(*fraction), true);
+
+        if (has_digits)
+            it = fraction;
+    }
+
+    if (!has_digits)
+        return nullptr;
+
+    if (it != last && (*it == 'p' || *it == 'P'))
+    {
+        int64_t binary_exponent{};
+        if (char const * exponent_end = parse_exponent(it + 1, last, binary_exponent); exponent_end != nullptr)
+        {
+            exponent += binary_exponent;
+            it = exponent_end;
+        }
+    }
+
+    out_of_range = false;
+    if (mantissa == 0)
+    {
+        result = {0, 0};
+        return it;
+    }
+
+    // Normalise such that bit 63 is set. The value is mantissa * 2^exponent.
+    int const leading_zeros = std::countl_zero(mantissa);
+    mantissa <<= leading_zeros;
+    exponent -= leading_zeros;
+    int64_t const leading_exponent = exponent + 63;
+
+    int64_t shift = 63 - format::mantissa_bits;
+    bool const subnormal = leading_exponent < 1 - format::exponent_bias;
+    if (subnormal)
+        shift += 1 - format::exponent_bias - leading_exponent;
+
+    uint64_t kept{};
+    bool round_up{};
+    if (shift >= 65)
+    {
+        kept = 0;
+        round_up = false;
+    }
+    else if (shift == 64)
+    {
+        kept = 0;
+        round_up = mantissa > (uint64_t{1} << 63) || sticky;
+    }
+    else
+    {
+        kept = mantissa >> shift;
+        uint64_t const remainder = mantissa & ((uint64_t{1} << shift) - 1);
+        uint64_t const half = uint64_t{1} << (shift - 1);
+        round_up = remainder > half || (remainder == half && (sticky || (kept & 1) != 0));
+    }
+    kept += round_up;
+
+    if (subnormal)
+    {
+        // A carry into bit mantissa_bits yields the smallest normal number.
+        result = {kept & ~(uint64_t{1} << format::mantissa_bits), static_cast<int32_t>(kept >> format::mantissa_bits)};
+        out_of_range = kept == 0;
+        return it;
+    }
+
+    int64_t biased_exponent = leading_exponent + format::exponent_bias;
+    if (kept == (uint64_t{2} << format::mantissa_bits))
+    {
+        kept >>= 1;
+        ++biased_exponent;
+    }
+
+    if (biased_exponent >= format::infinite_power)
+    {
+        out_of_range = true;
+        return it;
+    }
+
+    result = {kept & ~(uint64_t{1} << format::mantissa_bits), static_cast<int32_t>(biased_exponent)};
+    return it;
+}
+
+/*!\brief Parses a long double with the C library, independent of the locale.
+ * \details
+ * The matched pattern is copied to a buffer and its decimal point is replaced by the one of the current locale.
+ */
+inline std::from_chars_result
+long_double_from_chars(char const * const first, char const * const last, long double & value, bool const hex) noexcept
+{
+    // The input was already validated, [first, last) is exactly the pattern to parse.
+    char stack_buffer[128];
+    size_t const length = static_cast<size_t>(last - first);
+    char const * const decimal_point = std::localeconv()->decimal_point;
+    size_t const decimal_point_length = std::strlen(decimal_point);
+    size_t const needed = length + decimal_point_length + 3;
+
+    char * buffer = needed <= sizeof(stack_buffer) ? stack_buffer : static_cast<char *>(std::malloc(needed));
+    if (buffer == nullptr)
+        return {first, std::errc::not_enough_memory};
+
+    char * out = buffer;
+    for (char const * it = first; it != last; ++it)
+    {
+        if (it == first && hex)
+        {
+            bool const negative = *it == '-';
+            if (negative)
+                *out++ = '-';
+            *out++ = '0';
+            *out++ = 'x';
+            if (negative)
+                continue;
+        }
+
+        if (*it == '.')
+            out = std::copy_n(decimal_point, decimal_point_length, out);
+        else
+            *out++ = *it;
+    }
+    *out = '\0';
+
+    int const saved_errno = errno;
+    errno = 0;
+    char * end{};
+    long double const parsed = std::strtold(buffer, &end);
+    bool const range_error = errno == ERANGE;
+    errno = saved_errno;
+
+    if (buffer != stack_buffer)
+        std::free(buffer);
+
+    if (range_error && (parsed == 0 || std::isinf(parsed)))
+        return {last, std::errc::result_out_of_range};
+
+    value = parsed;
+    return {last, std::errc{}};
+}
+
+//!\brief Implementation of std::from_chars for floating point values.
+template <typename value_type>
+    requires std::is_floating_point_v<value_type>
+inline std::from_chars_result
+from_chars(char const * const first, char const * const last, value_type & value, std::chars_format const fmt) noexcept
+{
+    char const * it = first;
+    bool const negative = it != last && *it == '-';
+    it += negative;
+
+    // infinity and NaN
+    if (it != last && (*it == 'i' || *it == 'I' || *it == 'n' || *it == 'N'))
+    {
+        if (starts_with_lower(it, last, "inf"))
+        {
+            it += starts_with_lower(it, last, "infinity") ? 8 : 3;
+            value = negative ? -std::numeric_limits<value_type>::infinity()
+                             : std::numeric_limits<value_type>::infinity();
+            return {it, std::errc{}};
+        }
+
+        if (starts_with_lower(it, last, "nan"))
+        {
+            it += 3;
+            if (it != last && *it == '(')
+            {
+                char const * sequence = it + 1;
+                while (sequence != last && (is_digit(*sequence) || hex_digit_value(*sequence) >= 0 || *sequence == '_'
+                                            || (*sequence >= 'a' && *sequence <= 'z')
+                                            || (*sequence >= 'A' && *sequence <= 'Z')))
+                {
+                    ++sequence;
+                }
+
+                if (sequence != last && *sequence == ')')
+                    it = sequence + 1;
+            }
+            value = negative ? -std::numeric_limits<value_type>::quiet_NaN()
+                             : std::numeric_limits<value_type>::quiet_NaN();
+            return {it, std::errc{}};
+        }
+
+        return {first, std::errc::invalid_argument};
+    }
+
+    if (fmt == std::chars_format::hex)
+    {
+        if constexpr (ieee_floating_point<value_type>)
+        {
+            adjusted_mantissa am{};
+            bool out_of_range{};
+            char const * const end = parse_hex<value_type>(it, last, am, out_of_range);
+
+            if (end == nullptr)
+                return {first, std::errc::invalid_argument};
+            if (out_of_range)
+                return {end, std::errc::result_out_of_range};
+
+            value = assemble<value_type>(negative, am);
+            return {end, std::errc{}};
+        }
+        else
+        {
+            // Determine the extent of the pattern and let the C library do the conversion.
+            adjusted_mantissa am{};
+            bool out_of_range{};
+            char const * const end = parse_hex<double>(it, last, am, out_of_range);
+
+            if (end == nullptr)
+                return {first, std::errc::invalid_argument};
+
+            return long_double_from_chars(first, end, value, true);
+        }
+    }
+
+    // Decimal: digits [. digits] [e [+-] digits]
+    decimal_digits digits{};
+    digits.integer_begin = it;
+    for (; it != last && is_digit(*it); ++it)
+    {}
+    digits.integer_end = it;
+    digits.fraction_begin = it;
+    digits.fraction_end = it;
+
+    if (it != last && *it == '.')
+    {
+        digits.fraction_begin = it + 1;
+        for (digits.fraction_end = digits.fraction_begin;
+             digits.fraction_end != last && is_digit(*digits.fraction_end);
+             ++digits.fraction_end)
+        {}
+        it = digits.fraction_end;
+    }
+
+    if (digits.integer_begin == digits.integer_end && digits.fraction_begin == digits.fraction_end)
+        return {first, std::errc::invalid_argument};
+
+    bool const allow_exponent = (fmt & std::chars_format::scientific) == std::chars_format::scientific;
+    bool const require_exponent = allow_exponent && (fmt & std::chars_format::fixed) != std::chars_format::fixed;
+    bool has_exponent = false;
+
+    if (allow_exponent && it != last && (*it == 'e' || *it == 'E'))
+    {
+        if (char const * const exponent_end = parse_exponent(it + 1, last, digits.exponent); exponent_end != nullptr)
+        {
+            it = exponent_end;
+            has_exponent = true;
+        }
+    }
+
+    if (require_exponent && !has_exponent)
+        return {first, std::errc::invalid_argument};
+
+    if constexpr (!ieee_floating_point<value_type>)
+    {
+        return long_double_from_chars(first, it, value, false);
+    }
+    else
+    {
+        using format = binary_format<value_type>;
+
+        // Accumulate up to 19 significant digits.
+        uint64_t mantissa = 0;
+        int64_t exponent = digits.exponent;
+        size_t significant_digits = 0;
+        bool truncated = false;
+
+        auto add_digit = [&](char const c, bool const is_fraction)
+        {
+            if (significant_digits == 0 && c == '0')
+            {
+                exponent -= is_fraction;
+            }
+            else if (significant_digits < 19)
+            {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(c - '0');
+                ++significant_digits;
+                exponent -= is_fraction;
+            }
+            else
+            {
+                exponent += !is_fraction;
+                truncated |= c != '0';
+            }
+        };
+
+        for (char const * digit = digits.integer_begin; digit != digits.integer_end; ++digit)
+            add_digit(*digit, false);
+        for (char const * digit = digits.fraction_begin; digit != digits.fraction_end; ++digit)
+            add_digit(*digit, true);
+
+        if (mantissa == 0)
+        {
+            value = negative ? -value_type{0} : value_type{0};
+            return {it, std::errc{}};
+        }
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+        // Clinger's fast path: Both the mantissa and the power of ten are exactly representable.
+        if (!truncated && exponent >= -format::max_exponent_fast_path && exponent <= format::max_exponent_fast_path
+            && mantissa <= format::max_mantissa_fast_path)
+        {
+            constexpr std::array<value_type, 23> powers_of_ten{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                               1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                               1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+            value_type result = static_cast<value_type>(mantissa);
+            if (exponent < 0)
+                result /= powers_of_ten[-exponent];
+            else
+                result *= powers_of_ten[exponent];
+
+            value = negative ? -result : result;
+            return {it, std::errc{}};
+        }
+#endif
+
+        adjusted_mantissa am = compute_float<value_type>(exponent, mantissa);
+        if (truncated)
+        {
+            // The exact value lies in [mantissa, mantissa + 1) * 10^exponent.
+            adjusted_mantissa const upper = compute_float<value_type>(exponent, mantissa + 1);
+            if (am != upper)
+                am = round_exactly<value_type>(digits, am, upper);
+        }
+
+        if (am.power2 == format::infinite_power || (am.power2 == 0 && am.mantissa == 0))
+            return {it, std::errc::result_out_of_range};
+
+        value = assemble<value_type>(negative, am);
+        return {it, std::errc{}};
+    }
+}
+
+} // namespace sharg::contrib::charconv_float::detail
+
+// =========================================================================
+// The shim-implementation. Imported into std by sharg/std/charconv if the float implementation is missing.
+// =========================================================================
+
+namespace sharg::contrib::charconv_float
+{
+using ::std::chars_format;
+using ::std::from_chars_result;
+using ::std::to_chars_result;
+
+// -----------------------------------------------------------------------------
+// to_chars for floating point types
+// -----------------------------------------------------------------------------
+
+/*!\brief std::to_chars overload for floating point with default base = 10.
+ * \ingroup std
+ * \tparam floating_point_type The type to print; Must model std::is_floating_point_v.
+ * \param[in] first The start of the output range.
+ * \param[in] last  The end of the output range.
+ * \param[in] value The value to print.
+ * \returns A std::to_chars_result. On error, `ptr` is `last` and `ec` is std::errc::value_too_large.
+ *
+ * \details
+ *
+ * Prints the shortest representation that is parsed back to `value` by sharg::contrib::charconv_float::from_chars.
+ * Like std::to_chars without format, fixed notation is used if it is not longer than scientific notation.
+ * If several representations of the same length exist, the closest to `value` is chosen.
+ *
+ * float and double use the Ryu algorithm and never allocate. long double uses a std::ostringstream in the classic
+ * locale, increasing the precision until the value round-trips.
+ */
+template <typename floating_point_type>
+    requires std::is_floating_point_v<floating_point_type>
+inline to_chars_result to_chars(char * first, char * last, floating_point_type value) noexcept
+{
+    return detail::to_chars(first, last, value);
+}
+
+// -----------------------------------------------------------------------------
+// from_chars for floating point types
+// -----------------------------------------------------------------------------
+
+/*!\brief Parse a char sequence into an floating point value.
+ * \ingroup std
+ * \tparam floating_point_type The type to parse the string into; Must model std::is_floating_point_v.
+ * \param[in]      first The start of the string to parse.
+ * \param[in]      last  The end of the string to parse.
+ * \param[in, out] value The value to store the parsed result in.
+ * \param[in]      fmt   The std::chars_format that alters the behaviour of parsing.
+ * \returns A std::from_char_result. See detail section return value for more information.
+ *
+ * \details
+ *
+ * Analyzes the character sequence [first,last) for a pattern described below.
+ * If no characters match the pattern or if the value obtained by parsing the
+ * matched characters is not representable in the type of value, value is
+ * unmodified, otherwise the characters matching the pattern are interpreted as
+ * a text representation of an arithmetic value, which is stored in value.
+ *
+ * Floating-point parsers: Expects the pattern identical to the one used by
+ * std::strtod in the default ("C") locale, except that:
+ *
+ * - the plus sign is not recognized outside of the exponent (only the minus
+ *   sign is permitted at the beginning)
+ * - if fmt has std::chars_format::scientific set but not std::chars_format::fixed,
+ *   the exponent part is required (otherwise it is optional)
+ * - if fmt has std::chars_format::fixed set but not std::chars_format::scientific,
+ *   the optional exponent is not permitted
+ * - if fmt is std::chars_format::hex, the prefix "0x" or "0X" is not permitted
+ *   (the string "0x123" parses as the value "0" with unparsed remainder "x123").
+ *
+ * float and double are rounded correctly to nearest (ties to even) with the Eisel-Lemire algorithm, falling back
+ * to an exact big integer comparison for inputs with more than 19 significant digits. The input is never copied.
+ *
+ * ### Return value
+ * On success, std::from_chars_result::ec is value-initialized and std::from_chars_result::ptr points to the first
+ * character not matching the pattern. On error, std::from_chars_result::ec is either
+ * std::errc::invalid_argument if no characters match the pattern (std::from_chars_result::ptr is `first`), or
+ * std::errc::result_out_of_range if the value over- or underflows (std::from_chars_result::ptr points to the first
+ * character not matching the pattern).
+ *
+ * ### The locale issue
+ * std::from_chars is documented to be locale independent. The accepted patterns
+ * are identical to the one used by strtod in the default ("C") locale.
+ *
+ * float and double do not depend on the locale. long double is delegated to std::strtold after the pattern was
+ * matched; the decimal point is replaced by the one of the current locale before.
+ *
+ * \sa https://en.cppreference.com/w/cpp/utility/from_chars
+ */
+template <typename floating_point_type>
+    requires std::is_floating_point_v<floating_point_type>
+inline from_chars_result from_chars(char const * first,
+                                    char const * last,
+                                    floating_point_type & value,
+                                    chars_format fmt = chars_format::general) noexcept
+{
+    return detail::from_chars(first, last, value, fmt);
+}
+} // namespace sharg::contrib::charconv_float
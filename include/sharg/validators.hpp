@@ -21,6 +21,12 @@
 #include <sharg/detail/to_string.hpp>
 #include <sharg/exceptions.hpp>
 
+namespace sharg::detail
+{
+class format_completion;
+class format_json;
+} // namespace sharg::detail
+
 namespace sharg
 {
 
@@ -139,6 +145,9 @@ public:
     }
 
 private:
+    //!\brief Befriend sharg::detail::format_json to grant access to the range for the JSON schema.
+    friend class detail::format_json;
+
     //!\brief Minimum of the range to test.
     option_value_type min{};
 
@@ -263,6 +272,11 @@ public:
     }
 
 private:
+    //!\brief Befriend sharg::detail::format_json to grant access to the values for the JSON schema.
+    friend class detail::format_json;
+    //!\brief Befriend sharg::detail::format_completion to grant access to the values for shell completion.
+    friend class detail::format_completion;
+
     //!\brief Minimum of the range to test.
     std::vector<option_value_type> values{};
 };
@@ -487,6 +501,9 @@ protected:
         return true;
     }
 
+    //!\brief Befriend sharg::detail::format_completion to grant access to the extensions for shell completion.
+    friend class detail::format_completion;
+
     //!\brief Stores the extensions.
     std::vector<std::string> extensions{};
 
@@ -1032,6 +1049,9 @@ public:
     }
 
 private:
+    //!\brief Befriend sharg::detail::format_json to grant access to the pattern for the JSON schema.
+    friend class detail::format_json;
+
     //!\brief The pattern to match.
     std::string pattern;
 };
@@ -1181,4 +1201,16 @@ auto operator|(validator1_type && vali1, validator2_type && vali2)
     return detail::validator_chain_adaptor{std::forward<validator1_type>(vali1), std::forward<validator2_type>(vali2)};
 }
 
+#if SHARG_COMPILED_LIBRARY
+//!\cond
+// Instantiated once in sharg::sharg_compiled.
+extern template class arithmetic_range_validator<int32_t>;
+extern template class arithmetic_range_validator<uint32_t>;
+extern template class arithmetic_range_validator<int64_t>;
+extern template class arithmetic_range_validator<uint64_t>;
+extern template class arithmetic_range_validator<double>;
+extern template class value_list_validator<std::string>;
+//!\endcond
+#endif
+
 } // namespace sharg
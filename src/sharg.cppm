@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the `sharg` C++20 module interface.
+ *
+ * This module interface unit is only compiled when linking against the opt-in `sharg::sharg_module` CMake target.
+ * It wraps the regular headers in the global module fragment and exports the public API, i.e. a tool can write
+ * `import sharg;` instead of `#include <sharg/all.hpp>`. The headers remain the primary (and fallback) interface.
+ */
+
+module;
+
+#include <sharg/all.hpp>
+
+export module sharg;
+
+export namespace sharg
+{
+
+// auxiliary.hpp
+using sharg::parser_meta_data;
+using sharg::update_notifications;
+
+// concept.hpp
+using sharg::istreamable;
+using sharg::ostreamable;
+using sharg::parsable;
+
+// config.hpp
+using sharg::config;
+using sharg::resource_kind;
+
+// config_file_watcher.hpp
+using sharg::config_file_watcher;
+
+// enumeration_names.hpp
+using sharg::enumeration_names;
+using sharg::named_enumeration;
+
+// exceptions.hpp
+using sharg::deserialisation_error;
+using sharg::design_error;
+using sharg::option_declared_multiple_times;
+using sharg::parser_error;
+using sharg::required_option_missing;
+using sharg::too_few_arguments;
+using sharg::too_many_arguments;
+using sharg::unknown_option;
+using sharg::user_input_error;
+using sharg::validation_error;
+
+// flag_set.hpp
+using sharg::flag_set;
+
+// parse_result.hpp
+using sharg::diagnostic;
+using sharg::diagnostic_kind;
+using sharg::parse_result;
+using sharg::parse_status;
+
+// parser.hpp
+using sharg::parser;
+
+// parser_schema.hpp
+using sharg::parser_schema;
+
+// validators.hpp
+using sharg::arithmetic_range_validator;
+using sharg::file_validator_base;
+using sharg::input_directory_validator;
+using sharg::input_file_validator;
+using sharg::output_directory_validator;
+using sharg::output_file_open_options;
+using sharg::output_file_validator;
+using sharg::regex_validator;
+using sharg::validator;
+using sharg::value_list_validator;
+using sharg::operator|;
+
+// version.hpp
+using sharg::sharg_version;
+using sharg::sharg_version_cstring;
+using sharg::sharg_version_major;
+using sharg::sharg_version_minor;
+using sharg::sharg_version_patch;
+
+} // namespace sharg
+
+// Customisation points must be specialisable from importing translation units.
+export namespace sharg::custom
+{
+using sharg::custom::parsing;
+} // namespace sharg::custom
+
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the explicit instantiations that make up the sharg::sharg_compiled library.
+ *
+ * \details
+ *
+ * This translation unit is only compiled when a target links against `sharg::sharg_compiled`.
+ * All targets linking against it are compiled with `SHARG_COMPILED_LIBRARY=1`, which makes the headers declare the
+ * instantiations below as `extern template`. Hence, the help page, man page and HTML rendering, the most common
+ * validator instantiations, and adding options of the most common types without a validator are compiled exactly once
+ * instead of in every translation unit.
+ */
+
+#include <sharg/parser.hpp>
+
+namespace sharg::detail
+{
+
+template class format_help_base<format_help>;
+#if SHARG_HAS_EXPORT_MAN
+template class format_help_base<format_man>;
+#endif
+#if SHARG_HAS_EXPORT_HTML
+template class format_help_base<format_html>;
+#endif
+
+} // namespace sharg::detail
+
+namespace sharg
+{
+
+template class arithmetic_range_validator<int32_t>;
+template class arithmetic_range_validator<uint32_t>;
+template class arithmetic_range_validator<int64_t>;
+template class arithmetic_range_validator<uint64_t>;
+template class arithmetic_range_validator<double>;
+template class value_list_validator<std::string>;
+
+template void parser::add_option(int32_t &, config<detail::default_validator>);
+template void parser::add_option(uint32_t &, config<detail::default_validator>);
+template void parser::add_option(int64_t &, config<detail::default_validator>);
+template void parser::add_option(uint64_t &, config<detail::default_validator>);
+template void parser::add_option(double &, config<detail::default_validator>);
+template void parser::add_option(std::string &, config<detail::default_validator>);
+template void parser::add_option(std::filesystem::path &, config<detail::default_validator>);
+template void parser::add_option(std::vector<std::string> &, config<detail::default_validator>);
+template void parser::add_option(std::vector<std::filesystem::path> &, config<detail::default_validator>);
+template void parser::add_flag(bool &, config<detail::default_validator>);
+template void parser::add_positional_option(std::string &, config<detail::default_validator>);
+template void parser::add_positional_option(std::filesystem::path &, config<detail::default_validator>);
+template void parser::add_positional_option(std::vector<std::string> &, config<detail::default_validator>);
+template void parser::add_positional_option(std::vector<std::filesystem::path> &, config<detail::default_validator>);
+
+} // namespace sharg
@@ -0,0 +1,97 @@
+# SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: BSD-3-Clause
+
+# Checks the output embedded by sharg_embed_exports:
+#
+#   cmake -DPROGRAM=<path/to/embed_exports> -DGENERATED=<embed_exports_sharg_exports.cpp> -P <script>
+
+cmake_minimum_required (VERSION 3.14)
+
+set (ENV{SHARG_NO_VERSION_CHECK} 1)
+
+# Runs the program with the given arguments and stores its output in `output_var`.
+function (run_program output_var)
+    execute_process (COMMAND "${PROGRAM}" ${ARGN}
+                     RESULT_VARIABLE result
+                     OUTPUT_VARIABLE output)
+
+    if (NOT result EQUAL 0)
+        message (FATAL_ERROR "`${PROGRAM} ${ARGN}` failed: ${result}")
+    endif ()
+
+    set (${output_var} "${output}" PARENT_SCOPE)
+endfunction ()
+
+# Returns the embedded output of `format` as hexadecimal digits.
+function (embedded_output output_var format)
+    file (READ "${GENERATED}" source)
+
+    set (entry "{\"${format}\", 0x([0-9a-f]+)ULL, \"[^\"]*\", ")
+    if (NOT source MATCHES "${entry}{reinterpret_cast<char const \\*>\\(([a-z_0-9]+)\\)")
+        message (FATAL_ERROR "${GENERATED} does not contain the ${format} output.")
+    endif ()
+
+    set (fingerprint "${CMAKE_MATCH_1}")
+    set (array "${CMAKE_MATCH_2}")
+
+    if (NOT source MATCHES "${array}\\[\\] = {([^}]*)}")
+        message (FATAL_ERROR "${GENERATED} does not contain ${array}.")
+    endif ()
+
+    string (REGEX REPLACE "0x|,|[ \n]" "" bytes "${CMAKE_MATCH_1}")
+    set (${output_var} "${bytes}" PARENT_SCOPE)
+    set (${output_var}_fingerprint "${fingerprint}" PARENT_SCOPE)
+endfunction ()
+
+# Returns `text` as hexadecimal digits.
+function (to_hex output_var text)
+    set (file "${GENERATED}.check")
+    file (WRITE "${file}" "${text}")
+    file (READ "${file}" hex HEX)
+    file (REMOVE "${file}")
+    set (${output_var} "${hex}" PARENT_SCOPE)
+endfunction ()
+
+# 1) The help page and the version are embedded with the fingerprint of the program.
+run_program (fingerprint --export-help fingerprint)
+string (STRIP "${fingerprint}" fingerprint)
+
+foreach (format help version)
+    embedded_output (embedded ${format})
+
+    if (NOT embedded_fingerprint STREQUAL fingerprint)
+        message (FATAL_ERROR "The ${format} output is embedded with the fingerprint ${embedded_fingerprint}, "
+                             "but the program has the fingerprint ${fingerprint}.")
+    endif ()
+endforeach ()
+
+# 2) The program prints the embedded help page.
+embedded_output (embedded help)
+run_program (help_page -h)
+to_hex (help_page_hex "${help_page}")
+
+if (NOT help_page_hex STREQUAL embedded)
+    message (FATAL_ERROR "The help page differs from the embedded one:\n${help_page}")
+endif ()
+
+if (NOT help_page MATCHES "Desc\\.")
+    message (FATAL_ERROR "The embedded help page is incomplete:\n${help_page}")
+endif ()
+
+# 3) A parser that is set up differently has another fingerprint and renders its help page.
+set (ENV{EMBED_EXPORTS_CHANGED} 1)
+run_program (changed_fingerprint --export-help fingerprint)
+string (STRIP "${changed_fingerprint}" changed_fingerprint)
+run_program (changed_help_page -h)
+unset (ENV{EMBED_EXPORTS_CHANGED})
+
+if (changed_fingerprint STREQUAL fingerprint)
+    message (FATAL_ERROR "Adding a flag does not change the fingerprint ${fingerprint}.")
+endif ()
+
+if (NOT changed_help_page MATCHES "--changed")
+    message (FATAL_ERROR "The changed program printed the embedded help page:\n${changed_help_page}")
+endif ()
+
+message (STATUS "The embedded exports of ${PROGRAM} are correct.")
@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <cstdlib>
+
+#include <sharg/all.hpp>
+
+int main(int argc, char ** argv)
+{
+    int val{};
+    bool changed{false};
+
+    sharg::parser parser{"Embed-Me-App", argc, argv, sharg::update_notifications::off};
+    parser.info.version = "1.0.0";
+    parser.add_option(val, sharg::config{.short_id = 'i', .long_id = "int", .description = "Desc."});
+
+    // Sets the parser up differently than when the exports were embedded.
+    if (std::getenv("EMBED_EXPORTS_CHANGED") != nullptr)
+        parser.add_flag(changed, sharg::config{.long_id = "changed", .description = "Added later."});
+
+    parser.parse();
+
+    return 0;
+}
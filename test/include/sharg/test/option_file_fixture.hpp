@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::test::option_file_fixture and sharg::test::option_file_values.
+ */
+
+#pragma once
+
+#include <fstream>
+
+#include <sharg/test/test_fixture.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+namespace sharg::test
+{
+
+/*!\brief A test fixture for files that option values are read from, e.g. with `--config` or `--import-params`.
+ * \details
+ * The file is removed after the test.
+ */
+class option_file_fixture : public test_fixture
+{
+protected:
+    //!\brief Creates the fixture for a temporary file called `file_name`.
+    explicit option_file_fixture(char const * const file_name) : tmp_name{file_name}
+    {}
+
+    //!\brief Manages the temporary file.
+    tmp_filename const tmp_name;
+    //!\brief The path of the file.
+    std::filesystem::path const file_path{tmp_name.get_path()};
+
+    //!\brief Overwrites the file with `contents`.
+    void write_file(std::string_view const contents) const
+    {
+        std::ofstream file{file_path};
+        file << contents;
+    }
+};
+
+//!\brief An option of each kind that can be read from an option file.
+struct option_file_values
+{
+    int threads{1};          //!< An option with a validator.
+    std::string name{};      //!< A string option.
+    std::vector<int> list{}; //!< A list option.
+    bool verbose{false};     //!< A flag with a short identifier.
+    bool fast{false};        //!< A flag with only a long identifier.
+
+    //!\brief Adds the options and flags to `parser`.
+    void add_to(sharg::parser & parser)
+    {
+        parser.add_option(threads,
+                          sharg::config{.short_id = 't',
+                                        .long_id = "threads",
+                                        .validator = sharg::arithmetic_range_validator{1, 64}});
+        parser.add_option(name, sharg::config{.long_id = "name"});
+        parser.add_option(list, sharg::config{.short_id = 'l', .long_id = "list"});
+        parser.add_flag(verbose, sharg::config{.short_id = 'v', .long_id = "verbose"});
+        parser.add_flag(fast, sharg::config{.long_id = "fast"});
+    }
+};
+
+} // namespace sharg::test
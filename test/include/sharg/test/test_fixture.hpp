@@ -60,9 +60,10 @@ private:
         return parser;
     }
 
+protected:
+    //!\brief Allows the test to exit, e.g. in EXPECT_EXIT or in a child process. Must be called again afterwards.
     static void toggle_guardian();
 
-protected:
     template <typename... arg_ts>
     static sharg::parser get_parser(arg_ts &&... arguments)
     {
@@ -96,12 +97,16 @@ protected:
                                                   "          Prints the version information.\n"
                                                   "    --copyright\n"
                                                   "          Prints the copyright/license information.\n"
+                                                  "    --help=pattern\n"
+                                                  "          Prints only the options and lines that contain the pattern.\n"
+                                                  "    --help-section=name\n"
+                                                  "          Prints only the sections whose title contains the name.\n"
                                                   "    --export-help (std::string)\n"
                                                   "          Export the help page information. Value must be one of "
 #if SHARG_HAS_TDL
-                                                  "[html, man,\n          ctd, cwl].\n";
+                                                  "[html, man,\n          ctd, cwl, json, bash, zsh, fish].\n";
 #else
-                                                  "[html, man].\n";
+                                                  "[html, man,\n          json, bash, zsh, fish].\n";
 #endif
 
     static inline std::string version_str(std::string_view const subcommand_with_dash)
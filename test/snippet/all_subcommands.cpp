@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+struct options
+{
+    std::filesystem::path input{};
+    int32_t hits{10};
+};
+
+// Adds the options of a subcommand. Used for the command line and for `--export-help <format> --all-subcommands`.
+void set_up(sharg::parser & sub_parser, options & opts)
+{
+    sub_parser.add_positional_option(opts.input, sharg::config{.description = "The input file."});
+
+    if (sub_parser.info.app_name == std::string_view{"mytool-search"})
+        sub_parser.add_option(opts.hits, sharg::config{.short_id = 'n', .description = "Number of hits."});
+}
+
+void run(std::vector<std::string> const & arguments)
+{
+    sharg::parser top_level_parser{"mytool", arguments, sharg::update_notifications::off, {"build", "search"}};
+    top_level_parser.set_subcommand_setup(
+        [](sharg::parser & sub_parser)
+        {
+            options unused{};
+            set_up(sub_parser, unused);
+        });
+
+    // E.g. `mytool --export-help cwl --all-subcommands` prints the CWL files of mytool, mytool-build and
+    // mytool-search, and exits.
+    top_level_parser.parse();
+
+    sharg::parser & sub_parser = top_level_parser.get_sub_parser();
+    options opts{};
+    set_up(sub_parser, opts);
+    sub_parser.parse();
+
+    std::cout << sub_parser.info.app_name << " reads " << opts.input << '\n';
+}
+
+int main(int argc, char ** argv)
+{
+    try
+    {
+        run({argv, argv + argc});
+    }
+    catch (sharg::parser_error const & ext)
+    {
+        std::cerr << "[Error] " << ext.what() << '\n';
+        std::exit(-1);
+    }
+
+    return 0;
+}
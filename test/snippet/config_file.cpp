@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <fstream>
+
+#include <sharg/all.hpp>
+
+int main()
+{
+    std::filesystem::path const config_path{std::filesystem::temp_directory_path() / "eat_me_app.ini"};
+
+    std::ofstream{config_path} << "# Settings for the Eat-Me-App\n"
+                                  "threads = 8\n"
+                                  "names = [\"Ann\", 'Bob']\n"
+                                  "verbose = true\n";
+
+    int threads{1};
+    std::vector<std::string> names{};
+    bool verbose{false};
+
+    sharg::parser parser{"Eat-Me-App", {"./Eat-Me-App", "--config", config_path.string(), "--threads", "2"}};
+    parser.add_config_file_option();
+    parser.add_option(threads, sharg::config{.short_id = 't', .long_id = "threads", .description = "Threads."});
+    parser.add_option(names, sharg::config{.long_id = "names", .description = "Names."});
+    parser.add_flag(verbose, sharg::config{.short_id = 'v', .long_id = "verbose", .description = "Verbose."});
+    parser.parse();
+
+    // The command line takes precedence over the configuration file.
+    std::cout << "threads: " << threads << '\n';
+    std::cout << "names: " << names[0] << ", " << names[1] << '\n';
+    std::cout << "verbose: " << std::boolalpha << verbose << '\n';
+
+    std::filesystem::remove(config_path);
+    return 0;
+}
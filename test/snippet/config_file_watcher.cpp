@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <fstream>
+
+#include <sharg/all.hpp>
+
+struct service_options
+{
+    int threads{1};
+    size_t batch_size{100};
+};
+
+int main()
+{
+    std::filesystem::path const config_path{std::filesystem::temp_directory_path() / "eat_me_service.ini"};
+    std::ofstream{config_path} << "threads = 4\n";
+
+    sharg::parser_schema<service_options> schema{};
+    schema.add_option(&service_options::threads,
+                      sharg::config{.long_id = "threads", .validator = sharg::arithmetic_range_validator{1, 64}});
+    schema.add_option(&service_options::batch_size, sharg::config{.long_id = "batch-size"});
+
+    sharg::config_file_watcher watcher{schema, config_path};
+    watcher.on_change(
+        [](auto const & snapshot, std::vector<std::string> const & changed_keys)
+        {
+            std::cout << "version " << snapshot.version << ": changed " << changed_keys.size() << " key(s)\n";
+        });
+    watcher.on_error(
+        [](sharg::parser_error const & error)
+        {
+            std::cout << "ignored: " << error.what() << '\n';
+        });
+    watcher.start(); // Reloads the file in the background whenever it changes.
+
+    // Each request of the service uses one consistent snapshot.
+    auto snapshot = watcher.current();
+    std::cout << "threads: " << snapshot->options.threads << '\n';
+
+    watcher.stop(); // For this example, the file is reloaded manually instead.
+    std::ofstream{config_path} << "threads = 8\nbatch-size = 50\n";
+    watcher.reload();
+    std::ofstream{config_path} << "threads = 100\nbatch-size = 50\n";
+    watcher.reload();
+
+    std::cout << "threads: " << watcher.current()->options.threads << '\n';
+
+    std::filesystem::remove(config_path);
+    return 0;
+}
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+// The underlying values are the bit indices.
+enum class feature
+{
+    prefetch,
+    simd,
+    stats
+};
+
+constexpr auto enumeration_names(feature)
+{
+    return std::array<std::pair<std::string_view, feature>, 3>{{{"prefetch", feature::prefetch},
+                                                                 {"simd", feature::simd},
+                                                                 {"stats", feature::stats}}};
+}
+
+int main()
+{
+    sharg::flag_set<feature> features{feature::simd};
+
+    sharg::parser parser{"Eat-Me-App", {"./Eat-Me-App", "--features", "prefetch,stats", "--features", "simd"}};
+    parser.add_option(features, sharg::config{.long_id = "features", .description = "Enabled features."});
+    parser.parse();
+
+    std::cout << "mask: " << features.mask() << '\n';
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        if (features.contains(feature::stats)) // a single bit test
+            std::cout << "Collecting statistics in round " << i << ".\n";
+    }
+
+    return 0;
+}
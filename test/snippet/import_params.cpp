@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <fstream>
+
+#include <sharg/all.hpp>
+
+int main()
+{
+    std::filesystem::path const job_path{std::filesystem::temp_directory_path() / "eat_me_app_job.yml"};
+
+    // A CWL job file as written by a workflow system. CTD files created by KNIME are read the same way.
+    std::ofstream{job_path} << "threads: 8\n"
+                               "names: [Ann, Bob]\n"
+                               "verbose: true\n"
+                               "positional_0:\n"
+                               "  class: File\n"
+                               "  path: input.txt\n";
+
+    int threads{1};
+    std::vector<std::string> names{};
+    bool verbose{false};
+    std::filesystem::path input{};
+
+    sharg::parser parser{"Eat-Me-App", {"./Eat-Me-App", "--import-params", job_path.string(), "--threads", "2"}};
+    parser.add_import_params_option();
+    parser.add_option(threads, sharg::config{.short_id = 't', .long_id = "threads", .description = "Threads."});
+    parser.add_option(names, sharg::config{.long_id = "names", .description = "Names."});
+    parser.add_flag(verbose, sharg::config{.short_id = 'v', .long_id = "verbose", .description = "Verbose."});
+    parser.add_positional_option(input, sharg::config{.description = "Input."});
+    parser.parse();
+
+    // The command line takes precedence over the job file.
+    std::cout << "threads: " << threads << '\n';
+    std::cout << "names: " << names[0] << ", " << names[1] << '\n';
+    std::cout << "verbose: " << std::boolalpha << verbose << '\n';
+    std::cout << "input: " << input.string() << '\n';
+
+    std::filesystem::remove(job_path);
+    return 0;
+}
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sstream>
+
+#include <sharg/all.hpp>
+
+// A long-running host answers each request with a fresh parser, e.g. in a job server.
+std::string run_request(std::vector<std::string> const & arguments)
+{
+    int hits{10};
+    sharg::parser parser{"search", arguments, sharg::update_notifications::off};
+    parser.info.short_description = "Search a database.";
+    parser.add_option(hits, sharg::config{.short_id = 'n', .long_id = "hits", .description = "Number of hits."});
+
+    std::ostringstream output{};
+
+    try
+    {
+        if (parser.parse(output) != sharg::parse_status::parsed)
+            return output.str().substr(0, output.str().find('\n')); // e.g. the first line of the help page
+    }
+    catch (sharg::parser_error const & ext) // the request is invalid
+    {
+        return std::string{"[PARSER ERROR] "} + ext.what();
+    }
+
+    return "Searching for " + std::to_string(hits) + " hits.";
+}
+
+int main()
+{
+    std::cout << run_request({"search", "--help"}) << '\n';
+    std::cout << run_request({"search", "-n", "3"}) << '\n';
+    std::cout << run_request({"search", "-n", "many"}) << '\n';
+    return 0;
+}
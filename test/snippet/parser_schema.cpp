@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sstream>
+
+#include <sharg/parser_schema.hpp>
+
+struct job
+{
+    std::string query{};
+    int hits{10};
+};
+
+int main()
+{
+    // Build the schema once, e.g. after loading a large index.
+    sharg::parser_schema<job> schema{};
+    schema.add_option(&job::query, sharg::config{.short_id = 'q', .long_id = "query", .required = true});
+    schema.add_option(&job::hits, sharg::config{.short_id = 'n', .long_id = "hits"});
+
+    // Each line is one job. Usually, this is a file or a socket.
+    std::istringstream jobs{"--query ACGT\n"
+                            "--query 'GGCC TTAA' -n 3\n"};
+
+    try
+    {
+        schema.parse_jobs(jobs,
+                          [](job && current)
+                          {
+                              std::cout << "Searching " << current.query << " (" << current.hits << " hits)\n";
+                          });
+    }
+    catch (sharg::parser_error const & ext) // the job is invalid
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << '\n';
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+struct arguments
+{
+    std::vector<std::string> queries{};
+    int threads{1};
+};
+
+// The options must be the same in the main process and in the workers.
+void add_options(sharg::parser & parser, arguments & args)
+{
+    parser.add_option(args.queries, sharg::config{.short_id = 'q', .long_id = "query"});
+    parser.add_option(args.threads,
+                      sharg::config{.short_id = 't',
+                                    .long_id = "threads",
+                                    .validator = sharg::arithmetic_range_validator{1, 64}});
+}
+
+int main()
+{
+    std::string blob{};
+
+    { // The main process parses and validates the command line.
+        arguments args{};
+        sharg::parser parser{"search",
+                             {"search", "-q", "ACGT", "-q", "GGCC", "-t", "8"},
+                             sharg::update_notifications::off};
+        add_options(parser, args);
+
+        try
+        {
+            parser.parse();
+        }
+        catch (sharg::parser_error const & ext) // the user did something wrong
+        {
+            std::cerr << "[PARSER ERROR] " << ext.what() << '\n';
+            return -1;
+        }
+
+        blob = parser.serialise(); // e.g. sent to the workers via a pipe
+    }
+
+    { // A worker restores the values without parsing and validating them again.
+        arguments args{};
+        sharg::parser parser{"search", {"search"}, sharg::update_notifications::off};
+        add_options(parser, args);
+        parser.deserialise(blob);
+
+        std::cout << "Searching " << args.queries.size() << " queries with " << args.threads << " threads.\n";
+        std::cout << "Option -q was given " << parser.occurrences('q') << " times.\n";
+    }
+
+    return 0;
+}
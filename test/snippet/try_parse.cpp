@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+int main()
+{
+    // Usually, the arguments are given via argc and argv.
+    std::vector<std::string> arguments{"./penguin_app", "-n", "many", "--colour", "black"};
+    sharg::parser myparser{"penguin_app", arguments, sharg::update_notifications::off};
+
+    int number_of_penguins{};
+    std::string size{};
+    myparser.add_option(number_of_penguins, sharg::config{.short_id = 'n', .description = "How many penguins?"});
+    myparser.add_option(size, sharg::config{.short_id = 's', .description = "Penguin size.", .required = true});
+
+    sharg::parse_result result = myparser.try_parse();
+
+    // All errors are reported, not only the first one.
+    for (sharg::diagnostic const & error : result.diagnostics())
+    {
+        if (error.argument_index != sharg::diagnostic::npos)
+            std::cout << "argv[" << error.argument_index << "]: ";
+
+        std::cout << error.message() << '\n';
+    }
+
+    return 0;
+}
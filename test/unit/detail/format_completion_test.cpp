@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+namespace foo
+{
+
+enum class bar
+{
+    one,
+    two
+};
+
+auto enumeration_names(bar)
+{
+    return std::unordered_map<std::string_view, bar>{{"one", bar::one}, {"two", bar::two}};
+}
+
+} // namespace foo
+
+class format_completion_test : public sharg::test::test_fixture
+{
+protected:
+    // Returns the completion script of a parser with an enum option, a file option, a hidden option and a positional
+    // directory option.
+    std::string get_script(std::string const & shell)
+    {
+        auto parser = get_parser("--export-help", shell);
+        parser.add_option(enum_value,
+                          sharg::config{.short_id = 'e', .long_id = "enum", .description = "An [enum]: it's\nnamed."});
+        parser.add_option(input,
+                          sharg::config{.long_id = "input", .validator = sharg::input_file_validator{{"fa", "fasta"}}});
+        parser.add_option(hidden_value, sharg::config{.long_id = "secret", .hidden = true});
+        parser.add_flag(flag_value, sharg::config{.short_id = 'f', .description = "A flag."});
+        parser.add_positional_option(output, sharg::config{.validator = sharg::output_directory_validator{}});
+
+        return get_parse_cout_on_exit(parser);
+    }
+
+    foo::bar enum_value{};
+    std::filesystem::path input{};
+    int hidden_value{};
+    bool flag_value{};
+    std::filesystem::path output{};
+};
+
+#define EXPECT_CONTAINS(output, text) EXPECT_NE(output.find(text), std::string::npos) << output
+
+TEST_F(format_completion_test, bash)
+{
+    std::string const output = get_script("bash");
+
+    EXPECT_TRUE(output.starts_with("# bash completion for test_parser\n"
+                                   "# Load it with: source <(test_parser --export-help bash)\n"
+                                   "\n"
+                                   "_sharg_test_parser()\n"))
+        << output;
+    EXPECT_CONTAINS(output,
+                    "        -e|--enum)\n"
+                    "            COMPREPLY=($(compgen -W 'one two' -- \"$cur\"))\n"
+                    "            return;;\n");
+    EXPECT_CONTAINS(output,
+                    "            COMPREPLY=($(compgen -d -- \"$cur\") $(compgen -f -X '!*.fa' -- \"$cur\") "
+                    "$(compgen -f -X '!*.fasta' -- \"$cur\"))\n");
+    EXPECT_CONTAINS(output, "COMPREPLY=($(compgen -W '-e --enum --input -f -h --help -hh --advanced-help");
+    EXPECT_CONTAINS(output, "    COMPREPLY=($(compgen -d -- \"$cur\"))\n}\n");
+    EXPECT_TRUE(output.ends_with("\ncomplete -F _sharg_test_parser test_parser\n")) << output;
+    EXPECT_EQ(output.find("secret"), std::string::npos) << output;
+}
+
+TEST_F(format_completion_test, zsh)
+{
+    std::string const output = get_script("zsh");
+
+    EXPECT_CONTAINS(output, "        '(-e --enum)'{-e+,--enum=}'[An \\[enum\\]\\: it'\\''s]:enum:(one two)'\n");
+    EXPECT_CONTAINS(output, "        --input='[]:input:_files -g \"*(.fa|.fasta)\"'\n");
+    EXPECT_CONTAINS(output, "        -f'[A flag.]'\n");
+    EXPECT_CONTAINS(output, "        '1:positional_0:_files -/'\n");
+    EXPECT_CONTAINS(output, "    _arguments -C : $arguments && return\n");
+    EXPECT_TRUE(output.ends_with("\ncompdef _sharg_test_parser test_parser\n")) << output;
+    EXPECT_EQ(output.find("secret"), std::string::npos) << output;
+}
+
+TEST_F(format_completion_test, fish)
+{
+    std::string const output = get_script("fish");
+
+    EXPECT_CONTAINS(output, "complete -c test_parser -s e -l enum -x -a 'one two' -d 'An [enum]: it\\'s'\n");
+    EXPECT_CONTAINS(output,
+                    "complete -c test_parser -l input -x -a "
+                    "'(__fish_complete_suffix .fa; __fish_complete_suffix .fasta)'\n");
+    EXPECT_CONTAINS(output, "complete -c test_parser -s f -d 'A flag.'\n");
+    EXPECT_CONTAINS(output, "complete -c test_parser -o hh -l advanced-help");
+    EXPECT_TRUE(output.ends_with("complete -c test_parser -f -a '(__fish_complete_directories)'\n")) << output;
+    EXPECT_EQ(output.find("secret"), std::string::npos) << output;
+}
+
+TEST_F(format_completion_test, subcommands)
+{
+    auto parser = get_subcommand_parser({"--export-help", "bash"}, {"build", "search"});
+    std::string output = get_parse_cout_on_exit(parser);
+
+    EXPECT_CONTAINS(output,
+                    "            build)\n"
+                    "                declare -F _sharg_test_parser_build > /dev/null && "
+                    "_sharg_test_parser_build \"$i\"\n"
+                    "                return;;\n");
+    EXPECT_CONTAINS(output, "    COMPREPLY=($(compgen -W 'build search' -- \"$cur\"))\n");
+
+    parser = get_subcommand_parser({"--export-help", "zsh"}, {"build", "search"});
+    output = get_parse_cout_on_exit(parser);
+
+    EXPECT_CONTAINS(output, "        '1:subcommand:(build search)'\n        '*::argument:->subcommand'\n");
+    EXPECT_CONTAINS(output, "(( $+functions[_sharg_test_parser_search] )) && _sharg_test_parser_search;;\n");
+
+    parser = get_subcommand_parser({"--export-help", "fish"}, {"build", "search"});
+    output = get_parse_cout_on_exit(parser);
+
+    EXPECT_CONTAINS(output,
+                    "complete -c test_parser -n 'not __fish_seen_subcommand_from build search' -f -a 'build search'\n");
+
+    // The script of a subcommand is registered by the top-level script.
+    parser = get_subcommand_parser({"build", "--export-help", "fish"}, {"build", "search"});
+    EXPECT_NO_THROW(parser.parse());
+    auto & sub_parser = parser.get_sub_parser();
+    output = get_parse_cout_on_exit(sub_parser);
+
+    EXPECT_CONTAINS(output, "complete -c test_parser -n '__fish_seen_subcommand_from build' -s h -l help");
+    EXPECT_EQ(output.find("Load it with"), std::string::npos) << output;
+}
@@ -347,4 +347,108 @@ TEST_F(format_cwl_test, subsubparser)
         "  - show\n";
     EXPECT_EQ(get_parse_cout_on_exit(sub_sub_parser), expected_short);
 }
+
+TEST_F(format_cwl_test, resource_requirements)
+{
+    uint16_t threads{4};
+    size_t memory{2};
+    int hidden_threads{3};
+
+    auto parser = get_parser("--export-help", "cwl");
+    parser.add_option(threads, sharg::config{.long_id = "threads", .resource = sharg::resource_kind::threads});
+    parser.add_option(memory,
+                      sharg::config{.long_id = "max-memory",
+                                    .required = true,
+                                    .resource = sharg::resource_kind::memory_gib});
+
+    std::string output = get_parse_cout_on_exit(parser);
+    EXPECT_TRUE(output.ends_with("  - test_parser\n"
+                                 "requirements:\n"
+                                 "  InlineJavascriptRequirement: {}\n"
+                                 "  ResourceRequirement:\n"
+                                 "    coresMin: \"$(inputs.threads === null ? 4 : inputs.threads)\"\n"
+                                 "    ramMin: \"$(inputs['max-memory'] * 1024)\"\n"))
+        << output;
+
+    // A required option in MiB is a parameter reference; a hidden option is not an input and its default is used.
+    parser = get_parser("--export-help", "cwl");
+    parser.add_option(memory,
+                      sharg::config{.long_id = "memory",
+                                    .required = true,
+                                    .resource = sharg::resource_kind::memory_mib});
+    parser.add_option(hidden_threads,
+                      sharg::config{.long_id = "threads", .hidden = true, .resource = sharg::resource_kind::threads});
+
+    output = get_parse_cout_on_exit(parser);
+    EXPECT_TRUE(output.ends_with("  - test_parser\n"
+                                 "requirements:\n"
+                                 "  ResourceRequirement:\n"
+                                 "    ramMin: \"$(inputs.memory)\"\n"
+                                 "    coresMin: 3\n"))
+        << output;
+    EXPECT_EQ(output.find("requirements:"), output.rfind("requirements:"));
+}
+
+TEST_F(format_cwl_test, merge_requirements)
+{
+    sharg::detail::cwl_requirements const requirements{{"InlineJavascriptRequirement", {}},
+                                                       {"ResourceRequirement", {{"coresMin", "4"}}}};
+
+    // No requirements yet; a missing final line break is added.
+    EXPECT_EQ(sharg::detail::merge_cwl_requirements("class: CommandLineTool\nbaseCommand:\n  - tool", requirements),
+              "class: CommandLineTool\n"
+              "baseCommand:\n"
+              "  - tool\n"
+              "requirements:\n"
+              "  InlineJavascriptRequirement: {}\n"
+              "  ResourceRequirement:\n"
+              "    coresMin: 4\n");
+
+    // A mapping by class name; listed classes are not repeated.
+    EXPECT_EQ(sharg::detail::merge_cwl_requirements("requirements:\n"
+                                                    "  InlineJavascriptRequirement: {}\n"
+                                                    "  ShellCommandRequirement: {}\n"
+                                                    "class: CommandLineTool\n",
+                                                    requirements),
+              "requirements:\n"
+              "  InlineJavascriptRequirement: {}\n"
+              "  ShellCommandRequirement: {}\n"
+              "  ResourceRequirement:\n"
+              "    coresMin: 4\n"
+              "class: CommandLineTool\n");
+
+    // A sequence of objects with a class, which may have nested entries.
+    EXPECT_EQ(sharg::detail::merge_cwl_requirements("requirements:\n"
+                                                    "  - class: \"InlineJavascriptRequirement\"\n"
+                                                    "    expressionLib:\n"
+                                                    "      - class: ResourceRequirement\n"
+                                                    "\n"
+                                                    "class: CommandLineTool\n",
+                                                    requirements),
+              "requirements:\n"
+              "  - class: \"InlineJavascriptRequirement\"\n"
+              "    expressionLib:\n"
+              "      - class: ResourceRequirement\n"
+              "  - class: ResourceRequirement\n"
+              "    coresMin: 4\n"
+              "\n"
+              "class: CommandLineTool\n");
+
+    // Empty flow collections keep their notation.
+    EXPECT_EQ(sharg::detail::merge_cwl_requirements("requirements: []\nclass: CommandLineTool\n", requirements),
+              "requirements:\n"
+              "  - class: InlineJavascriptRequirement\n"
+              "  - class: ResourceRequirement\n"
+              "    coresMin: 4\n"
+              "class: CommandLineTool\n");
+    EXPECT_EQ(sharg::detail::merge_cwl_requirements("requirements: {}\n", requirements),
+              "requirements:\n"
+              "  InlineJavascriptRequirement: {}\n"
+              "  ResourceRequirement:\n"
+              "    coresMin: 4\n");
+
+    EXPECT_THROW(sharg::detail::merge_cwl_requirements("requirements: [{class: ShellCommandRequirement}]\n",
+                                                       requirements),
+                 std::runtime_error);
+}
 #endif
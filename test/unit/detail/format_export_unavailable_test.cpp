@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compile out the HTML and man page export.
+#define SHARG_HAS_EXPORT_HTML 0
+#define SHARG_HAS_EXPORT_MAN 0
+// Without a definition (e.g. outside of CMake), the CTD and CWL export are not available.
+#undef SHARG_HAS_TDL
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+class format_export_unavailable_test : public sharg::test::test_fixture
+{
+protected:
+    static void expect_unavailable(sharg::parser & parser, std::string const & format_name)
+    {
+        int option_value{};
+        parser.add_option(option_value, sharg::config{.short_id = 'i'});
+
+        try
+        {
+            parser.parse();
+            FAIL() << "Expected sharg::validation_error.";
+        }
+        catch (sharg::validation_error const & error)
+        {
+            EXPECT_EQ(std::string{error.what()},
+                      "Validation failed for option --export-help: The export format " + format_name
+                          + " is not available in this build. Value must be one of "
+                          + sharg::detail::supported_exports + ".");
+        }
+    }
+};
+
+TEST_F(format_export_unavailable_test, supported_exports)
+{
+    EXPECT_EQ(SHARG_HAS_TDL, 0);
+    EXPECT_EQ(sharg::detail::supported_exports, "[json, bash, zsh, fish]");
+}
+
+TEST_F(format_export_unavailable_test, html)
+{
+    auto parser = get_parser("--export-help", "html");
+    expect_unavailable(parser, "html");
+}
+
+TEST_F(format_export_unavailable_test, man)
+{
+    auto parser = get_parser("--export-help=man");
+    expect_unavailable(parser, "man");
+}
+
+TEST_F(format_export_unavailable_test, tdl)
+{
+    auto parser = get_parser("--export-help", "ctd");
+    expect_unavailable(parser, "ctd");
+
+    parser = get_parser("--export-help", "cwl");
+    expect_unavailable(parser, "cwl");
+}
+
+TEST_F(format_export_unavailable_test, help_is_still_available)
+{
+    auto parser = get_parser("-h");
+    int option_value{};
+    parser.add_option(option_value, sharg::config{.short_id = 'i', .description = "An option."});
+
+    std::string help_page = get_parse_cout_on_exit(parser);
+    EXPECT_NE(help_page.find("An option."), std::string::npos);
+
+    // The list of formats may be wrapped.
+    for (size_t pos = help_page.find("\n          "); pos != std::string::npos; pos = help_page.find("\n          "))
+        help_page.replace(pos, 11u, " ");
+
+    EXPECT_NE(help_page.find("Value must be one of " + sharg::detail::supported_exports + "."), std::string::npos);
+}
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
 #include <ranges>
 
 #include <sharg/parser.hpp>
@@ -549,3 +550,266 @@ TEST_F(format_help_test, subcommand_parser)
                          + basic_options_str + "\n" + version_str();
     EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
 }
+
+TEST_F(format_help_test, parse_to_stream)
+{
+    // The output is the same as printed to std::cout, but the program does not exit.
+    auto check = [this](sharg::parse_status const expected_status, auto... arguments)
+    {
+        auto parser = get_parser(arguments...);
+        parser.add_option(option_value, sharg::config{.short_id = 'i'});
+        std_cout = get_parse_cout_on_exit(parser);
+
+        std::ostringstream stream{};
+        auto hosted_parser = get_parser(arguments...);
+        hosted_parser.add_option(option_value, sharg::config{.short_id = 'i'});
+        EXPECT_EQ(hosted_parser.parse(stream), expected_status);
+        EXPECT_EQ(stream.str(), std_cout);
+        EXPECT_FALSE(stream.str().empty());
+    };
+
+    check(sharg::parse_status::help_printed);
+    check(sharg::parse_status::help_printed, "-h");
+    check(sharg::parse_status::help_printed, "-hh");
+    check(sharg::parse_status::version_printed, "--version");
+    check(sharg::parse_status::copyright_printed, "--copyright");
+    check(sharg::parse_status::exported, "--export-help", "html");
+    check(sharg::parse_status::exported, "--export-help", "man");
+
+    // Regular parsing does not write to the stream.
+    std::ostringstream stream{};
+    auto parser = get_parser("-i", "3");
+    parser.add_option(option_value, sharg::config{.short_id = 'i'});
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::parsed);
+    EXPECT_EQ(option_value, 3);
+    EXPECT_TRUE(stream.str().empty());
+
+    // Errors are still thrown.
+    parser = get_parser("-i", "foo");
+    parser.add_option(option_value, sharg::config{.short_id = 'i'});
+    EXPECT_THROW(parser.parse(stream), sharg::user_input_error);
+    EXPECT_THROW(parser.parse(stream), sharg::design_error);
+}
+
+TEST_F(format_help_test, default_provider)
+{
+    size_t calls{};
+    auto provider = [&calls]()
+    {
+        ++calls;
+        return 42;
+    };
+
+    // The default is computed when printing the help page.
+    auto parser = get_parser("-h");
+    parser.add_option(option_value, sharg::config{.short_id = 'i', .description = "An int."}, provider);
+    parser.add_option(option_value,
+                      sharg::config{.short_id = 'j', .description = "Hidden.", .hidden = true},
+                      provider);
+    parser.add_option(option_value,
+                      sharg::config{.short_id = 'k', .description = "Message.", .default_message = "all cores"},
+                      provider);
+    std::ostringstream stream{};
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::help_printed);
+    EXPECT_EQ(calls, 1u);
+
+    expected = "test_parser\n"
+               "===========\n"
+               "\n"
+               "OPTIONS\n"
+               "    -i (signed 32 bit integer)\n"
+               "          An int. Default: 42\n"
+               "    -k (signed 32 bit integer)\n"
+               "          Message. Default: all cores\n"
+               "\n"
+             + basic_options_str + "\n" + version_str();
+    EXPECT_EQ(stream.str(), expected);
+
+    // The default is not computed for the version information.
+    calls = 0u;
+    parser = get_parser("--version");
+    parser.add_option(option_value, sharg::config{.short_id = 'i'}, provider);
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::version_printed);
+    EXPECT_EQ(calls, 0u);
+}
+
+// Counts the calls that write to the stream.
+class counting_buffer : public std::streambuf
+{
+public:
+    std::string text{};
+    size_t writes{};
+
+protected:
+    std::streamsize xsputn(char const * data, std::streamsize const count) override
+    {
+        ++writes;
+        text.append(data, count);
+        return count;
+    }
+
+    int_type overflow(int_type const c) override
+    {
+        ++writes;
+        text.push_back(traits_type::to_char_type(c));
+        return c;
+    }
+};
+
+TEST_F(format_help_test, single_write)
+{
+    auto check = [this](auto... arguments)
+    {
+        auto parser = get_parser(arguments...);
+        for (int i = 0; i < 300; ++i)
+            parser.add_option(option_value,
+                              sharg::config{.long_id = "option" + std::to_string(i),
+                                            .description = "A description that is long enough to be wrapped to the "
+                                                           "next line of the help page."});
+
+        counting_buffer buffer{};
+        std::ostream stream{&buffer};
+        parser.parse(stream);
+        EXPECT_EQ(buffer.writes, 1u);
+        EXPECT_FALSE(buffer.text.empty());
+    };
+
+    check("-h");
+    check("--version");
+    check("--copyright");
+    check("--export-help", "html");
+    check("--export-help", "man");
+}
+
+TEST_F(format_help_test, filter)
+{
+    int kmer_value{};
+    auto get_filtered_parser = [&](auto... arguments)
+    {
+        auto parser = get_parser(arguments...);
+        parser.add_positional_option(pos_opt_value, sharg::config{.description = "The input files."});
+        parser.add_option(option_value,
+                          sharg::config{.short_id = 't', .long_id = "threads", .description = "Number of threads."});
+        parser.add_section("Index");
+        parser.add_line("Options that control the index.");
+        parser.add_option(kmer_value, sharg::config{.long_id = "kmer", .description = "The K-mer size."});
+        parser.add_subsection("Tuning");
+        parser.add_flag(flag_value, sharg::config{.long_id = "fast", .description = "Be fast.", .advanced = true});
+        parser.add_list_item("--slow", "Is not available.", true);
+        return parser;
+    };
+
+    // Matches identifiers and descriptions, ignoring case.
+    auto parser = get_filtered_parser("--help=THREAD");
+    expected = "test_parser\n"
+               "===========\n"
+               "\n"
+               "OPTIONS\n"
+               "    -t, --threads (signed 32 bit integer)\n"
+               "          Number of threads. Default: 5\n";
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+
+    // Advanced options are matched; the headings of the sections of matching elements are printed.
+    parser = get_filtered_parser("--help=fast");
+    expected = "test_parser\n"
+               "===========\n"
+               "\n"
+               "INDEX\n"
+               "\n"
+               "  Tuning\n"
+               "    --fast\n"
+               "          Be fast.\n";
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+
+    // The positional options keep their number.
+    parser = get_filtered_parser("--help=input");
+    expected = "test_parser\n"
+               "===========\n"
+               "\n"
+               "POSITIONAL ARGUMENTS\n"
+               "    ARGUMENT-1 (List of std::string)\n"
+               "          The input files. Default: []\n";
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+
+    // A section includes its subsections.
+    parser = get_filtered_parser("--help-section", "index");
+    expected = "test_parser\n"
+               "===========\n"
+               "\n"
+               "INDEX\n"
+               "    Options that control the index.\n"
+               "    --kmer (signed 32 bit integer)\n"
+               "          The K-mer size. Default: 0\n"
+               "\n"
+               "  Tuning\n"
+               "    --fast\n"
+               "          Be fast.\n"
+               "    --slow\n"
+               "          Is not available.\n";
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+
+    // Both filters can be combined; the common options are a subsection of "Options".
+    parser = get_filtered_parser("--help-section=common", "--help=version");
+    expected = "test_parser\n"
+               "===========\n"
+               "\n"
+               "OPTIONS\n"
+               "\n"
+               "  Common options\n"
+               "    --version\n"
+               "          Prints the version information.\n";
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+
+    parser = get_filtered_parser("--help=nothing");
+    expected = "test_parser\n"
+               "===========\n"
+               "\n"
+               "OPTIONS\n"
+               "    No option matches the filter.\n";
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+
+    parser = get_filtered_parser("--help-section");
+    EXPECT_THROW(parser.parse(), sharg::too_few_arguments);
+}
+
+TEST_F(format_help_test, default_message_element_limit)
+{
+    std::vector<int> values(40);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto get_help_page = [&values](size_t const limit)
+    {
+        auto parser = get_parser("-h");
+        parser.info.default_message_element_limit = limit;
+        parser.add_option(values, sharg::config{.long_id = "values"});
+        std::string help_page = get_parse_cout_on_exit(parser);
+
+        // The default is wrapped.
+        for (size_t pos = help_page.find("\n          "); pos != std::string::npos;
+             pos = help_page.find("\n          "))
+            help_page.replace(pos, 11u, " ");
+
+        return help_page;
+    };
+
+    auto expected_default = [&values](size_t const count)
+    {
+        std::string expected{"Default: [0"};
+        for (size_t i = 1; i < count; ++i)
+            expected += ", " + std::to_string(i);
+        if (count < values.size())
+            expected += ", ... (" + std::to_string(values.size()) + " elements)";
+        return expected + "]";
+    };
+
+    EXPECT_EQ(sharg::parser_meta_data{}.default_message_element_limit, 32u);
+
+    std::string help_page = get_help_page(32u);
+    EXPECT_NE(help_page.find(expected_default(32u)), std::string::npos) << help_page;
+
+    help_page = get_help_page(3u);
+    EXPECT_NE(help_page.find(expected_default(3u)), std::string::npos) << help_page;
+
+    help_page = get_help_page(0u); // no limit
+    EXPECT_NE(help_page.find(expected_default(values.size())), std::string::npos) << help_page;
+}
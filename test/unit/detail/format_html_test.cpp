@@ -36,12 +36,16 @@ TEST_F(format_html_test, empty_information)
                     "<dd>Prints the version information.</dd>\n"
                     "<dt><strong>--copyright</strong></dt>\n"
                     "<dd>Prints the copyright/license information.</dd>\n"
+                    "<dt><strong>--help</strong>=pattern</dt>\n"
+                    "<dd>Prints only the options and lines that contain the pattern.</dd>\n"
+                    "<dt><strong>--help-section</strong>=name</dt>\n"
+                    "<dd>Prints only the sections whose title contains the name.</dd>\n"
                     "<dt><strong>--export-help</strong> (std::string)</dt>\n"
                     "<dd>Export the help page information. Value must be one of "
 #if SHARG_HAS_TDL
-                    "[html, man, ctd, cwl].</dd>\n"
+                    "[html, man, ctd, cwl, json, bash, zsh, fish].</dd>\n"
 #else
-                    "[html, man].</dd>\n"
+                    "[html, man, json, bash, zsh, fish].</dd>\n"
 #endif
                     "</dl>\n"
                     "<h2>Version</h2>\n"
@@ -151,12 +155,16 @@ TEST_F(format_html_test, full_information_information)
         "<dd>Prints the version information.</dd>\n"
         "<dt><strong>--copyright</strong></dt>\n"
         "<dd>Prints the copyright/license information.</dd>\n"
+        "<dt><strong>--help</strong>=pattern</dt>\n"
+        "<dd>Prints only the options and lines that contain the pattern.</dd>\n"
+        "<dt><strong>--help-section</strong>=name</dt>\n"
+        "<dd>Prints only the sections whose title contains the name.</dd>\n"
         "<dt><strong>--export-help</strong> (std::string)</dt>\n"
         "<dd>Export the help page information. Value must be one of "
 #if SHARG_HAS_TDL
-        "[html, man, ctd, cwl].</dd>\n"
+        "[html, man, ctd, cwl, json, bash, zsh, fish].</dd>\n"
 #else
-        "[html, man].</dd>\n"
+        "[html, man, json, bash, zsh, fish].</dd>\n"
 #endif
         "</dl>\n"
         "<h2>Examples</h2>\n"
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+namespace foo
+{
+
+enum class bar
+{
+    one,
+    two,
+    three
+};
+
+auto enumeration_names(bar)
+{
+    return std::unordered_map<std::string_view, bar>{{"one", bar::one}, {"two", bar::two}, {"three", bar::three}};
+}
+
+} // namespace foo
+
+class format_json_test : public sharg::test::test_fixture
+{};
+
+TEST_F(format_json_test, empty_information)
+{
+    auto parser = get_parser("--export-help", "json");
+    parser.info.version = "1.1.2-rc.1";
+    parser.info.short_description = "A \"short\" description\there.";
+
+    std::string const expected = "{\n"
+                                 "  \"$schema\": \"https://json-schema.org/draft/2020-12/schema\",\n"
+                                 "  \"title\": \"test_parser\",\n"
+                                 "  \"description\": \"A \\\"short\\\" description\\there.\",\n"
+                                 "  \"type\": \"object\",\n"
+                                 "  \"properties\": {},\n"
+                                 "  \"required\": [],\n"
+                                 "  \"x-sharg\": {\n"
+                                 "    \"name\": \"test_parser\",\n"
+                                 "    \"version\": \"1.1.2-rc.1\",\n"
+                                 "    \"url\": \"\",\n"
+                                 "    \"description\": [],\n"
+                                 "    \"executable\": [\"./test_parser\"],\n"
+                                 "    \"subcommands\": [],\n"
+                                 "    \"sharg_version\": \""
+                               + std::string{sharg::sharg_version_cstring}
+                               + "\"\n"
+                                 "  }\n"
+                                 "}\n";
+
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+}
+
+TEST_F(format_json_test, full_information)
+{
+    int option_value{5};
+    bool flag_value{false};
+    std::vector<std::string> list_pos_opt_value{};
+
+    auto parser = get_parser("--export-help", "json");
+    parser.info.version = "1.1.2-rc.1";
+    parser.info.description.push_back("description");
+    parser.add_option(option_value,
+                      sharg::config{.short_id = 'i',
+                                    .long_id = "int",
+                                    .description = "this is a int option.",
+                                    .validator = sharg::arithmetic_range_validator{-10, 10}});
+    parser.add_flag(flag_value, sharg::config{.short_id = 'f', .long_id = "flag", .description = "a flag."});
+    parser.add_positional_option(list_pos_opt_value, sharg::config{.description = "a list."});
+
+    std::string const expected =
+        "{\n"
+        "  \"$schema\": \"https://json-schema.org/draft/2020-12/schema\",\n"
+        "  \"title\": \"test_parser\",\n"
+        "  \"description\": \"\",\n"
+        "  \"type\": \"object\",\n"
+        "  \"properties\": {\n"
+        "    \"int\": {\n"
+        "      \"description\": \"this is a int option.\",\n"
+        "      \"type\": \"integer\",\n"
+        "      \"minimum\": -10,\n"
+        "      \"maximum\": 10,\n"
+        "      \"default\": 5,\n"
+        "      \"x-sharg\": {\"kind\": \"option\", \"short_id\": \"i\", \"long_id\": \"int\", "
+        "\"type\": \"signed 32 bit integer\", \"validator\": \"Value must be in range [-10,10].\", "
+        "\"default_message\": \"\", \"environment_variable\": \"\", \"resource\": \"\", \"advanced\": false, "
+        "\"hidden\": false}\n"
+        "    },\n"
+        "    \"flag\": {\n"
+        "      \"description\": \"a flag.\",\n"
+        "      \"type\": \"boolean\",\n"
+        "      \"default\": false,\n"
+        "      \"x-sharg\": {\"kind\": \"flag\", \"short_id\": \"f\", \"long_id\": \"flag\", \"type\": \"bool\", "
+        "\"validator\": \"\", \"default_message\": \"\", \"environment_variable\": \"\", \"resource\": \"\", "
+        "\"advanced\": false, \"hidden\": false}\n"
+        "    },\n"
+        "    \"positional_0\": {\n"
+        "      \"description\": \"a list.\",\n"
+        "      \"type\": \"array\",\n"
+        "      \"items\": {\"type\": \"string\"},\n"
+        "      \"default\": [],\n"
+        "      \"x-sharg\": {\"kind\": \"positional option\", \"short_id\": \"\", \"long_id\": \"\", \"type\": "
+        "\"std::string\", \"validator\": \"\", \"default_message\": \"\", \"environment_variable\": \"\", "
+        "\"resource\": \"\", \"advanced\": false, \"hidden\": false}\n"
+        "    }\n"
+        "  },\n"
+        "  \"required\": [\"positional_0\"],\n"
+        "  \"x-sharg\": {\n"
+        "    \"name\": \"test_parser\",\n"
+        "    \"version\": \"1.1.2-rc.1\",\n"
+        "    \"url\": \"\",\n"
+        "    \"description\": [\"description\"],\n"
+        "    \"executable\": [\"./test_parser\"],\n"
+        "    \"subcommands\": [],\n"
+        "    \"sharg_version\": \""
+        + std::string{sharg::sharg_version_cstring}
+        + "\"\n"
+          "  }\n"
+          "}\n";
+
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+}
+
+TEST_F(format_json_test, types_and_validators)
+{
+    double ratio{0.5};
+    foo::bar enum_value{foo::bar::two};
+    foo::bar restricted_enum_value{foo::bar::one};
+    std::string name{};
+    std::vector<int> numbers{1, 2};
+    unsigned threads{4};
+
+    auto parser = get_parser("--export-help", "json");
+    parser.add_option(ratio, sharg::config{.long_id = "ratio", .advanced = true});
+    parser.add_option(enum_value, sharg::config{.long_id = "enum"});
+    parser.add_option(restricted_enum_value,
+                      sharg::config{.long_id = "restricted", .validator = sharg::value_list_validator{foo::bar::one}});
+    parser.add_option(name,
+                      sharg::config{.short_id = 'n', .required = true, .validator = sharg::regex_validator{"[a-z]+"}});
+    parser.add_option(numbers, sharg::config{.long_id = "numbers", .environment_variable = "NUMBERS"});
+    parser.add_option(threads, sharg::config{.long_id = "threads", .resource = sharg::resource_kind::threads});
+
+    std::string const output = get_parse_cout_on_exit(parser);
+    auto contains = [&output](std::string_view const text)
+    {
+        return output.find(text) != std::string::npos;
+    };
+
+    EXPECT_TRUE(contains("\"type\": \"number\",\n      \"default\": 0.5,")) << output;
+    EXPECT_TRUE(contains("\"advanced\": true")) << output;
+    EXPECT_TRUE(contains("\"type\": \"string\",\n      \"enum\": [\"one\", \"three\", \"two\"],\n"
+                         "      \"default\": \"two\","))
+        << output;
+    EXPECT_TRUE(contains("\"enum\": [\"one\"],\n      \"default\": \"one\",")) << output;
+    EXPECT_TRUE(contains("\"n\": {\n      \"description\": \"\",\n      \"type\": \"string\",\n"
+                         "      \"pattern\": \"^(?:[a-z]+)$\",\n      \"x-sharg\""))
+        << output;
+    EXPECT_TRUE(contains("\"type\": \"array\",\n      \"items\": {\"type\": \"integer\"},\n"
+                         "      \"default\": [1, 2],"))
+        << output;
+    EXPECT_TRUE(contains("\"environment_variable\": \"NUMBERS\"")) << output;
+    EXPECT_TRUE(contains("\"resource\": \"threads\"")) << output;
+    EXPECT_TRUE(contains("\"required\": [\"n\"],")) << output;
+}
+
+TEST_F(format_json_test, subcommands)
+{
+    auto parser = get_subcommand_parser({"--export-help", "json"}, {"build", "search"});
+
+    std::string const output = get_parse_cout_on_exit(parser);
+    EXPECT_NE(output.find("\"subcommands\": [\"build\", \"search\"],"), std::string::npos) << output;
+}
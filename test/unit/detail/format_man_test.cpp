@@ -115,13 +115,25 @@ protected:
         "\n"
         R"(.TP)"
         "\n"
+        R"(\fB--help\fP=pattern)"
+        "\n"
+        R"(Prints only the options and lines that contain the pattern.)"
+        "\n"
+        R"(.TP)"
+        "\n"
+        R"(\fB--help-section\fP=name)"
+        "\n"
+        R"(Prints only the sections whose title contains the name.)"
+        "\n"
+        R"(.TP)"
+        "\n"
         R"(\fB--export-help\fP (std::string))"
         "\n"
         R"(Export the help page information. Value must be one of )"
 #if SHARG_HAS_TDL
-        "[html, man, ctd, cwl]."
+        "[html, man, ctd, cwl, json, bash, zsh, fish]."
 #else
-        "[html, man]."
+        "[html, man, json, bash, zsh, fish]."
 #endif
         "\n"
         R"(.SH EXAMPLES)"
@@ -226,13 +238,25 @@ TEST_F(format_man_test, empty_information)
                            "\n"
                            R"(.TP)"
                            "\n"
+                           R"(\fB--help\fP=pattern)"
+                           "\n"
+                           R"(Prints only the options and lines that contain the pattern.)"
+                           "\n"
+                           R"(.TP)"
+                           "\n"
+                           R"(\fB--help-section\fP=name)"
+                           "\n"
+                           R"(Prints only the sections whose title contains the name.)"
+                           "\n"
+                           R"(.TP)"
+                           "\n"
                            R"(\fB--export-help\fP (std::string))"
                            "\n"
                            R"(Export the help page information. Value must be one of )"
 #if SHARG_HAS_TDL
-                           "[html, man, ctd, cwl]."
+                           "[html, man, ctd, cwl, json, bash, zsh, fish]."
 #else
-                           "[html, man]."
+                           "[html, man, json, bash, zsh, fish]."
 #endif
                            "\n"
                            R"(.SH VERSION)"
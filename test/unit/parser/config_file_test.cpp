@@ -0,0 +1,312 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/option_file_fixture.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+class config_file_test : public sharg::test::option_file_fixture
+{
+protected:
+    config_file_test() : option_file_fixture{"config.ini"}
+    {}
+
+    std::string location(size_t const line) const
+    {
+        return "in the configuration file \"" + file_path.string() + "\" in line " + std::to_string(line);
+    }
+};
+
+struct options : sharg::test::option_file_values
+{
+    void add_to(sharg::parser & parser)
+    {
+        parser.add_config_file_option();
+        option_file_values::add_to(parser);
+    }
+};
+
+TEST_F(config_file_test, read_values)
+{
+    write_file("# A comment\n"
+                 "; another comment\n"
+                 "\n"
+                 "threads = 8   # a trailing comment\n"
+                 "name = \"a \\\"quoted\\\" name # not a comment\"\r\n"
+                 "list = [1, 2]\n"
+                 "list = 3\n"
+                 "verbose = true\n"
+                 "fast = false\n");
+
+    options values{};
+    auto parser = get_parser("--config", file_path.string());
+    values.add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+
+    EXPECT_EQ(values.threads, 8);
+    EXPECT_EQ(values.name, "a \"quoted\" name # not a comment");
+    EXPECT_EQ(values.list, (std::vector<int>{1, 2, 3}));
+    EXPECT_TRUE(values.verbose);
+    EXPECT_FALSE(values.fast);
+
+    // Values from the configuration file count as given.
+    EXPECT_TRUE(parser.is_option_set("threads"));
+    EXPECT_FALSE(parser.is_option_set('t'));
+    EXPECT_FALSE(parser.is_option_set("fast"));
+}
+
+TEST_F(config_file_test, command_line_takes_precedence)
+{
+    write_file("threads = 8\n"
+                 "name = 'from file'\n"
+                 "list = [1, 2]\n"
+                 "verbose = 1\n");
+
+    options values{};
+    auto parser = get_parser("-t", "4", "--config=" + file_path.string(), "-l", "9", "-v");
+    values.add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+
+    EXPECT_EQ(values.threads, 4);
+    EXPECT_EQ(values.name, "from file");
+    EXPECT_EQ(values.list, (std::vector<int>{9})); // the list is replaced, not merged
+    EXPECT_TRUE(values.verbose);
+}
+
+TEST_F(config_file_test, default_files)
+{
+    write_file("threads = 8\n");
+
+    int threads{1};
+    bool flag{false};
+    auto parser = get_parser("-x");
+    parser.add_config_file_option({"/this/file/does/not/exist.ini", file_path});
+    parser.add_option(threads, sharg::config{.long_id = "threads"});
+    parser.add_flag(flag, sharg::config{.short_id = 'x'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(threads, 8);
+
+    // An explicitly given file replaces the default.
+    sharg::test::tmp_filename const other_name{"other.ini"};
+    std::ofstream{other_name.get_path()} << "threads = 3\n";
+
+    threads = 1;
+    parser = get_parser("--config", other_name.get_path().string());
+    parser.add_config_file_option({file_path});
+    parser.add_option(threads, sharg::config{.long_id = "threads"});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(threads, 3);
+}
+
+TEST_F(config_file_test, default_file_without_arguments)
+{
+    // A required option can be set by a default file; the short help is only printed if there is no default file.
+    int threads{};
+    auto add_options = [&threads](sharg::parser & parser, std::vector<std::filesystem::path> default_files)
+    {
+        parser.add_config_file_option(std::move(default_files));
+        parser.add_option(threads, sharg::config{.long_id = "threads", .required = true});
+    };
+
+    write_file("threads = 8\n");
+
+    std::ostringstream stream{};
+    auto parser = get_parser();
+    add_options(parser, {file_path});
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::parsed);
+    EXPECT_EQ(threads, 8);
+    EXPECT_TRUE(stream.str().empty());
+
+    parser = get_parser();
+    add_options(parser, {"/this/file/does/not/exist.ini"});
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::help_printed);
+}
+
+TEST_F(config_file_test, default_provider)
+{
+    write_file("threads = 8\n");
+
+    int threads{};
+    size_t calls{};
+    auto parser = get_parser("--config", file_path.string());
+    parser.add_config_file_option();
+    parser.add_option(threads,
+                      sharg::config{.long_id = "threads"},
+                      [&calls]()
+                      {
+                          ++calls;
+                          return 2;
+                      });
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(threads, 8);
+    EXPECT_EQ(calls, 0u);
+}
+
+TEST_F(config_file_test, errors)
+{
+    auto parse = [this](std::string_view const contents, std::vector<std::string> arguments = {})
+    {
+        write_file(contents);
+        arguments.insert(arguments.begin(), {"--config", file_path.string()});
+
+        options values{};
+        auto parser = get_subcommand_parser(std::move(arguments), {});
+        values.add_to(parser);
+        parser.parse();
+    };
+
+    EXPECT_THROW_MSG(parse("threads = 100\n"),
+                     sharg::validation_error,
+                     "Validation failed for option -t/--threads: Value 100 is not in range [1,64].");
+    EXPECT_THROW_MSG(parse("threads = many\n"),
+                     sharg::user_input_error,
+                     "Value parse failed for --threads: Argument many could not be parsed as type signed 32 bit "
+                     "integer.");
+    EXPECT_THROW_MSG(parse("threads = 1\nthreads = 2\n"),
+                     sharg::option_declared_multiple_times,
+                     "Option --threads is no list/container but declared multiple times.");
+    EXPECT_THROW_MSG(parse("\nthread = 8\n"),
+                     sharg::unknown_option,
+                     "Unknown option thread " + location(2) + ". See -h/--help for program information.");
+    EXPECT_THROW_MSG(parse("t = 8\n"),
+                     sharg::unknown_option,
+                     "Unknown option t " + location(1) + ". See -h/--help for program information.");
+    EXPECT_THROW_MSG(parse("verbose = yes\n"),
+                     sharg::user_input_error,
+                     "Value for flag --verbose " + location(1) + " must be true (1) or false (0).");
+
+    // Errors in the command line are reported as well.
+    EXPECT_THROW(parse("threads = 8\n", {"--unknown"}), sharg::unknown_option);
+}
+
+TEST_F(config_file_test, syntax_errors)
+{
+    auto parse = [this](std::string_view const contents)
+    {
+        write_file(contents);
+
+        options values{};
+        auto parser = get_parser("--config", file_path.string());
+        values.add_to(parser);
+        parser.parse();
+    };
+
+    auto message = [this](size_t const line, std::string const & reason)
+    {
+        return "Error in the configuration file \"" + file_path.string() + "\" in line " + std::to_string(line)
+             + ": " + reason;
+    };
+
+    EXPECT_THROW_MSG(parse("threads\n"), sharg::user_input_error, message(1, "Missing '=' after the key."));
+    EXPECT_THROW_MSG(parse("\n= 8\n"), sharg::user_input_error, message(2, "Missing key before '='."));
+    EXPECT_THROW_MSG(parse("name = \"a\n"), sharg::user_input_error, message(1, "Missing closing quote."));
+    EXPECT_THROW_MSG(parse("name = 'a\n"), sharg::user_input_error, message(1, "Missing closing quote."));
+    EXPECT_THROW_MSG(parse("name = \"a\\x\"\n"),
+                     sharg::user_input_error,
+                     message(1, "Unknown escape sequence \"\\x\"."));
+    EXPECT_THROW_MSG(parse("name = \"a\" b\n"),
+                     sharg::user_input_error,
+                     message(1, "Unexpected characters \"b\"."));
+    EXPECT_THROW_MSG(parse("list = [1 2\n"),
+                     sharg::user_input_error,
+                     message(1, "Expected ',' or ']' after a value in the list."));
+    EXPECT_THROW_MSG(parse("list = [1, , 2]\n"),
+                     sharg::user_input_error,
+                     message(1, "Expected a value in the list."));
+    EXPECT_THROW_MSG(parse("[section\n"), sharg::user_input_error, message(1, "Missing ']' after the section name."));
+}
+
+TEST_F(config_file_test, missing_file)
+{
+    int threads{};
+    auto parser = get_parser("--config", "/this/file/does/not/exist.ini");
+    parser.add_config_file_option();
+    parser.add_option(threads, sharg::config{.long_id = "threads"});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Validation failed for option --config: Cannot read the configuration file "
+                     "\"/this/file/does/not/exist.ini\".");
+
+    parser = get_parser("-t", "3", "--config");
+    parser.add_config_file_option();
+    parser.add_option(threads, sharg::config{.short_id = 't'});
+    EXPECT_THROW_MSG(parser.parse(), sharg::too_few_arguments, "Option --config must be followed by a value.");
+
+    // The diagnostic refers to the value of --config.
+    parser = get_parser("-t", "3", "--config", "/this/file/does/not/exist.ini");
+    parser.add_config_file_option();
+    parser.add_option(threads, sharg::config{.short_id = 't'});
+    std::vector<sharg::diagnostic> const diagnostics = parser.try_parse().diagnostics();
+    ASSERT_EQ(diagnostics.size(), 1u);
+    EXPECT_EQ(diagnostics[0].kind, sharg::diagnostic_kind::validation_error);
+    EXPECT_EQ(diagnostics[0].argument_index, 4u);
+}
+
+TEST_F(config_file_test, subcommands)
+{
+    write_file("verbose = true\n"
+                 "[build]\n"
+                 "threads = 8\n"
+                 "[other]\n"
+                 "unknown = 1\n");
+
+    bool verbose{false};
+    auto top_level = get_subcommand_parser({"--config", file_path.string(), "build"}, {"build", "other"});
+    top_level.add_config_file_option();
+    top_level.add_flag(verbose, sharg::config{.long_id = "verbose"});
+    EXPECT_NO_THROW(top_level.parse());
+    EXPECT_TRUE(verbose);
+
+    int threads{};
+    sharg::parser & sub_parser = top_level.get_sub_parser();
+    sub_parser.add_option(threads, sharg::config{.long_id = "threads"});
+    EXPECT_NO_THROW(sub_parser.parse());
+    EXPECT_EQ(threads, 8);
+}
+
+TEST_F(config_file_test, not_enabled)
+{
+    int threads{};
+    auto parser = get_parser("--config", file_path.string());
+    parser.add_option(threads, sharg::config{.long_id = "threads"});
+    EXPECT_THROW(parser.parse(), sharg::unknown_option);
+
+    int config{};
+    parser = get_parser("--config", "1");
+    parser.add_option(config, sharg::config{.long_id = "config"});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(config, 1);
+    EXPECT_THROW_MSG(parser.add_config_file_option(),
+                     sharg::design_error,
+                     "add_config_file_option may only be used before calling parse().");
+
+    parser = get_parser("-h");
+    parser.add_option(config, sharg::config{.long_id = "config"});
+    EXPECT_THROW_MSG(parser.add_config_file_option(),
+                     sharg::design_error,
+                     "Long identifier 'config' was already used before.");
+}
+
+TEST_F(config_file_test, help_page)
+{
+    auto parser = get_parser("-h");
+    parser.add_config_file_option({"~/.app.ini"});
+
+    std::ostringstream stream{};
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::help_printed);
+
+    std::string const help = stream.str();
+    EXPECT_NE(help.find("    --config (std::filesystem::path)\n"
+                        "          Read option values from a configuration file. Options given on the\n"
+                        "          command line take precedence. Default: the first existing file of\n"
+                        "          [\"~/.app.ini\"]\n"),
+              std::string::npos)
+        << help;
+}
@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <fstream>
+
+#include <sharg/config_file_watcher.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+struct service_options
+{
+    int threads{1};
+    size_t batch_size{100};
+    std::vector<std::string> names{"default"};
+    bool verbose{false};
+};
+
+// Counts how often it is called.
+struct counting_validator
+{
+    using option_value_type = size_t;
+
+    std::shared_ptr<size_t> calls{std::make_shared<size_t>()};
+
+    void operator()(size_t const value) const
+    {
+        ++*calls;
+
+        if (value == 0u)
+            throw sharg::validation_error{"The batch size must be positive."};
+    }
+
+    std::string get_help_page_message() const
+    {
+        return {};
+    }
+};
+
+class config_file_watcher_test : public ::testing::Test
+{
+protected:
+    sharg::test::tmp_filename const tmp_name{"service.ini"};
+    std::filesystem::path const config_path{tmp_name.get_path()};
+    counting_validator validator{};
+    sharg::parser_schema<service_options> schema{};
+
+    void SetUp() override
+    {
+        schema.add_option(&service_options::threads,
+                          sharg::config{.short_id = 't',
+                                        .long_id = "threads",
+                                        .validator = sharg::arithmetic_range_validator{1, 64}});
+        schema.add_option(&service_options::batch_size,
+                          sharg::config{.long_id = "batch-size", .validator = validator});
+        schema.add_option(&service_options::names, sharg::config{.long_id = "names"});
+        schema.add_flag(&service_options::verbose, sharg::config{.long_id = "verbose"});
+    }
+
+    void write_config(std::string_view const contents) const
+    {
+        std::ofstream file{config_path};
+        file << contents;
+    }
+};
+
+TEST_F(config_file_watcher_test, initial_values)
+{
+    write_config("threads = 4\nnames = [a, b]\n[section]\nunknown = 1\n");
+
+    sharg::config_file_watcher watcher{schema, config_path};
+    auto snapshot = watcher.current();
+    EXPECT_EQ(snapshot->version, 0u);
+    EXPECT_EQ(snapshot->options.threads, 4);
+    EXPECT_EQ(snapshot->options.batch_size, 100u);
+    EXPECT_EQ(snapshot->options.names, (std::vector<std::string>{"a", "b"}));
+    EXPECT_FALSE(snapshot->options.verbose);
+    EXPECT_EQ(*validator.calls, 0u); // batch-size was not given
+
+    EXPECT_FALSE(watcher.reload()); // nothing changed
+    EXPECT_EQ(watcher.current(), snapshot);
+}
+
+TEST_F(config_file_watcher_test, initial_errors)
+{
+    write_config("threads = 100\n");
+    EXPECT_THROW_MSG((sharg::config_file_watcher{schema, config_path}),
+                     sharg::validation_error,
+                     "Validation failed for option -t/--threads: Value 100 is not in range [1,64].");
+
+    write_config("thread = 1\n");
+    EXPECT_THROW_MSG((sharg::config_file_watcher{schema, config_path}),
+                     sharg::unknown_option,
+                     "Unknown option thread in the configuration file \"" + config_path.string()
+                         + "\" in line 1. See -h/--help for program information.");
+
+    EXPECT_THROW((sharg::config_file_watcher{schema, "/this/file/does/not/exist.ini"}), sharg::validation_error);
+}
+
+TEST_F(config_file_watcher_test, reload_changed_keys)
+{
+    write_config("threads = 4\nbatch-size = 10\nverbose = true\nnames = a\n");
+
+    sharg::config_file_watcher watcher{schema, config_path};
+    EXPECT_EQ(*validator.calls, 1u);
+
+    std::vector<std::string> changed{};
+    size_t version{};
+    watcher.on_change(
+        [&](auto const & snapshot, std::vector<std::string> const & keys)
+        {
+            version = snapshot.version;
+            changed = keys;
+        });
+
+    // Only threads changed: the validator of batch-size is not run again.
+    write_config("threads = 8\nbatch-size = 10\nverbose = true\nnames = a\n");
+    auto const previous = watcher.current();
+    EXPECT_TRUE(watcher.reload());
+    EXPECT_EQ(version, 1u);
+    EXPECT_EQ(changed, std::vector<std::string>{"threads"});
+    EXPECT_EQ(*validator.calls, 1u);
+    EXPECT_EQ(watcher.current()->options.threads, 8);
+    EXPECT_EQ(watcher.current()->options.batch_size, 10u);
+    EXPECT_EQ(previous->options.threads, 4); // old snapshots are immutable
+
+    // Removed keys and flags that are switched off return to their default.
+    write_config("batch-size = 20\nverbose = false\n");
+    EXPECT_TRUE(watcher.reload());
+    EXPECT_EQ(version, 2u);
+    EXPECT_EQ(changed, (std::vector<std::string>{"batch-size", "names", "threads", "verbose"}));
+    EXPECT_EQ(*validator.calls, 2u);
+
+    service_options const & options = watcher.current()->options;
+    EXPECT_EQ(options.threads, 1);
+    EXPECT_EQ(options.batch_size, 20u);
+    EXPECT_EQ(options.names, std::vector<std::string>{"default"});
+    EXPECT_FALSE(options.verbose);
+}
+
+TEST_F(config_file_watcher_test, reload_errors)
+{
+    write_config("batch-size = 10\n");
+    sharg::config_file_watcher watcher{schema, config_path};
+
+    std::vector<std::string> errors{};
+    watcher.on_error(
+        [&errors](sharg::parser_error const & error)
+        {
+            errors.push_back(error.what());
+        });
+
+    write_config("batch-size = 0\n");
+    EXPECT_FALSE(watcher.reload());
+    write_config("batch-size = 10\nverbose = maybe\n");
+    EXPECT_FALSE(watcher.reload());
+    write_config("batch-size = 10\nthreads = [1\n");
+    EXPECT_FALSE(watcher.reload());
+
+    std::string const location = "in the configuration file \"" + config_path.string() + "\" in line 2";
+    EXPECT_EQ(errors,
+              (std::vector<std::string>{"Validation failed for option --batch-size: The batch size must be positive.",
+                                        "Value for flag --verbose " + location + " must be true (1) or false (0).",
+                                        "Error in the configuration file \"" + config_path.string()
+                                            + "\" in line 2: Expected ',' or ']' after a value in the list."}));
+
+    // The values are kept.
+    EXPECT_EQ(watcher.current()->version, 0u);
+    EXPECT_EQ(watcher.current()->options.batch_size, 10u);
+
+    // The invalid changes are parsed again once the file is valid.
+    write_config("batch-size = 30\n");
+    EXPECT_TRUE(watcher.reload());
+    EXPECT_EQ(watcher.current()->version, 1u);
+    EXPECT_EQ(watcher.current()->options.batch_size, 30u);
+}
+
+TEST_F(config_file_watcher_test, watch)
+{
+    write_config("threads = 4\n");
+    sharg::config_file_watcher watcher{schema, config_path};
+
+    std::mutex mutex{};
+    std::condition_variable changed{};
+    size_t version{};
+    watcher.on_change(
+        [&](auto const & snapshot, std::vector<std::string> const &)
+        {
+            std::lock_guard lock{mutex};
+            version = snapshot.version;
+            changed.notify_one();
+        });
+    watcher.start();
+
+    auto wait_for_version = [&](size_t const expected)
+    {
+        std::unique_lock lock{mutex};
+        return changed.wait_for(lock,
+                                std::chrono::seconds{10},
+                                [&]()
+                                {
+                                    return version == expected;
+                                });
+    };
+
+    // The file may be modified within the same second as it was created.
+    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    write_config("threads = 8\n");
+    EXPECT_TRUE(wait_for_version(1u));
+    EXPECT_EQ(watcher.current()->options.threads, 8);
+
+    // Replacing the file by a rename.
+    sharg::test::tmp_filename const other_name{"service.ini.new"};
+    std::ofstream{other_name.get_path()} << "threads = 16\n";
+    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    std::filesystem::rename(other_name.get_path(), config_path);
+    EXPECT_TRUE(wait_for_version(2u));
+    EXPECT_EQ(watcher.current()->options.threads, 16);
+
+    watcher.stop();
+}
@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+class embedded_exports_test : public sharg::test::test_fixture
+{
+protected:
+    int threads{1};
+    bool verbose{false};
+
+    void TearDown() override
+    {
+        sharg::detail::embedded_exports().clear();
+    }
+
+    void set_up(sharg::parser & parser)
+    {
+        parser.info.date = "2024-01-01";
+        parser.add_option(threads, sharg::config{.short_id = 't', .long_id = "threads", .description = "Threads."});
+        parser.add_flag(verbose, sharg::config{.long_id = "verbose", .description = "Be verbose."});
+    }
+
+    // Returns the output of the parser for the given arguments, set up by `set_up` and `more`.
+    template <typename... arg_ts>
+    std::string output(std::function<void(sharg::parser &)> more, arg_ts &&... arguments)
+    {
+        auto parser = get_parser(std::forward<arg_ts>(arguments)...);
+        set_up(parser);
+        more(parser);
+
+        std::ostringstream stream{};
+        parser.parse(stream);
+        return stream.str();
+    }
+
+    uint64_t fingerprint(std::function<void(sharg::parser &)> more = [](sharg::parser &) {})
+    {
+        std::string const hex = output(more, "--export-help", "fingerprint");
+        EXPECT_EQ(hex.size(), 17u) << hex;
+
+        uint64_t value{};
+        std::from_chars(hex.data(), hex.data() + hex.size(), value, 16);
+        return value;
+    }
+};
+
+TEST_F(embedded_exports_test, fingerprint)
+{
+    uint64_t const original = fingerprint();
+    EXPECT_EQ(fingerprint(), original);
+
+    // Everything that is printed changes the fingerprint.
+    EXPECT_NE(fingerprint(
+                  [](sharg::parser & parser)
+                  {
+                      parser.info.version = "2.0.0";
+                  }),
+              original);
+    EXPECT_NE(fingerprint(
+                  [this](sharg::parser &)
+                  {
+                      threads = 2;
+                  }),
+              original);
+    threads = 1;
+    EXPECT_NE(fingerprint(
+                  [](sharg::parser & parser)
+                  {
+                      parser.add_section("Section");
+                  }),
+              original);
+    EXPECT_NE(fingerprint(
+                  [](sharg::parser & parser)
+                  {
+                      parser.add_config_file_option();
+                  }),
+              original);
+    EXPECT_NE(fingerprint(
+                  [](sharg::parser & parser)
+                  {
+                      parser.info.default_message_element_limit = 3;
+                  }),
+              original);
+
+    // Hidden options are part of the CTD and CWL export.
+    EXPECT_NE(fingerprint(
+                  [](sharg::parser & parser)
+                  {
+                      static int hidden{};
+                      parser.add_option(hidden, sharg::config{.long_id = "hidden", .hidden = true});
+                  }),
+              original);
+}
+
+TEST_F(embedded_exports_test, embedded_output)
+{
+    auto nothing = [](sharg::parser &) {};
+    uint64_t const current = fingerprint();
+
+    sharg::detail::embedded_exports_registration const registration{{"man", current, "test_parser", "embedded man"},
+                                                                    {"help", current, "test_parser", "embedded help"},
+                                                                    {"version", 42u, "test_parser", "outdated"}};
+
+    EXPECT_EQ(output(nothing, "--export-help", "man"), "embedded man");
+    EXPECT_EQ(output(nothing, "--export-help=man"), "embedded man");
+
+    // Changing the parser after the output was embedded renders the current page.
+    std::string const live = output(
+        [](sharg::parser & parser)
+        {
+            parser.add_section("Section");
+        },
+        "--export-help",
+        "man");
+    EXPECT_TRUE(live.starts_with(".TH TEST_PARSER 1")) << live;
+    EXPECT_NE(output(nothing, "--version"), "outdated");
+
+    // Help pages are rendered for terminals.
+    if (sharg::detail::stdout_is_terminal())
+        GTEST_SKIP() << "The standard output is a terminal.";
+
+    EXPECT_EQ(output(nothing, "-h"), "embedded help");
+    EXPECT_NE(output(nothing, "-hh"), "embedded help");
+}
+
+TEST_F(embedded_exports_test, command)
+{
+    sharg::detail::embedded_exports_registration const registration{{"cwl", 1u, "app build", "cwl"},
+                                                                    {"man", 1u, "app build", "man"}};
+
+    EXPECT_EQ(sharg::detail::find_embedded_export("cwl", 1u, "app build"), "cwl");
+    EXPECT_EQ(sharg::detail::find_embedded_export("cwl", 1u, "./app build"), std::nullopt);
+    EXPECT_EQ(sharg::detail::find_embedded_export("cwl", 2u, "app build"), std::nullopt);
+    EXPECT_EQ(sharg::detail::find_embedded_export("man", 1u, "./app build"), "man");
+    EXPECT_EQ(sharg::detail::find_embedded_export("ctd", 1u, "app build"), std::nullopt);
+}
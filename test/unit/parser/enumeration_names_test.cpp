@@ -4,7 +4,9 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <ranges>
+#include <sstream>
 
 #include <sharg/parser.hpp>
 #include <sharg/test/expect_throw_msg.hpp>
@@ -52,9 +54,129 @@ struct parsing<Other::bar>
 
 } // namespace sharg::custom
 
+namespace compile_time
+{
+
+enum class bar
+{
+    one,
+    two,
+    three
+};
+
+// The names are given in an arbitrary order.
+constexpr auto enumeration_names(bar)
+{
+    return std::array<std::pair<std::string_view, bar>, 4>{{{"two", bar::two},
+                                                             {"one", bar::one},
+                                                             {"three", bar::three},
+                                                             {"3", bar::three}}};
+}
+
+// A large enumeration, e.g. a list of presets.
+enum class preset : uint16_t
+{
+};
+
+inline constexpr size_t preset_count{500};
+
+// "p000", "p001", ..., "p499"
+inline constexpr auto preset_name_storage = []()
+{
+    std::array<std::array<char, 4>, preset_count> storage{};
+    for (size_t i = 0; i < preset_count; ++i)
+        storage[i] = {'p',
+                      static_cast<char>('0' + i / 100),
+                      static_cast<char>('0' + i / 10 % 10),
+                      static_cast<char>('0' + i % 10)};
+    return storage;
+}();
+
+constexpr auto enumeration_names(preset)
+{
+    std::array<std::pair<std::string_view, preset>, preset_count> names{};
+    // Reverse order to check that the lookup does not rely on the order.
+    for (size_t i = 0; i < preset_count; ++i)
+        names[i] = {std::string_view{preset_name_storage[preset_count - 1 - i].data(), 4},
+                    static_cast<preset>(preset_count - 1 - i)};
+    return names;
+}
+
+} // namespace compile_time
+
+namespace Other
+{
+
+enum class baz
+{
+    one,
+    two
+};
+
+} // namespace Other
+
+namespace sharg::custom
+{
+
+template <>
+struct parsing<Other::baz>
+{
+    static constexpr std::array<std::pair<std::string_view, Other::baz>, 2> enumeration_names{
+        {{"one", Other::baz::one}, {"two", Other::baz::two}}};
+};
+
+} // namespace sharg::custom
+
 class enumeration_names_test : public sharg::test::test_fixture
 {};
 
+TEST_F(enumeration_names_test, constexpr_named_enumeration)
+{
+    EXPECT_FALSE(sharg::detail::constexpr_named_enumeration<foo::bar>);
+    EXPECT_FALSE(sharg::detail::constexpr_named_enumeration<Other::bar>);
+    EXPECT_TRUE(sharg::detail::constexpr_named_enumeration<compile_time::bar>);
+    EXPECT_TRUE(sharg::detail::constexpr_named_enumeration<compile_time::preset>);
+    EXPECT_TRUE(sharg::detail::constexpr_named_enumeration<Other::baz>);
+
+    // The lookup can be evaluated at compile time.
+    static_assert(*sharg::detail::find_enumeration_value<compile_time::bar>("3") == compile_time::bar::three);
+    static_assert(sharg::detail::find_enumeration_value<compile_time::bar>("four") == nullptr);
+    static_assert(sharg::detail::find_enumeration_name(compile_time::bar::three) == "three");
+    static_assert(*sharg::detail::find_enumeration_value<compile_time::preset>("p123")
+                  == static_cast<compile_time::preset>(123));
+    static_assert(sharg::detail::find_enumeration_name(static_cast<compile_time::preset>(499)) == "p499");
+    static_assert(sharg::detail::find_enumeration_name(static_cast<compile_time::preset>(500)).empty());
+}
+
+TEST_F(enumeration_names_test, constexpr_parse_and_print)
+{
+    compile_time::bar value{};
+    std::vector<compile_time::preset> presets{};
+    Other::baz value2{};
+
+    auto parser = get_parser("-e", "3", "-p", "p000", "-p", "p499", "-p", "p250", "-b", "two");
+    parser.add_option(value, sharg::config{.short_id = 'e'});
+    parser.add_option(presets, sharg::config{.short_id = 'p'});
+    parser.add_option(value2, sharg::config{.short_id = 'b'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_TRUE(value == compile_time::bar::three);
+    EXPECT_TRUE(presets
+                == (std::vector<compile_time::preset>{static_cast<compile_time::preset>(0),
+                                                      static_cast<compile_time::preset>(499),
+                                                      static_cast<compile_time::preset>(250)}));
+    EXPECT_TRUE(value2 == Other::baz::two);
+
+    std::ostringstream stream{};
+    stream << value << ' ' << presets[2] << ' ' << value2 << ' ' << static_cast<compile_time::bar>(42);
+    EXPECT_EQ(stream.str(), "three p250 two <UNKNOWN_VALUE>");
+
+    parser = get_parser("-e", "nine");
+    parser.add_option(value, sharg::config{.short_id = 'e'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "You have chosen an invalid input value: nine. Please use one of: [one, two, 3, three]");
+}
+
 TEST_F(enumeration_names_test, parse_success_enum_option)
 {
     foo::bar value{};
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+class environment_variable_test : public sharg::test::test_fixture
+{
+protected:
+    static constexpr char const * variables[]{"SHARG_TEST_THREADS", "SHARG_TEST_LIST", "SHARG_TEST_VERBOSE"};
+
+    void TearDown() override
+    {
+        for (char const * name : variables)
+            unsetenv(name);
+    }
+
+    int threads{1};
+    std::vector<int> list{7};
+    bool verbose{false};
+
+    void add_to(sharg::parser & parser)
+    {
+        parser.add_option(threads,
+                          sharg::config{.short_id = 't',
+                                        .long_id = "threads",
+                                        .environment_variable = "SHARG_TEST_THREADS",
+                                        .validator = sharg::arithmetic_range_validator{1, 64}});
+        parser.add_option(list, sharg::config{.short_id = 'l', .environment_variable = "SHARG_TEST_LIST"});
+        parser.add_flag(verbose, sharg::config{.short_id = 'v', .environment_variable = "SHARG_TEST_VERBOSE"});
+    }
+};
+
+TEST_F(environment_variable_test, unset)
+{
+    auto parser = get_parser("-t", "2");
+    add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(threads, 2);
+    EXPECT_EQ(list, std::vector<int>{7});
+    EXPECT_FALSE(verbose);
+}
+
+TEST_F(environment_variable_test, read_values)
+{
+    setenv("SHARG_TEST_THREADS", "8", 1);
+    setenv("SHARG_TEST_LIST", "3", 1);
+    setenv("SHARG_TEST_VERBOSE", "true", 1);
+
+    // Without any command line arguments, the values are still read.
+    auto parser = get_parser();
+    add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(threads, 8);
+    EXPECT_EQ(list, std::vector<int>{3}); // The value replaces the default.
+    EXPECT_TRUE(verbose);
+
+    // Values from the environment count as given.
+    EXPECT_TRUE(parser.is_option_set("threads"));
+    EXPECT_FALSE(parser.is_option_set('t'));
+    EXPECT_TRUE(parser.is_option_set('l'));
+}
+
+TEST_F(environment_variable_test, command_line_takes_precedence)
+{
+    setenv("SHARG_TEST_THREADS", "8", 1);
+    setenv("SHARG_TEST_LIST", "3", 1);
+    setenv("SHARG_TEST_VERBOSE", "0", 1);
+
+    auto parser = get_parser("--threads", "4", "-l", "5", "-l", "6", "-v");
+    add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(threads, 4);
+    EXPECT_EQ(list, (std::vector<int>{5, 6}));
+    EXPECT_TRUE(verbose);
+}
+
+TEST_F(environment_variable_test, precedence_over_config_file)
+{
+    sharg::test::tmp_filename const tmp_name{"config.ini"};
+    std::ofstream{tmp_name.get_path()} << "threads = 16\nverbose = true\nname = file\n";
+
+    setenv("SHARG_TEST_THREADS", "8", 1);
+    setenv("SHARG_TEST_VERBOSE", "false", 1);
+
+    std::string name{};
+    auto parser = get_parser("--config", tmp_name.get_path().string());
+    parser.add_config_file_option();
+    parser.add_option(threads, sharg::config{.long_id = "threads", .environment_variable = "SHARG_TEST_THREADS"});
+    parser.add_option(name, sharg::config{.long_id = "name"});
+    parser.add_flag(verbose, sharg::config{.long_id = "verbose", .environment_variable = "SHARG_TEST_VERBOSE"});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(threads, 8);
+    EXPECT_EQ(name, "file");
+    EXPECT_FALSE(verbose); // false in the environment overrides the configuration file
+}
+
+TEST_F(environment_variable_test, required_and_default_provider)
+{
+    setenv("SHARG_TEST_THREADS", "8", 1);
+
+    size_t calls{};
+    int other{};
+    auto parser = get_parser();
+    parser.add_option(threads,
+                      sharg::config{.long_id = "threads",
+                                    .required = true,
+                                    .environment_variable = "SHARG_TEST_THREADS"});
+    parser.add_option(other,
+                      sharg::config{.long_id = "other"},
+                      [&calls]()
+                      {
+                          ++calls;
+                          return 2;
+                      });
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(threads, 8);
+    EXPECT_EQ(other, 2);
+    EXPECT_EQ(calls, 1u);
+}
+
+TEST_F(environment_variable_test, errors)
+{
+    auto parse = [this]()
+    {
+        auto parser = get_parser("-l", "1");
+        add_to(parser);
+        parser.parse();
+    };
+
+    setenv("SHARG_TEST_THREADS", "100", 1);
+    EXPECT_THROW_MSG(parse(),
+                     sharg::validation_error,
+                     "Validation failed for option -t/--threads: Value 100 is not in range [1,64].");
+
+    setenv("SHARG_TEST_THREADS", "many", 1);
+    EXPECT_THROW_MSG(parse(),
+                     sharg::user_input_error,
+                     "Value parse failed for --threads: Argument many could not be parsed as type signed 32 bit "
+                     "integer.");
+    unsetenv("SHARG_TEST_THREADS");
+
+    setenv("SHARG_TEST_VERBOSE", "yes", 1);
+    EXPECT_THROW_MSG(parse(),
+                     sharg::user_input_error,
+                     "Value for flag -v in the environment variable SHARG_TEST_VERBOSE must be true (1) or false (0).");
+}
+
+TEST_F(environment_variable_test, design_errors)
+{
+    int value{};
+    auto parser = get_parser("-h");
+    parser.add_option(value, sharg::config{.short_id = 'a', .environment_variable = "SHARG_TEST_THREADS"});
+    EXPECT_THROW_MSG(
+        parser.add_option(value, sharg::config{.short_id = 'b', .environment_variable = "SHARG_TEST_THREADS"}),
+                     sharg::design_error,
+                     "Environment variable 'SHARG_TEST_THREADS' was already used before.");
+    EXPECT_THROW_MSG(parser.add_positional_option(value, sharg::config{.environment_variable = "SHARG_TEST_LIST"}),
+                     sharg::design_error,
+                     "A positional option cannot be bound to an environment variable.");
+}
+
+TEST_F(environment_variable_test, help_page)
+{
+    auto parser = get_parser("-h");
+    parser.add_option(threads,
+                      sharg::config{.short_id = 't',
+                                    .description = "Threads.",
+                                    .environment_variable = "SHARG_TEST_THREADS"});
+    parser.add_flag(verbose, sharg::config{.short_id = 'v', .environment_variable = "SHARG_TEST_VERBOSE"});
+
+    std::ostringstream stream{};
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::help_printed);
+
+    std::string const help = stream.str();
+    EXPECT_NE(help.find("Threads. Default: 1. Environment variable: SHARG_TEST_THREADS"), std::string::npos) << help;
+    EXPECT_NE(help.find("    -v\n          Environment variable: SHARG_TEST_VERBOSE\n"), std::string::npos) << help;
+}
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <ranges>
+#include <sstream>
+
+#include <sharg/flag_set.hpp>
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+class flag_set_test : public sharg::test::test_fixture
+{};
+
+enum class feature
+{
+    fast,
+    small,
+    verbose = 63
+};
+
+constexpr auto enumeration_names(feature)
+{
+    return std::array<std::pair<std::string_view, feature>, 3>{{{"fast", feature::fast},
+                                                                 {"small", feature::small},
+                                                                 {"verbose", feature::verbose}}};
+}
+
+// The names are not a constant expression.
+enum class colour
+{
+    red,
+    green
+};
+
+auto enumeration_names(colour)
+{
+    return std::unordered_map<std::string_view, colour>{{"red", colour::red}, {"green", colour::green}};
+}
+
+using features = sharg::flag_set<feature>;
+
+TEST_F(flag_set_test, concepts)
+{
+    EXPECT_TRUE(std::ranges::forward_range<features>);
+    EXPECT_TRUE(sharg::detail::is_container_option<features>);
+    EXPECT_FALSE(sharg::detail::is_fixed_size_container_option<features>);
+    EXPECT_TRUE((std::same_as<std::ranges::range_value_t<features>, feature>));
+    EXPECT_TRUE(std::is_trivially_copyable_v<features>);
+    EXPECT_EQ(sizeof(features), sizeof(uint64_t));
+}
+
+TEST_F(flag_set_test, bit_operations)
+{
+    constexpr features set{feature::fast, feature::verbose};
+    static_assert(set.contains(feature::fast));
+    static_assert(!set.contains(feature::small));
+    static_assert(set.mask() == (features::bit(feature::fast) | features::bit(feature::verbose)));
+    static_assert(set.size() == 2u);
+
+    features other{feature::small, feature::verbose};
+    EXPECT_EQ(set | other, (features{feature::fast, feature::small, feature::verbose}));
+    EXPECT_EQ(set & other, features{feature::verbose});
+    EXPECT_EQ(features::bit(feature::verbose), uint64_t{1} << 63);
+
+    other.erase(feature::verbose);
+    EXPECT_EQ(other, features{feature::small});
+    other.clear();
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(other.size(), 0u);
+    EXPECT_EQ(other.begin(), other.end());
+
+    std::vector<feature> values(set.begin(), set.end());
+    EXPECT_EQ(values, (std::vector<feature>{feature::fast, feature::verbose}));
+}
+
+TEST_F(flag_set_test, parse)
+{
+    features set{feature::small};
+
+    { // default is kept
+        auto parser = get_parser("-x");
+        bool flag{false};
+        parser.add_flag(flag, sharg::config{.short_id = 'x'});
+        parser.add_option(set, sharg::config{.long_id = "features"});
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_EQ(set, features{feature::small});
+    }
+
+    { // comma separated
+        auto parser = get_parser("--features", "verbose,fast");
+        parser.add_option(set, sharg::config{.long_id = "features"});
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_EQ(set, (features{feature::fast, feature::verbose}));
+    }
+
+    { // repeated and comma separated
+        auto parser = get_parser("--features", "fast", "--features=small,fast", "-f", "verbose");
+        parser.add_option(set, sharg::config{.short_id = 'f', .long_id = "features"});
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_EQ(set, (features{feature::fast, feature::small, feature::verbose}));
+    }
+
+    { // names are not a constant expression
+        sharg::flag_set<colour> colours{};
+        auto parser = get_parser("-c", "green,red");
+        parser.add_option(colours, sharg::config{.short_id = 'c'});
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_EQ(colours, (sharg::flag_set<colour>{colour::red, colour::green}));
+    }
+}
+
+TEST_F(flag_set_test, parse_error)
+{
+    for (std::string const input : {"fast,slow", "fast,", ",fast", ""})
+    {
+        features set{};
+        auto parser = get_parser("--features", input);
+        parser.add_option(set, sharg::config{.long_id = "features"});
+        EXPECT_THROW_MSG(parser.parse(),
+                         sharg::user_input_error,
+                         "You have chosen an invalid input value: " + input
+                             + ". Please use one of: [fast, small, verbose]");
+    }
+}
+
+TEST_F(flag_set_test, help_page)
+{
+    features set{feature::small, feature::fast};
+    auto parser = get_parser("-h");
+    parser.add_option(set, sharg::config{.short_id = 'f', .long_id = "features", .description = "Features."});
+
+    std::ostringstream stream{};
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::help_printed);
+    std::string const help = stream.str();
+    EXPECT_NE(help.find("-f, --features (Subset of [fast, small, verbose])"), std::string::npos) << help;
+    EXPECT_NE(help.find("Features. Default: [fast, small]"), std::string::npos) << help;
+}
+
+TEST_F(flag_set_test, serialise)
+{
+    features set{};
+    auto parser = get_parser("-f", "small,verbose");
+    parser.add_option(set, sharg::config{.short_id = 'f'});
+    parser.parse();
+
+    features restored{feature::fast};
+    auto worker = get_parser("ignored");
+    worker.add_option(restored, sharg::config{.short_id = 'f'});
+    worker.deserialise(parser.serialise());
+    EXPECT_EQ(restored, (features{feature::small, feature::verbose}));
+}
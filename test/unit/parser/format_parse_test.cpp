@@ -4,7 +4,10 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <ranges>
+#include <set>
+#include <unordered_set>
 
 #include <sharg/parser.hpp>
 #include <sharg/test/expect_throw_msg.hpp>
@@ -767,6 +770,51 @@ TEST_F(format_parse_test, is_option_set)
     expect_design_error('\0');
 }
 
+TEST_F(format_parse_test, occurrences_and_positions)
+{
+    std::vector<int> list{};
+    int single{};
+    bool flag_a{false};
+    bool flag_b{false};
+    bool flag_c{false};
+    std::string positional{};
+
+    auto parser = get_parser("-l", "1", "-ab", "--list=2", "-l3", "--single", "4", "--flag-c", "--", "-l");
+    parser.add_option(list, sharg::config{.short_id = 'l', .long_id = "list"});
+    parser.add_option(single, sharg::config{.short_id = 's', .long_id = "single"});
+    parser.add_flag(flag_a, sharg::config{.short_id = 'a'});
+    parser.add_flag(flag_b, sharg::config{.short_id = 'b'});
+    parser.add_flag(flag_c, sharg::config{.short_id = 'c', .long_id = "flag-c"});
+    parser.add_positional_option(positional, sharg::config{});
+
+    EXPECT_THROW(parser.occurrences('l'), sharg::design_error);
+    EXPECT_THROW(parser.positions('l'), sharg::design_error);
+
+    EXPECT_NO_THROW(parser.parse());
+
+    EXPECT_EQ(parser.occurrences('l'), 2u);
+    EXPECT_EQ(parser.occurrences("list"), 1u);
+    EXPECT_EQ(parser.occurrences("single"), 1u);
+    EXPECT_EQ(parser.occurrences('s'), 0u);
+    EXPECT_EQ(parser.occurrences("flag-c"), 1u);
+    EXPECT_EQ(parser.occurrences('c'), 0u);
+
+    EXPECT_TRUE(std::ranges::equal(parser.positions('l'), std::vector<size_t>{1, 5}));
+    EXPECT_TRUE(std::ranges::equal(parser.positions("list"), std::vector<size_t>{4}));
+    EXPECT_TRUE(std::ranges::equal(parser.positions("single"), std::vector<size_t>{6}));
+    EXPECT_TRUE(std::ranges::equal(parser.positions('a'), std::vector<size_t>{3}));
+    EXPECT_TRUE(std::ranges::equal(parser.positions('b'), std::vector<size_t>{3}));
+    EXPECT_TRUE(std::ranges::equal(parser.positions("flag-c"), std::vector<size_t>{8}));
+    EXPECT_TRUE(parser.positions('s').empty());
+
+    EXPECT_TRUE(parser.is_option_set('a'));
+    EXPECT_FALSE(parser.is_option_set('c'));
+    EXPECT_EQ(positional, "-l");
+
+    EXPECT_THROW(parser.occurrences("l"), sharg::design_error);
+    EXPECT_THROW(parser.positions('x'), sharg::design_error);
+}
+
 // https://github.com/seqan/seqan3/issues/2835
 TEST_F(format_parse_test, error_message_parsing)
 {
@@ -841,6 +889,85 @@ TEST_F(format_parse_test, container_default)
     EXPECT_TRUE(option_values == (std::vector<int>{2, 1, 3}));
 }
 
+TEST_F(format_parse_test, container_short_and_long_id)
+{
+    std::vector<int> option_values{1, 2, 3};
+
+    // Values given via the short and the long identifier are both kept.
+    auto parser = get_parser("-i", "2", "--int", "1", "-i", "3");
+    parser.add_option(option_values, sharg::config{.short_id = 'i', .long_id = "int"});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_values, (std::vector<int>{2, 3, 1}));
+}
+
+TEST_F(format_parse_test, set_options)
+{
+    std::set<std::string> ordered_ids{"default"};
+    std::unordered_set<int> unique_ids{};
+
+    auto parser = get_parser("-s", "b", "-u", "2", "-s", "a", "-u", "1", "-s", "b", "-u", "2");
+    parser.add_option(ordered_ids, sharg::config{.short_id = 's'});
+    parser.add_option(unique_ids, sharg::config{.short_id = 'u'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(ordered_ids, (std::set<std::string>{"a", "b"}));
+    EXPECT_EQ(unique_ids, (std::unordered_set<int>{1, 2}));
+
+    // Positional options.
+    std::set<int> positional_ids{};
+    parser = get_parser("3", "1", "2", "1");
+    parser.add_positional_option(positional_ids, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(positional_ids, (std::set<int>{1, 2, 3}));
+
+    // Values are validated.
+    parser = get_parser("-u", "2", "-u", "10");
+    parser.add_option(unique_ids, sharg::config{.short_id = 'u', .validator = sharg::arithmetic_range_validator{1, 5}});
+    EXPECT_THROW(parser.parse(), sharg::validation_error);
+}
+
+TEST_F(format_parse_test, fixed_size_options)
+{
+    std::array<double, 3> coordinates{0.5, 0.5, 0.5};
+    bool flag{false};
+
+    // use default
+    auto parser = get_parser("-f");
+    parser.add_option(coordinates, sharg::config{.short_id = 'c', .long_id = "coordinate"});
+    parser.add_flag(flag, sharg::config{.short_id = 'f'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(coordinates, (std::array<double, 3>{0.5, 0.5, 0.5}));
+
+    parser = get_parser("-c", "1", "-c", "2.5", "--coordinate=3");
+    parser.add_option(coordinates, sharg::config{.short_id = 'c', .long_id = "coordinate"});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(coordinates, (std::array<double, 3>{1.0, 2.5, 3.0}));
+
+    parser = get_parser("-c", "1", "-c", "2");
+    parser.add_option(coordinates, sharg::config{.short_id = 'c', .long_id = "coordinate"});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::too_few_arguments,
+                     "Wrong number of values for -c/--coordinate: 3 values are required but 2 were given.");
+
+    parser = get_parser("-c", "1", "-c", "2", "-c", "3", "-c", "4");
+    parser.add_option(coordinates, sharg::config{.short_id = 'c', .long_id = "coordinate"});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::too_many_arguments,
+                     "Wrong number of values for -c/--coordinate: 3 values are required but 4 were given.");
+
+    // Positional options.
+    std::array<int, 2> range{};
+    parser = get_parser("4", "7");
+    parser.add_positional_option(range, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(range, (std::array<int, 2>{4, 7}));
+
+    parser = get_parser("4");
+    parser.add_positional_option(range, sharg::config{});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::too_few_arguments,
+                     "Wrong number of values for positional option 1: 2 values are required but 1 were given.");
+}
+
 TEST_F(format_parse_test, executable_name)
 {
     bool flag{false};
@@ -949,3 +1076,52 @@ TEST_F(format_parse_test, parse_order_example)
     EXPECT_NO_THROW(parser.parse());
     EXPECT_EQ(flag_value, false);
 }
+
+TEST_F(format_parse_test, default_provider)
+{
+    size_t calls{};
+    auto provider = [&calls]()
+    {
+        ++calls;
+        return 42;
+    };
+
+    int option_value{};
+    std::vector<std::string> list_value{};
+    auto list_provider = []()
+    {
+        return std::vector<std::string>{"a", "b"};
+    };
+
+    // Not given: the provider is called once after parsing.
+    auto parser = get_parser("-l", "c");
+    parser.add_option(option_value, sharg::config{.short_id = 'i', .long_id = "int"}, provider);
+    parser.add_option(list_value, sharg::config{.short_id = 'l'}, list_provider);
+    EXPECT_EQ(calls, 0u);
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(calls, 1u);
+    EXPECT_EQ(option_value, 42);
+    EXPECT_FALSE(parser.is_option_set('i'));
+    EXPECT_EQ(list_value, (std::vector<std::string>{"c"}));
+
+    // Given via the short or the long identifier: the provider is not called.
+    for (std::string id : {"-i", "--int"})
+    {
+        calls = 0u;
+        parser = get_parser(id, "3");
+        parser.add_option(option_value, sharg::config{.short_id = 'i', .long_id = "int"}, provider);
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_EQ(calls, 0u);
+        EXPECT_EQ(option_value, 3);
+    }
+
+    // The default is not validated.
+    calls = 0u;
+    parser = get_parser("-l", "c");
+    parser.add_option(option_value,
+                      sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 10}},
+                      provider);
+    parser.add_option(list_value, sharg::config{.short_id = 'l'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_value, 42);
+}
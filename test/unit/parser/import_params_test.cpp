@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/option_file_fixture.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+class import_params_test : public sharg::test::option_file_fixture
+{
+protected:
+    import_params_test() : option_file_fixture{"params"}
+    {}
+
+    std::string message(std::string const & reason) const
+    {
+        return "Error in the parameter file \"" + file_path.string() + "\" " + reason;
+    }
+};
+
+// Parameter files also contain the positional options.
+struct options : sharg::test::option_file_values
+{
+    std::string input{};
+    std::vector<std::string> outputs{};
+
+    void add_to(sharg::parser & parser)
+    {
+        parser.add_import_params_option();
+        option_file_values::add_to(parser);
+        parser.add_positional_option(input, sharg::config{});
+        parser.add_positional_option(outputs, sharg::config{});
+    }
+};
+
+TEST_F(import_params_test, ctd)
+{
+    write_file(R"(<?xml version="1.0" encoding="UTF-8"?>
+<tool ctdVersion="1.7" name="app" version="1.0">
+  <!-- <ITEM name="threads" value="2"/> is commented out -->
+  <PARAMETERS version="1.7.0">
+    <NODE name="app" description="">
+      <ITEM name="threads" value="8" type="int" description="" restrictions="1:64"/>
+      <ITEM name="name" value="a &quot;quoted&quot; &amp; &#x263A; name" type="string"/>
+      <ITEMLIST name="list" type="int">
+        <LISTITEM value="1"/>
+        <LISTITEM value="2"/>
+      </ITEMLIST>
+      <ITEM name="verbose" value="true" type="bool"/>
+      <ITEM name="fast" value="false" type="bool"/>
+      <ITEM name="positional_0" value="in.fa" type="input-file"/>
+      <ITEMLIST name="positional_1" type="output-file">
+        <LISTITEM value="out1.fa"/>
+        <LISTITEM value="out2.fa"/>
+      </ITEMLIST>
+    </NODE>
+  </PARAMETERS>
+</tool>
+)");
+
+    options values{};
+    auto parser = get_parser("--import-params", file_path.string());
+    values.add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+
+    EXPECT_EQ(values.threads, 8);
+    EXPECT_EQ(values.name, "a \"quoted\" & ☺ name");
+    EXPECT_EQ(values.list, (std::vector<int>{1, 2}));
+    EXPECT_TRUE(values.verbose);
+    EXPECT_FALSE(values.fast);
+    EXPECT_EQ(values.input, "in.fa");
+    EXPECT_EQ(values.outputs, (std::vector<std::string>{"out1.fa", "out2.fa"}));
+    EXPECT_TRUE(parser.is_option_set("threads"));
+}
+
+TEST_F(import_params_test, cwl_job)
+{
+    write_file("# A comment\n"
+                 "threads: 8   # a trailing comment\n"
+                 "name: 'it''s # not a comment'\n"
+                 "list:\n"
+                 "- 1\n"
+                 "- 2\n"
+                 "verbose: true\n"
+                 "fast: null\n"
+                 "positional_0:\n"
+                 "  class: File\n"
+                 "  path: in.fa\n"
+                 "positional_1: [{class: File, location: \"file:///tmp/out1.fa\"}, out2.fa]\n");
+
+    options values{};
+    auto parser = get_parser("--import-params=" + file_path.string());
+    values.add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+
+    EXPECT_EQ(values.threads, 8);
+    EXPECT_EQ(values.name, "it's # not a comment");
+    EXPECT_EQ(values.list, (std::vector<int>{1, 2}));
+    EXPECT_TRUE(values.verbose);
+    EXPECT_FALSE(values.fast);
+    EXPECT_EQ(values.input, "in.fa");
+    EXPECT_EQ(values.outputs, (std::vector<std::string>{"/tmp/out1.fa", "out2.fa"}));
+}
+
+TEST_F(import_params_test, json_job)
+{
+    write_file(R"({
+  "threads": 8,
+  "name": "a \"quoted\" name",
+  "list": [1, 2],
+  "verbose": false,
+  "positional_0": {"class": "File", "path": "in.fa"},
+  "positional_1": []
+})");
+
+    options values{};
+    auto parser = get_parser("--import-params", file_path.string(), "a.fa", "b.fa");
+    values.add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+
+    EXPECT_EQ(values.threads, 8);
+    EXPECT_EQ(values.name, "a \"quoted\" name");
+    EXPECT_EQ(values.list, (std::vector<int>{1, 2}));
+    EXPECT_FALSE(values.verbose);
+    // Positional arguments on the command line replace all positional options of the file.
+    EXPECT_EQ(values.input, "a.fa");
+    EXPECT_EQ(values.outputs, std::vector<std::string>{"b.fa"});
+}
+
+TEST_F(import_params_test, unicode_escapes)
+{
+    // CWL runners may write JSON job files with \u escapes; code points above U+FFFF are UTF-16 surrogate pairs.
+    write_file(R"({"name": "caf\u00e9 \u263A \ud83d\ude00\tend",
+                    "positional_0": "in.fa",
+                    "positional_1": ["out.fa"]})");
+
+    options values{};
+    auto parser = get_parser("--import-params", file_path.string());
+    values.add_to(parser);
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(values.name, "caf\xc3\xa9 \xe2\x98\xba \xf0\x9f\x98\x80\tend");
+}
+
+TEST_F(import_params_test, precedence)
+{
+    write_file("threads: 8\nname: from file\nlist: [1, 2]\nverbose: false\n");
+
+    sharg::test::tmp_filename const config_name{"config.ini"};
+    std::ofstream{config_name.get_path()} << "name = from config\nverbose = true\nfast = true\n";
+
+    int threads{};
+    std::string name{};
+    std::vector<int> list{};
+    bool verbose{false};
+    bool fast{false};
+    auto parser = get_parser("-t", "4", "--import-params", file_path.string(), "--config", config_name.get_path());
+    parser.add_import_params_option();
+    parser.add_config_file_option();
+    parser.add_option(threads, sharg::config{.short_id = 't', .long_id = "threads"});
+    parser.add_option(name, sharg::config{.long_id = "name"});
+    parser.add_option(list, sharg::config{.long_id = "list"});
+    parser.add_flag(verbose, sharg::config{.long_id = "verbose"});
+    parser.add_flag(fast, sharg::config{.long_id = "fast"});
+    EXPECT_NO_THROW(parser.parse());
+
+    EXPECT_EQ(threads, 4);
+    EXPECT_EQ(name, "from file");
+    EXPECT_EQ(list, (std::vector<int>{1, 2}));
+    EXPECT_FALSE(verbose); // false in the parameter file overrides the configuration file
+    EXPECT_TRUE(fast);
+}
+
+TEST_F(import_params_test, subcommands)
+{
+    write_file("<PARAMETERS>\n"
+                 "  <ITEM name=\"verbose\" value=\"1\"/>\n"
+                 "  <NODE name=\"build\">\n"
+                 "    <ITEM name=\"threads\" value=\"8\"/>\n"
+                 "  </NODE>\n"
+                 "  <NODE name=\"other\">\n"
+                 "    <ITEM name=\"unknown\" value=\"1\"/>\n"
+                 "  </NODE>\n"
+                 "</PARAMETERS>\n");
+
+    bool verbose{false};
+    auto top_level = get_subcommand_parser({"--import-params", file_path.string(), "build"}, {"build", "other"});
+    top_level.add_import_params_option();
+    top_level.add_flag(verbose, sharg::config{.long_id = "verbose"});
+    EXPECT_NO_THROW(top_level.parse());
+    EXPECT_TRUE(verbose);
+
+    int threads{};
+    sharg::parser & sub_parser = top_level.get_sub_parser();
+    sub_parser.add_option(threads, sharg::config{.long_id = "threads"});
+    EXPECT_NO_THROW(sub_parser.parse());
+    EXPECT_EQ(threads, 8);
+}
+
+TEST_F(import_params_test, errors)
+{
+    auto parse = [this](std::string_view const contents)
+    {
+        write_file(contents);
+
+        options values{};
+        auto parser = get_parser("--import-params", file_path.string());
+        values.add_to(parser);
+        parser.parse();
+    };
+
+    EXPECT_THROW_MSG(parse("threads: 100\npositional_0: in.fa\n"),
+                     sharg::validation_error,
+                     "Validation failed for option -t/--threads: Value 100 is not in range [1,64].");
+    EXPECT_THROW_MSG(parse("thread: 8\n"),
+                     sharg::unknown_option,
+                     "Unknown option thread in the parameter file \"" + file_path.string()
+                         + "\". See -h/--help for program information.");
+    EXPECT_THROW_MSG(parse("<ITEM name=\"verbose\" value=\"yes\"/>"),
+                     sharg::user_input_error,
+                     "Value for flag --verbose in the parameter file \"" + file_path.string()
+                         + "\" must be true (1) or false (0).");
+    EXPECT_THROW_MSG(parse("list: [1, 2\n"), sharg::user_input_error, message("in line 1: Expected ',' or ']'."));
+    EXPECT_THROW_MSG(parse("name: \"a\n"), sharg::user_input_error, message("in line 1: Missing closing quote."));
+    EXPECT_THROW_MSG(parse("\nname: a\n  b: c\n"),
+                     sharg::user_input_error,
+                     message("in line 3: Unexpected indentation."));
+    EXPECT_THROW_MSG(parse("<ITEM name=\"name\" value=\"&unknown;\"/>"),
+                     sharg::user_input_error,
+                     message("in line 1: Unknown entity \"&unknown;\"."));
+    EXPECT_THROW_MSG(parse("<ITEM value=\"1\"/>"),
+                     sharg::user_input_error,
+                     message("in line 1: Missing attribute \"name\"."));
+    EXPECT_THROW_MSG(parse("- 1\n- 2\n"),
+                     sharg::user_input_error,
+                     message("in line 1: The document must be a mapping of parameter names to values."));
+    EXPECT_THROW_MSG(parse(R"(name: "\u12")"),
+                     sharg::user_input_error,
+                     message(R"(in line 1: Invalid escape sequence "\u12"".)"));
+    EXPECT_THROW_MSG(parse(R"(name: "\ud83d")"),
+                     sharg::user_input_error,
+                     message(R"(in line 1: Unpaired high surrogate in a \u escape sequence.)"));
+    EXPECT_THROW_MSG(parse(R"(name: "\ude00")"),
+                     sharg::user_input_error,
+                     message(R"(in line 1: Unpaired low surrogate in a \u escape sequence.)"));
+    // Deeply nested collections are rejected instead of overflowing the stack.
+    EXPECT_THROW_MSG(parse("name: " + std::string(10000u, '[') + std::string(10000u, ']') + "\n"),
+                     sharg::user_input_error,
+                     message("in line 1: The values are nested more than 100 levels deep."));
+
+    std::string nested_items{"name:\n  "};
+    for (size_t i = 0u; i < 10000u; ++i)
+        nested_items += "- ";
+    EXPECT_THROW_MSG(parse(nested_items + "a\n"),
+                     sharg::user_input_error,
+                     message("in line 2: The values are nested more than 100 levels deep."));
+    EXPECT_THROW_MSG(parse("name: [[a]]\n"),
+                     sharg::user_input_error,
+                     "Error in the parameter file \"" + file_path.string()
+                         + "\": A value must be a scalar, a list of scalars, or a File or Directory object.");
+}
+
+TEST_F(import_params_test, missing_file)
+{
+    int threads{};
+    auto parser = get_parser("--import-params", "/this/file/does/not/exist.yml");
+    parser.add_import_params_option();
+    parser.add_option(threads, sharg::config{.long_id = "threads"});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Validation failed for option --import-params: Cannot read the parameter file "
+                     "\"/this/file/does/not/exist.yml\".");
+
+    parser = get_parser("--import-params");
+    parser.add_import_params_option();
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::too_few_arguments,
+                     "Option --import-params must be followed by a value.");
+}
+
+TEST_F(import_params_test, not_enabled)
+{
+    int threads{};
+    auto parser = get_parser("--import-params", file_path.string());
+    parser.add_option(threads, sharg::config{.long_id = "threads"});
+    EXPECT_THROW(parser.parse(), sharg::unknown_option);
+
+    parser = get_parser("-h");
+    parser.add_option(threads, sharg::config{.long_id = "import-params"});
+    EXPECT_THROW_MSG(parser.add_import_params_option(),
+                     sharg::design_error,
+                     "Long identifier 'import-params' was already used before.");
+}
+
+TEST_F(import_params_test, help_page)
+{
+    auto parser = get_parser("-h");
+    parser.add_import_params_option();
+
+    std::ostringstream stream{};
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::help_printed);
+
+    std::string const help = stream.str();
+    EXPECT_NE(help.find("    --import-params (std::filesystem::path)\n"
+                        "          Read option values from a CTD file or a CWL job file. Options given\n"
+                        "          on the command line take precedence.\n"),
+              std::string::npos)
+        << help;
+}
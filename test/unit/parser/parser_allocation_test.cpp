@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+
+#include <sharg/parser.hpp>
+
+// Counts all global heap allocations of this test executable.
+static std::atomic<size_t> allocation_count{};
+
+void * operator new(size_t const size)
+{
+    ++allocation_count;
+
+    if (void * ptr = std::malloc(size == 0u ? 1u : size))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void * operator new(size_t const size, std::align_val_t const alignment)
+{
+    ++allocation_count;
+
+    size_t const align = static_cast<size_t>(alignment);
+    if (void * ptr = std::aligned_alloc(align, (size + align - 1u) / align * align))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+struct fifty_options
+{
+    std::vector<std::string> arguments{"./allocation_test"};
+    std::vector<sharg::config<sharg::arithmetic_range_validator<int>>> int_configs{};
+    std::vector<sharg::config<sharg::detail::default_validator>> flag_configs{};
+    std::array<int, 40> int_values{};
+    std::array<bool, 10> flag_values{};
+
+    fifty_options()
+    {
+        for (size_t i = 0; i < int_values.size(); ++i)
+        {
+            std::string long_id = "number-of-something-" + std::to_string(i);
+            arguments.push_back("--" + long_id);
+            arguments.push_back(std::to_string(i + 1));
+            int_configs.push_back(sharg::config{.long_id = long_id,
+                                                .description = "A description that is too long for any small buffer.",
+                                                .validator = sharg::arithmetic_range_validator{0, 100}});
+        }
+
+        for (size_t i = 0; i < flag_values.size(); ++i)
+        {
+            std::string long_id = "enable-some-feature-" + std::to_string(i);
+            arguments.push_back("--" + long_id);
+            flag_configs.push_back(sharg::config{.long_id = long_id, .description = "Flag description."});
+        }
+    }
+
+    // Constructs a parser with `option_count` options and parses their arguments. Returns the number of allocations.
+    size_t parse(std::pmr::memory_resource * resource, size_t const option_count)
+    {
+        size_t const int_count = std::min<size_t>(option_count, int_values.size());
+        std::vector<std::string> const used_arguments(arguments.begin(),
+                                                      arguments.begin() + 1 + 2 * int_count + option_count - int_count);
+
+        size_t const allocations_before = allocation_count;
+        {
+            sharg::parser parser{"allocation_test", used_arguments, sharg::update_notifications::off, {}, resource};
+
+            for (size_t i = 0; i < int_count; ++i)
+                parser.add_option(int_values[i], std::move(int_configs[i]));
+
+            for (size_t i = int_values.size(); i < option_count; ++i)
+                parser.add_flag(flag_values[i - int_values.size()], std::move(flag_configs[i - int_values.size()]));
+
+            parser.parse();
+        }
+        return allocation_count - allocations_before;
+    }
+};
+
+TEST(parser_allocation_test, fifty_options_with_arena)
+{
+    std::array<std::byte, 1u << 17> buffer{};
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    fifty_options fixture{};
+    size_t const allocations = fixture.parse(&arena, 50u);
+
+    EXPECT_EQ(fixture.int_values[0], 1);
+    EXPECT_EQ(fixture.int_values[39], 40);
+    EXPECT_TRUE(fixture.flag_values[9]);
+
+    // Only a small fixed overhead (the executable name) uses the global heap; nothing is allocated per option.
+    fifty_options one_option{};
+    EXPECT_EQ(allocations, one_option.parse(&arena, 1u));
+    EXPECT_LE(allocations, 4u);
+}
+
+TEST(parser_allocation_test, fifty_options_without_arena)
+{
+    fifty_options fixture{};
+    size_t const allocations = fixture.parse(std::pmr::new_delete_resource(), 50u);
+
+    EXPECT_EQ(fixture.int_values[39], 40);
+    // Every option needs at least its callable and its identifiers.
+    EXPECT_GT(allocations, 100u);
+}
@@ -74,6 +74,8 @@ TEST_F(verify_option_config_test, special_identifiers)
     EXPECT_THROW(parser.add_option(option_value, sharg::config{.long_id = "help"}), sharg::design_error);
     EXPECT_THROW(parser.add_option(option_value, sharg::config{.long_id = "advanced-help"}), sharg::design_error);
     EXPECT_THROW(parser.add_option(option_value, sharg::config{.long_id = "export-help"}), sharg::design_error);
+    EXPECT_THROW(parser.add_option(option_value, sharg::config{.long_id = "help-section"}), sharg::design_error);
+    EXPECT_THROW(parser.add_option(option_value, sharg::config{.long_id = "all-subcommands"}), sharg::design_error);
 }
 
 TEST_F(verify_option_config_test, single_character_long_id)
@@ -228,6 +230,78 @@ TEST_F(verify_default_message_config_test, flag_set)
                  sharg::design_error);
 }
 
+TEST_F(verify_default_message_config_test, required_option_with_default_provider)
+{
+    int option_value{};
+    auto provider = []()
+    {
+        return 42;
+    };
+
+    auto parser = get_parser("arg1");
+    EXPECT_THROW_MSG(parser.add_option(option_value, sharg::config{.long_id = "int", .required = true}, provider),
+                     sharg::design_error,
+                     "A required option cannot have a default provider.");
+}
+
+// -----------------------------------------------------------------------------
+// resource config verification
+// -----------------------------------------------------------------------------
+
+class verify_resource_config_test : public sharg::test::test_fixture
+{};
+
+TEST_F(verify_resource_config_test, non_integral_option)
+{
+    double option_value{};
+    bool bool_value{};
+
+    auto parser = get_parser();
+    EXPECT_THROW_MSG(
+        parser.add_option(option_value, sharg::config{.long_id = "mem", .resource = sharg::resource_kind::memory_gib}),
+        sharg::design_error,
+        "Only an integral option can control a resource (sharg::config::resource).");
+    EXPECT_THROW(
+        parser.add_option(bool_value, sharg::config{.long_id = "threads", .resource = sharg::resource_kind::threads}),
+        sharg::design_error);
+}
+
+TEST_F(verify_resource_config_test, resource_used_twice)
+{
+    int threads{};
+    int memory{};
+
+    auto parser = get_parser();
+    EXPECT_NO_THROW(
+        parser.add_option(threads, sharg::config{.long_id = "threads", .resource = sharg::resource_kind::threads}));
+    EXPECT_NO_THROW(
+        parser.add_option(memory, sharg::config{.long_id = "memory", .resource = sharg::resource_kind::memory_mib}));
+    EXPECT_THROW_MSG(
+        parser.add_option(threads, sharg::config{.long_id = "cores", .resource = sharg::resource_kind::threads}),
+        sharg::design_error,
+        "Only one option can be the number of threads.");
+    EXPECT_THROW_MSG(
+        parser.add_option(memory, sharg::config{.long_id = "ram", .resource = sharg::resource_kind::memory_gib}),
+        sharg::design_error,
+        "Only one option can be the memory budget.");
+}
+
+TEST_F(verify_resource_config_test, flag_and_positional_option)
+{
+    bool flag_value{};
+    int option_value{};
+
+    auto parser = get_parser();
+    EXPECT_THROW_MSG(
+        parser.add_flag(flag_value, sharg::config{.long_id = "flag", .resource = sharg::resource_kind::threads}),
+        sharg::design_error,
+        "A flag cannot control a resource (sharg::config::resource).");
+    EXPECT_THROW_MSG(
+        parser.add_positional_option(option_value, sharg::config{.resource = sharg::resource_kind::threads}),
+        sharg::design_error,
+        "A positional option cannot control a resource (sharg::config::resource).");
+}
+
 // -----------------------------------------------------------------------------
 // general
 // -----------------------------------------------------------------------------
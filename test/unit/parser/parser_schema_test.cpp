@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include <sharg/parser_schema.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+
+struct job_options
+{
+    std::string input{};
+    int threads{1};
+    std::vector<std::string> labels{};
+    bool verbose{false};
+    std::vector<double> values{};
+};
+
+sharg::parser_schema<job_options> make_schema()
+{
+    sharg::parser_schema<job_options> schema{};
+    schema.add_option(&job_options::input, sharg::config{.short_id = 'i', .long_id = "input", .required = true});
+    schema.add_option(&job_options::threads,
+                      sharg::config{.short_id = 't', .validator = sharg::arithmetic_range_validator{1, 64}});
+    schema.add_option(&job_options::labels, sharg::config{.long_id = "label"});
+    schema.add_flag(&job_options::verbose, sharg::config{.short_id = 'v'});
+    return schema;
+}
+
+TEST(parser_schema_test, parse)
+{
+    auto schema = make_schema();
+
+    job_options options = schema.parse(std::vector<std::string>{"-i", "in.fa", "-t", "4", "-v"});
+    EXPECT_EQ(options.input, "in.fa");
+    EXPECT_EQ(options.threads, 4);
+    EXPECT_TRUE(options.labels.empty());
+    EXPECT_TRUE(options.verbose);
+
+    // The next parse starts from the defaults again.
+    options = schema.parse(std::vector<std::string>{"--input=other.fa", "--label", "a", "--label", "b"});
+    EXPECT_EQ(options.input, "other.fa");
+    EXPECT_EQ(options.threads, 1);
+    EXPECT_EQ(options.labels, (std::vector<std::string>{"a", "b"}));
+    EXPECT_FALSE(options.verbose);
+}
+
+TEST(parser_schema_test, parse_braced_list)
+{
+    auto schema = make_schema();
+
+    job_options options = schema.parse({"-i", "in.fa"});
+    EXPECT_EQ(options.input, "in.fa");
+
+    options = schema.parse({"-i", "in.fa", "-t", "2"});
+    EXPECT_EQ(options.threads, 2);
+
+    options = schema.parse("-i in.fa -v"); // a single string is a command line
+    EXPECT_TRUE(options.verbose);
+}
+
+TEST(parser_schema_test, positional_options)
+{
+    sharg::parser_schema<job_options> schema{};
+    schema.add_positional_option(&job_options::input, sharg::config{});
+    schema.add_positional_option(&job_options::values, sharg::config{});
+
+    job_options options = schema.parse(std::vector<std::string>{"in.fa", "1.5", "2"});
+    EXPECT_EQ(options.input, "in.fa");
+    EXPECT_EQ(options.values, (std::vector<double>{1.5, 2}));
+
+    EXPECT_THROW(schema.parse(std::vector<std::string>{"in.fa"}), sharg::too_few_arguments);
+    EXPECT_THROW_MSG(schema.add_positional_option(&job_options::threads, sharg::config{}),
+                     sharg::design_error,
+                     "You added a positional option with a list value before so you cannot add any other positional "
+                     "options.");
+}
+
+TEST(parser_schema_test, defaults)
+{
+    sharg::parser_schema<job_options> schema{job_options{.threads = 8, .labels = {"default"}}};
+    schema.add_option(&job_options::input, sharg::config{.short_id = 'i'});
+    schema.add_option(&job_options::threads, sharg::config{.short_id = 't'});
+    schema.add_option(&job_options::labels, sharg::config{.long_id = "label"});
+
+    job_options options = schema.parse(std::vector<std::string>{"-i", "in.fa"});
+    EXPECT_EQ(options.threads, 8);
+    EXPECT_EQ(options.labels, (std::vector<std::string>{"default"}));
+
+    // Given values replace the default of a container option.
+    options = schema.parse(std::vector<std::string>{"--label", "given"});
+    EXPECT_EQ(options.labels, (std::vector<std::string>{"given"}));
+}
+
+TEST(parser_schema_test, user_errors)
+{
+    auto schema = make_schema();
+
+    EXPECT_THROW(schema.parse(std::vector<std::string>{"-t", "4"}), sharg::required_option_missing);
+    EXPECT_THROW(schema.parse(std::vector<std::string>{"-i", "a", "-t", "100"}), sharg::validation_error);
+    EXPECT_THROW(schema.parse(std::vector<std::string>{"-i", "a", "-t", "x"}), sharg::user_input_error);
+    EXPECT_THROW(schema.parse(std::vector<std::string>{"-i", "a", "-i", "b"}), sharg::option_declared_multiple_times);
+    EXPECT_THROW(schema.parse(std::vector<std::string>{"-i", "a", "--foo"}), sharg::unknown_option);
+
+    // Special options would terminate the process.
+    EXPECT_THROW(schema.parse(std::vector<std::string>{"-i", "a", "--help"}), sharg::unknown_option);
+
+    // The schema can still be used after an error.
+    EXPECT_EQ(schema.parse(std::vector<std::string>{"-i", "a"}).input, "a");
+}
+
+TEST(parser_schema_test, design_errors)
+{
+    sharg::parser_schema<job_options> schema{};
+    schema.add_option(&job_options::input, sharg::config{.short_id = 'i'});
+
+    EXPECT_THROW_MSG(schema.add_option(&job_options::threads, sharg::config{.short_id = 'i'}),
+                     sharg::design_error,
+                     "Short identifier 'i' was already used before.");
+    EXPECT_THROW(schema.add_option(&job_options::threads, sharg::config{.long_id = "help"}), sharg::design_error);
+    EXPECT_THROW(schema.add_positional_option(&job_options::input, sharg::config{.short_id = 'p'}),
+                 sharg::design_error);
+
+    sharg::parser_schema<job_options> verbose_schema{job_options{.verbose = true}};
+    EXPECT_THROW_MSG(verbose_schema.add_flag(&job_options::verbose, sharg::config{.short_id = 'v'}),
+                     sharg::design_error,
+                     "A flag's default value must be false.");
+}
+
+TEST(parser_schema_test, parse_command_line)
+{
+    auto schema = make_schema();
+
+    job_options options = schema.parse(std::string_view{R"(-i "my file.fa" --label 'it'"'"'s' --label a\ b)"});
+    EXPECT_EQ(options.input, "my file.fa");
+    EXPECT_EQ(options.labels, (std::vector<std::string>{"it's", "a b"}));
+
+    EXPECT_THROW_MSG(schema.parse(std::string_view{"-i \"unterminated"}),
+                     sharg::user_input_error,
+                     "The command line contains an unterminated quote: -i \"unterminated");
+}
+
+TEST(parser_schema_test, split_command_line)
+{
+    using sharg::detail::split_command_line;
+
+    EXPECT_TRUE(split_command_line("").empty());
+    EXPECT_TRUE(split_command_line(" \t ").empty());
+    EXPECT_EQ(split_command_line("  a  b\tc "), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(split_command_line(R"(a "" '' b)"), (std::vector<std::string>{"a", "", "", "b"}));
+    EXPECT_EQ(split_command_line(R"("a\"b" 'a\b')"), (std::vector<std::string>{"a\"b", "a\\b"}));
+    EXPECT_EQ(split_command_line(R"(--opt="x y")"), (std::vector<std::string>{"--opt=x y"}));
+}
+
+TEST(parser_schema_test, parse_jobs_from_stream)
+{
+    auto schema = make_schema();
+    std::istringstream jobs{"# comment\n"
+                            "-i a.fa -t 2\n"
+                            "\n"
+                            "   \n"
+                            "-i b.fa -v\n"
+                            "  # indented comment\n"};
+
+    std::vector<job_options> results{};
+    size_t const job_count = schema.parse_jobs(jobs,
+                                               [&results](job_options && options)
+                                               {
+                                                   results.push_back(std::move(options));
+                                               });
+
+    EXPECT_EQ(job_count, 2u);
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].input, "a.fa");
+    EXPECT_EQ(results[0].threads, 2);
+    EXPECT_FALSE(results[0].verbose);
+    EXPECT_EQ(results[1].input, "b.fa");
+    EXPECT_TRUE(results[1].verbose);
+}
+
+TEST(parser_schema_test, parse_jobs_stops_at_error)
+{
+    auto schema = make_schema();
+    std::istringstream jobs{"-i a.fa\n-t 2\n-i c.fa\n"};
+
+    size_t callback_calls{};
+    EXPECT_THROW(schema.parse_jobs(jobs,
+                                   [&callback_calls](job_options &&)
+                                   {
+                                       ++callback_calls;
+                                   }),
+                 sharg::required_option_missing);
+    EXPECT_EQ(callback_calls, 1u);
+}
+
+TEST(parser_schema_test, parse_jobs_from_callback)
+{
+    auto schema = make_schema();
+
+    size_t remaining{1000};
+    auto next_job = [&remaining]() -> std::optional<std::vector<std::string>>
+    {
+        if (remaining == 0)
+            return std::nullopt;
+        --remaining;
+        return std::vector<std::string>{"-i", "job" + std::to_string(remaining) + ".fa", "-t", "3"};
+    };
+
+    size_t threads_sum{};
+    size_t const job_count = schema.parse_jobs(next_job,
+                                               [&threads_sum](job_options && options)
+                                               {
+                                                   threads_sum += options.threads;
+                                               });
+
+    EXPECT_EQ(job_count, 1000u);
+    EXPECT_EQ(threads_sum, 3000u);
+}
+
+TEST(parser_schema_test, move)
+{
+    auto schema = make_schema();
+    sharg::parser_schema<job_options> moved{std::move(schema)};
+
+    EXPECT_EQ(moved.parse(std::vector<std::string>{"-i", "a"}).input, "a");
+    EXPECT_THROW(moved.add_option(&job_options::threads, sharg::config{.short_id = 'i'}), sharg::design_error);
+}
+
+TEST(parser_schema_test, concurrent_parse)
+{
+    auto const schema = make_schema();
+    std::vector<std::thread> threads{};
+    std::atomic<size_t> correct{};
+
+    for (int thread = 1; thread <= 4; ++thread)
+    {
+        threads.emplace_back(
+            [&schema, &correct, thread]()
+            {
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    auto options = schema.parse(std::vector<std::string>{"-t", std::to_string(thread), "-i", "x"});
+                    correct += options.threads == thread;
+                }
+            });
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+
+    EXPECT_EQ(correct, 400u);
+}
@@ -0,0 +1,406 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <set>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+class parser_serialise_test : public sharg::test::test_fixture
+{};
+
+enum class penguin
+{
+    emperor,
+    king
+};
+
+auto enumeration_names(penguin)
+{
+    return std::unordered_map<std::string_view, penguin>{{"emperor", penguin::emperor}, {"king", penguin::king}};
+}
+
+// Stored as text by default.
+struct point
+{
+    int x{};
+    int y{};
+
+    friend std::istream & operator>>(std::istream & stream, point & p)
+    {
+        char comma{};
+        return stream >> p.x >> comma >> p.y;
+    }
+
+    friend std::ostream & operator<<(std::ostream & stream, point const & p)
+    {
+        return stream << p.x << ',' << p.y;
+    }
+
+    bool operator==(point const &) const = default;
+};
+
+// A text with spaces, e.g. "Ada Lovelace".
+struct full_name
+{
+    std::string first{};
+    std::string last{};
+
+    friend std::istream & operator>>(std::istream & stream, full_name & name)
+    {
+        return stream >> name.first >> name.last;
+    }
+
+    friend std::ostream & operator<<(std::ostream & stream, full_name const & name)
+    {
+        return stream << name.first << ' ' << name.last;
+    }
+
+    bool operator==(full_name const &) const = default;
+};
+
+// Reads only the first word.
+struct word
+{
+    std::string text{};
+
+    friend std::istream & operator>>(std::istream & stream, word & w)
+    {
+        return stream >> w.text;
+    }
+
+    friend std::ostream & operator<<(std::ostream & stream, word const & w)
+    {
+        return stream << w.text;
+    }
+};
+
+// Provides its own binary representation.
+struct coordinate
+{
+    int value{};
+
+    friend std::istream & operator>>(std::istream & stream, coordinate & c)
+    {
+        return stream >> c.value;
+    }
+
+    friend std::ostream & operator<<(std::ostream & stream, coordinate const & c)
+    {
+        return stream << c.value;
+    }
+};
+
+namespace sharg::custom
+{
+
+template <>
+struct parsing<coordinate>
+{
+    static inline size_t serialise_calls{};
+
+    static void serialise(std::string & blob, coordinate const & c)
+    {
+        ++serialise_calls;
+        blob.push_back(static_cast<char>(c.value));
+    }
+
+    static void deserialise(std::string_view const bytes, coordinate & c)
+    {
+        ASSERT_EQ(bytes.size(), 1u);
+        c.value = bytes[0];
+    }
+};
+
+} // namespace sharg::custom
+
+struct values
+{
+    int i{};
+    int64_t negative{};
+    uint8_t small{};
+    double d{};
+    float f{};
+    std::string s{};
+    std::filesystem::path p{};
+    penguin e{};
+    point pt{};
+    coordinate c{};
+    bool flag{false};
+    std::vector<int> list{};
+    std::vector<bool> bools{};
+    std::set<std::string> set{};
+    std::array<double, 2> array{};
+    std::string positional{};
+    std::vector<std::string> positional_list{};
+
+    void add_to(sharg::parser & parser)
+    {
+        parser.add_option(i, sharg::config{.short_id = 'i', .long_id = "int"});
+        parser.add_option(negative, sharg::config{.long_id = "negative"});
+        parser.add_option(small, sharg::config{.long_id = "small"});
+        parser.add_option(d, sharg::config{.short_id = 'd', .validator = sharg::arithmetic_range_validator{0, 10}});
+        parser.add_option(f, sharg::config{.long_id = "float"});
+        parser.add_option(s, sharg::config{.short_id = 's', .validator = sharg::value_list_validator{"a b", "c"}});
+        parser.add_option(p, sharg::config{.long_id = "path"});
+        parser.add_option(e, sharg::config{.short_id = 'e'});
+        parser.add_option(pt, sharg::config{.long_id = "point"});
+        parser.add_option(c, sharg::config{.long_id = "coordinate"});
+        parser.add_flag(flag, sharg::config{.short_id = 'x'});
+        parser.add_option(list, sharg::config{.short_id = 'l'});
+        parser.add_option(bools, sharg::config{.long_id = "bools"});
+        parser.add_option(set, sharg::config{.long_id = "set"});
+        parser.add_option(array, sharg::config{.long_id = "array"});
+        parser.add_section("Positional options");
+        parser.add_positional_option(positional, sharg::config{});
+        parser.add_positional_option(positional_list, sharg::config{});
+    }
+};
+
+TEST_F(parser_serialise_test, round_trip)
+{
+    values parsed{};
+    auto parser = get_parser("-i", "4", "--negative", "-5000000000", "--small", "200", "-d", "2.5", "--float",
+                             "0.1", "-s", "a b", "--path", "/tmp/in.fa", "-e", "king", "--point", "1,2",
+                             "--coordinate", "7", "-x", "-l", "1", "-l", "2", "--bools", "1",
+                             "--bools", "0", "--set", "z", "--set", "y", "--array", "1", "--array", "2", "pos",
+                             "a", "b");
+    parsed.add_to(parser);
+    parser.parse();
+
+    size_t const calls_before = sharg::custom::parsing<coordinate>::serialise_calls;
+    std::string const blob = parser.serialise();
+    EXPECT_EQ(sharg::custom::parsing<coordinate>::serialise_calls, calls_before + 1u);
+    EXPECT_TRUE(blob.starts_with("SHRG"));
+    EXPECT_EQ(parser.serialise(), blob); // serialise does not change the parser
+
+    values restored{};
+    auto worker = get_parser("ignored");
+    restored.add_to(worker);
+    worker.deserialise(blob);
+
+    EXPECT_EQ(restored.i, 4);
+    EXPECT_EQ(restored.negative, -5000000000);
+    EXPECT_EQ(restored.small, 200u);
+    EXPECT_EQ(restored.d, 2.5);
+    EXPECT_EQ(restored.f, 0.1f);
+    EXPECT_EQ(restored.s, "a b");
+    EXPECT_EQ(restored.p, std::filesystem::path{"/tmp/in.fa"});
+    EXPECT_EQ(restored.e, penguin::king);
+    EXPECT_EQ(restored.pt, (point{1, 2}));
+    EXPECT_EQ(restored.c.value, 7);
+    EXPECT_TRUE(restored.flag);
+    EXPECT_EQ(restored.list, (std::vector<int>{1, 2}));
+    EXPECT_EQ(restored.bools, (std::vector<bool>{true, false}));
+    EXPECT_EQ(restored.set, (std::set<std::string>{"y", "z"}));
+    EXPECT_EQ(restored.array, (std::array<double, 2>{1, 2}));
+    EXPECT_EQ(restored.positional, "pos");
+    EXPECT_EQ(restored.positional_list, (std::vector<std::string>{"a", "b"}));
+
+    // The positions of the identifiers are restored as well.
+    EXPECT_TRUE(worker.is_option_set('x'));
+    EXPECT_TRUE(worker.is_option_set("path"));
+    EXPECT_EQ(worker.occurrences('l'), 2u);
+    EXPECT_EQ(worker.positions('i').size(), 1u);
+    EXPECT_EQ(worker.positions('i')[0], parser.positions('i')[0]);
+    EXPECT_EQ(worker.positions("float")[0], parser.positions("float")[0]);
+    EXPECT_FALSE(worker.is_option_set("int"));
+    EXPECT_EQ(worker.serialise(), blob);
+
+    EXPECT_THROW_MSG(worker.deserialise(blob),
+                     sharg::design_error,
+                     "deserialise may only be used before calling parse().");
+    EXPECT_THROW_MSG(worker.parse(), sharg::design_error, "The function parse() must only be called once!");
+}
+
+TEST_F(parser_serialise_test, default_values)
+{
+    int value{5};
+    std::vector<int> list{1, 2};
+    auto parser = get_parser("-x");
+    bool flag{false};
+    parser.add_flag(flag, sharg::config{.short_id = 'x'});
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+    parser.add_option(list, sharg::config{.short_id = 'l'});
+    parser.parse();
+
+    int restored_value{};
+    std::vector<int> restored_list{9};
+    bool restored_flag{false};
+    auto worker = get_parser("-x");
+    worker.add_flag(restored_flag, sharg::config{.short_id = 'x'});
+    worker.add_option(restored_value, sharg::config{.short_id = 'i'});
+    worker.add_option(restored_list, sharg::config{.short_id = 'l'});
+    worker.deserialise(parser.serialise());
+
+    EXPECT_TRUE(restored_flag);
+    EXPECT_EQ(restored_value, 5);
+    EXPECT_EQ(restored_list, (std::vector<int>{1, 2}));
+    EXPECT_FALSE(worker.is_option_set('i'));
+}
+
+TEST_F(parser_serialise_test, mismatch)
+{
+    int value{};
+    auto parser = get_parser("-i", "3");
+    parser.info.version = "1.0.0";
+    parser.add_option(value, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 5}});
+    parser.parse();
+    std::string const blob = parser.serialise();
+
+    auto get_worker = [](std::string version = "1.0.0")
+    {
+        auto worker = get_parser("-i", "3");
+        worker.info.version = std::move(version);
+        return worker;
+    };
+
+    { // other type
+        double other{};
+        auto worker = get_worker();
+        worker.add_option(other, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 5}});
+        EXPECT_THROW_MSG(worker.deserialise(blob),
+                         sharg::deserialisation_error,
+                         "The serialised parser state does not match the options of this parser.");
+    }
+
+    { // other validator
+        int other{};
+        auto worker = get_worker();
+        worker.add_option(other, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 6}});
+        EXPECT_THROW_MSG(worker.deserialise(blob),
+                         sharg::deserialisation_error,
+                         "The serialised parser state does not match the options of this parser.");
+    }
+
+    { // other identifier
+        int other{};
+        auto worker = get_worker();
+        worker.add_option(other, sharg::config{.short_id = 'j', .validator = sharg::arithmetic_range_validator{1, 5}});
+        EXPECT_THROW_MSG(worker.deserialise(blob),
+                         sharg::deserialisation_error,
+                         "The serialised parser state does not match the options of this parser.");
+    }
+
+    { // more options
+        int other{};
+        int more{};
+        auto worker = get_worker();
+        worker.add_option(other, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 5}});
+        worker.add_option(more, sharg::config{.short_id = 'j'});
+        EXPECT_THROW_MSG(worker.deserialise(blob), sharg::deserialisation_error, "The serialised parser state is corrupt.");
+    }
+
+    { // fewer options
+        auto worker = get_worker();
+        EXPECT_THROW_MSG(worker.deserialise(blob),
+                         sharg::deserialisation_error,
+                         "The serialised parser state contains more options than this parser.");
+    }
+
+    { // other version
+        int other{};
+        auto worker = get_worker("2.0.0");
+        worker.add_option(other, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 5}});
+        EXPECT_THROW_MSG(worker.deserialise(blob),
+                         sharg::deserialisation_error,
+                         "The serialised parser state was created by test_parser 1.0.0 and cannot be restored by "
+                         "test_parser 2.0.0.");
+    }
+}
+
+TEST_F(parser_serialise_test, corrupt)
+{
+    int value{};
+    std::string text{};
+    auto parser = get_parser("-i", "3", "-s", "abc");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+    parser.add_option(text, sharg::config{.short_id = 's'});
+    parser.parse();
+    std::string const blob = parser.serialise();
+
+    auto restore = [](std::string_view const data)
+    {
+        int restored_value{};
+        std::string restored_text{};
+        auto worker = get_parser("-i", "3");
+        worker.add_option(restored_value, sharg::config{.short_id = 'i'});
+        worker.add_option(restored_text, sharg::config{.short_id = 's'});
+        worker.deserialise(data);
+    };
+
+    EXPECT_NO_THROW(restore(blob));
+
+    for (size_t size = 0; size < blob.size(); ++size)
+        EXPECT_THROW(restore(std::string_view{blob}.substr(0, size)), sharg::deserialisation_error);
+
+    EXPECT_THROW_MSG(restore(blob + 'x'),
+                     sharg::deserialisation_error,
+                     "The serialised parser state contains more options than this parser.");
+    EXPECT_THROW_MSG(restore("SHRG\x02"),
+                     sharg::deserialisation_error,
+                     "The serialised parser state has an unsupported version.");
+    EXPECT_THROW_MSG(restore("no blob"), sharg::deserialisation_error, "The serialised parser state is corrupt.");
+}
+
+TEST_F(parser_serialise_test, text_with_spaces)
+{
+    full_name name{};
+    full_name unset{"Grace", "Hopper"};
+    word empty{};
+    auto parser = get_parser("--name", "Ada Lovelace");
+    parser.add_option(name, sharg::config{.long_id = "name"});
+    parser.add_option(unset, sharg::config{.long_id = "unset"});
+    parser.add_option(empty, sharg::config{.long_id = "empty"});
+    parser.parse();
+    EXPECT_EQ(name, (full_name{"Ada", "Lovelace"}));
+
+    full_name restored_name{};
+    full_name restored_unset{};
+    word restored_empty{"not empty"};
+    auto worker = get_parser("--name", "Ada Lovelace");
+    worker.add_option(restored_name, sharg::config{.long_id = "name"});
+    worker.add_option(restored_unset, sharg::config{.long_id = "unset"});
+    worker.add_option(restored_empty, sharg::config{.long_id = "empty"});
+    worker.deserialise(parser.serialise());
+
+    EXPECT_EQ(restored_name, (full_name{"Ada", "Lovelace"}));
+    EXPECT_EQ(restored_unset, (full_name{"Grace", "Hopper"}));
+    EXPECT_EQ(restored_empty.text, "");
+}
+
+TEST_F(parser_serialise_test, text_not_read_completely)
+{
+    // A default value that cannot be parsed by the stream operator must not be restored truncated.
+    word value{"two words"};
+    bool flag{false};
+    auto parser = get_parser("-x");
+    parser.add_option(value, sharg::config{.long_id = "word"});
+    parser.add_flag(flag, sharg::config{.short_id = 'x'});
+    parser.parse();
+
+    word restored{};
+    bool restored_flag{false};
+    auto worker = get_parser("-x");
+    worker.add_option(restored, sharg::config{.long_id = "word"});
+    worker.add_flag(restored_flag, sharg::config{.short_id = 'x'});
+    EXPECT_THROW_MSG(worker.deserialise(parser.serialise()),
+                     sharg::deserialisation_error,
+                     "The serialised value \"two words\" of type word cannot be read completely.");
+}
+
+TEST_F(parser_serialise_test, serialise_before_parse)
+{
+    int value{};
+    auto parser = get_parser("-i", "3");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+
+    EXPECT_THROW_MSG(parser.serialise(),
+                     sharg::design_error,
+                     "You can only serialise the parser after the function `parse()` parsed the command line.");
+}
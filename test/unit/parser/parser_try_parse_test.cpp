@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+class parser_try_parse_test : public sharg::test::test_fixture
+{};
+
+enum class penguin
+{
+    emperor,
+    king
+};
+
+auto enumeration_names(penguin)
+{
+    return std::unordered_map<std::string_view, penguin>{{"emperor", penguin::emperor}, {"king", penguin::king}};
+}
+
+TEST_F(parser_try_parse_test, success)
+{
+    int value{};
+    auto parser = get_parser("-i", "3");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+
+    sharg::parse_result result = parser.try_parse();
+    EXPECT_TRUE(result.has_value());
+    EXPECT_TRUE(static_cast<bool>(result));
+    EXPECT_TRUE(result.diagnostics().empty());
+    EXPECT_NO_THROW(result.value());
+    EXPECT_EQ(value, 3);
+
+    EXPECT_THROW_MSG(parser.try_parse(), sharg::design_error, "The function parse() must only be called once!");
+}
+
+TEST_F(parser_try_parse_test, all_errors_are_reported)
+{
+    int value{};
+    double ratio{};
+    std::string required{};
+    std::vector<int> list{};
+    auto parser = get_parser("-i", "abc", "--ratio", "1e400", "--foo", "-xy", "-l", "1", "-l", "b", "pos", "extra");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+    parser.add_option(ratio, sharg::config{.long_id = "ratio"});
+    parser.add_option(required, sharg::config{.short_id = 'r', .required = true});
+    parser.add_option(list, sharg::config{.short_id = 'l'});
+    std::string positional{};
+    parser.add_positional_option(positional, sharg::config{});
+
+    sharg::parse_result result = parser.try_parse();
+    ASSERT_FALSE(result.has_value());
+
+    auto const & diagnostics = result.diagnostics();
+    ASSERT_EQ(diagnostics.size(), 7u);
+
+    EXPECT_EQ(diagnostics[0].kind, sharg::diagnostic_kind::user_input_error);
+    EXPECT_EQ(diagnostics[0].option_id, "-i");
+    EXPECT_EQ(diagnostics[0].argument_index, 2u);
+    EXPECT_EQ(diagnostics[0].value, "abc");
+    EXPECT_EQ(diagnostics[0].message(),
+              "Value parse failed for -i: Argument abc could not be parsed as type signed 32 bit integer.");
+
+    EXPECT_EQ(diagnostics[1].kind, sharg::diagnostic_kind::user_input_error);
+    EXPECT_EQ(diagnostics[1].option_id, "--ratio");
+    EXPECT_EQ(diagnostics[1].argument_index, 4u);
+    EXPECT_TRUE(diagnostics[1].message().starts_with("Value parse failed for --ratio: Numeric argument 1e400 is not "
+                                                     "in the valid range"));
+
+    EXPECT_EQ(diagnostics[2].kind, sharg::diagnostic_kind::required_option_missing);
+    EXPECT_EQ(diagnostics[2].option_id, "-r");
+    EXPECT_EQ(diagnostics[2].argument_index, sharg::diagnostic::npos);
+    EXPECT_EQ(diagnostics[2].message(), "Option -r is required but not set.");
+
+    EXPECT_EQ(diagnostics[3].kind, sharg::diagnostic_kind::user_input_error);
+    EXPECT_EQ(diagnostics[3].option_id, "-l");
+    EXPECT_EQ(diagnostics[3].argument_index, 10u);
+    EXPECT_EQ(diagnostics[3].value, "b");
+
+    EXPECT_EQ(diagnostics[4].kind, sharg::diagnostic_kind::unknown_option);
+    EXPECT_EQ(diagnostics[4].argument_index, 5u);
+    EXPECT_EQ(diagnostics[4].value, "--foo");
+
+    EXPECT_EQ(diagnostics[5].kind, sharg::diagnostic_kind::unknown_option);
+    EXPECT_EQ(diagnostics[5].argument_index, 6u);
+    EXPECT_TRUE(diagnostics[5].message().starts_with("Unknown flags -x"));
+
+    EXPECT_EQ(diagnostics[6].kind, sharg::diagnostic_kind::too_many_arguments);
+    EXPECT_EQ(diagnostics[6].argument_index, 12u);
+    EXPECT_EQ(diagnostics[6].value, "extra");
+
+    EXPECT_EQ(positional, "pos");
+    EXPECT_THROW_MSG(result.value(),
+                     sharg::user_input_error,
+                     "Value parse failed for -i: Argument abc could not be parsed as type signed 32 bit integer.");
+}
+
+TEST_F(parser_try_parse_test, exception_types)
+{
+    auto first_diagnostic = [](sharg::parser & parser)
+    {
+        sharg::parse_result result = parser.try_parse();
+        EXPECT_FALSE(result.has_value());
+        return result.diagnostics().at(0);
+    };
+
+    int value{};
+    auto parser = get_parser("-i", "1", "--int", "2");
+    parser.add_option(value, sharg::config{.short_id = 'i', .long_id = "int"});
+    sharg::diagnostic error = first_diagnostic(parser);
+    EXPECT_EQ(error.kind, sharg::diagnostic_kind::option_declared_multiple_times);
+    EXPECT_EQ(error.option_id, "-i/--int");
+    EXPECT_THROW_MSG(error.throw_exception(),
+                     sharg::option_declared_multiple_times,
+                     "Option -i/--int is no list/container but specified multiple times");
+
+    parser = get_parser("-i");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+    error = first_diagnostic(parser);
+    EXPECT_EQ(error.argument_index, 1u);
+    EXPECT_THROW_MSG(error.throw_exception(), sharg::too_few_arguments, "Missing value for option -i");
+
+    parser = get_parser("-i", "0");
+    parser.add_option(value, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 5}});
+    error = first_diagnostic(parser);
+    EXPECT_EQ(error.argument_index, 2u);
+    EXPECT_THROW_MSG(error.throw_exception(),
+                     sharg::validation_error,
+                     "Validation failed for option -i: Value 0 is not in range [1,5].");
+
+    penguin bird{};
+    parser = get_parser("-p", "adelie");
+    parser.add_option(bird, sharg::config{.short_id = 'p'});
+    error = first_diagnostic(parser);
+    EXPECT_EQ(error.value, "adelie");
+    EXPECT_THROW_MSG(error.throw_exception(),
+                     sharg::user_input_error,
+                     "You have chosen an invalid input value: adelie. Please use one of: [emperor, king]");
+
+    parser = get_parser("--version-check", "maybe");
+    error = first_diagnostic(parser);
+    EXPECT_EQ(error.option_id, "--version-check");
+    EXPECT_EQ(error.argument_index, 2u);
+    EXPECT_THROW_MSG(error.throw_exception(),
+                     sharg::validation_error,
+                     "Value for option --version-check must be true (1) or false (0).");
+}
+
+TEST_F(parser_try_parse_test, positional_options)
+{
+    int first{};
+    std::vector<int> rest{};
+
+    int second{};
+
+    // Too few positional arguments are reported once.
+    auto parser = get_parser("-i", "1");
+    parser.add_option(first, sharg::config{.short_id = 'i'});
+    parser.add_positional_option(second, sharg::config{});
+    parser.add_positional_option(rest, sharg::config{});
+    sharg::parse_result result = parser.try_parse();
+    ASSERT_EQ(result.diagnostics().size(), 1u);
+    EXPECT_EQ(result.diagnostics()[0].kind, sharg::diagnostic_kind::too_few_arguments);
+    EXPECT_EQ(result.diagnostics()[0].message(),
+              "Not enough positional arguments provided (Need at least 2). See -h/--help for more information.");
+
+    // Invalid values are reported, but the value is not validated.
+    parser = get_parser("x", "2", "y", "3");
+    parser.add_positional_option(second, sharg::config{.validator = sharg::arithmetic_range_validator{5, 6}});
+    parser.add_positional_option(rest, sharg::config{});
+    result = parser.try_parse();
+    ASSERT_EQ(result.diagnostics().size(), 2u);
+    EXPECT_EQ(result.diagnostics()[0].option_id, "positional option 1");
+    EXPECT_EQ(result.diagnostics()[0].argument_index, 1u);
+    EXPECT_EQ(result.diagnostics()[0].message(),
+              "Value parse failed for positional option 1: Argument x could not be parsed as type signed 32 bit "
+              "integer.");
+    EXPECT_EQ(result.diagnostics()[1].option_id, "positional option 3");
+    EXPECT_EQ(result.diagnostics()[1].argument_index, 3u);
+
+    parser = get_parser("4");
+    parser.add_positional_option(second, sharg::config{.validator = sharg::arithmetic_range_validator{5, 6}});
+    result = parser.try_parse();
+    ASSERT_EQ(result.diagnostics().size(), 1u);
+    EXPECT_EQ(result.diagnostics()[0].kind, sharg::diagnostic_kind::validation_error);
+    EXPECT_EQ(result.diagnostics()[0].argument_index, 1u);
+    EXPECT_EQ(result.diagnostics()[0].message(),
+              "Validation failed for positional option 1: Value 4 is not in range [5,6].");
+}
+
+TEST_F(parser_try_parse_test, argument_index_after_special_options)
+{
+    int value{};
+    auto parser = get_parser("--version-check", "0", "-i", "x");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+
+    sharg::parse_result result = parser.try_parse();
+    ASSERT_EQ(result.diagnostics().size(), 1u);
+    EXPECT_EQ(result.diagnostics()[0].argument_index, 4u);
+}
+
+TEST_F(parser_try_parse_test, unknown_subcommand)
+{
+    auto parser = get_subcommand_parser({"-f", "sing"}, {"build", "search"});
+    bool flag{};
+    parser.add_flag(flag, sharg::config{.short_id = 'f'});
+
+    sharg::parse_result result = parser.try_parse();
+    ASSERT_EQ(result.diagnostics().size(), 1u);
+    EXPECT_EQ(result.diagnostics()[0].kind, sharg::diagnostic_kind::user_input_error);
+    EXPECT_EQ(result.diagnostics()[0].argument_index, 2u);
+    EXPECT_EQ(result.diagnostics()[0].value, "sing");
+    EXPECT_EQ(result.diagnostics()[0].message(),
+              "You specified an unknown subcommand! Available subcommands are: [build, search]. Use -h/--help for "
+              "more information.");
+}
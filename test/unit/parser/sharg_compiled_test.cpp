@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+// This test links against sharg::sharg_compiled. The instantiations below are declared `extern template` and must
+// be provided by the library; otherwise, linking fails.
+static_assert(SHARG_COMPILED_LIBRARY == 1, "This test must be linked against sharg::sharg_compiled.");
+
+class sharg_compiled_test : public sharg::test::test_fixture
+{};
+
+TEST_F(sharg_compiled_test, parse)
+{
+    int32_t i{};
+    uint32_t u{};
+    int64_t l{};
+    uint64_t ul{};
+    double d{};
+    std::string s{};
+    std::filesystem::path p{};
+    std::vector<std::string> strings{};
+    std::vector<std::filesystem::path> paths{};
+    bool flag{false};
+    std::string positional{};
+    std::vector<std::filesystem::path> positional_list{};
+
+    auto parser = get_parser("-i", "-1", "-u", "2", "-l", "-3", "--ul", "4", "-d", "0.5", "-s", "a", "-p", "in.fa",
+                             "--strings", "b", "--strings", "c", "--paths", "x", "-f", "pos", "y", "z");
+    parser.add_option(i, sharg::config{.short_id = 'i'});
+    parser.add_option(u, sharg::config{.short_id = 'u'});
+    parser.add_option(l, sharg::config{.short_id = 'l'});
+    parser.add_option(ul, sharg::config{.long_id = "ul"});
+    parser.add_option(d, sharg::config{.short_id = 'd'});
+    parser.add_option(s, sharg::config{.short_id = 's'});
+    parser.add_option(p, sharg::config{.short_id = 'p'});
+    parser.add_option(strings, sharg::config{.long_id = "strings"});
+    parser.add_option(paths, sharg::config{.long_id = "paths"});
+    parser.add_flag(flag, sharg::config{.short_id = 'f'});
+    parser.add_positional_option(positional, sharg::config{});
+    parser.add_positional_option(positional_list, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+
+    EXPECT_EQ(i, -1);
+    EXPECT_EQ(u, 2u);
+    EXPECT_EQ(l, -3);
+    EXPECT_EQ(ul, 4u);
+    EXPECT_EQ(d, 0.5);
+    EXPECT_EQ(s, "a");
+    EXPECT_EQ(p, std::filesystem::path{"in.fa"});
+    EXPECT_EQ(strings, (std::vector<std::string>{"b", "c"}));
+    EXPECT_EQ(paths, (std::vector<std::filesystem::path>{"x"}));
+    EXPECT_TRUE(flag);
+    EXPECT_EQ(positional, "pos");
+    EXPECT_EQ(positional_list, (std::vector<std::filesystem::path>{"y", "z"}));
+}
+
+TEST_F(sharg_compiled_test, validators)
+{
+    int32_t i{};
+    std::string s{};
+    auto parser = get_parser("-i", "20", "-s", "b");
+    parser.add_option(i, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 10}});
+    parser.add_option(s, sharg::config{.short_id = 's', .validator = sharg::value_list_validator{"a", "b"}});
+    EXPECT_THROW(parser.parse(), sharg::validation_error);
+}
+
+TEST_F(sharg_compiled_test, help_page)
+{
+    std::string s{"default"};
+    auto parser = get_parser("-h");
+    parser.add_option(s, sharg::config{.short_id = 's', .description = "A string."});
+    std::string const help_page = get_parse_cout_on_exit(parser);
+
+    EXPECT_NE(help_page.find("A string. Default: \"default\"\n"), std::string::npos) << help_page;
+}
@@ -271,3 +271,62 @@ TEST_F(subcommand_test, recursive_subcommands)
 
     EXPECT_EQ(get_parse_cout_on_exit(sub_sub_parser), expected_sub_sub_full_help);
 }
+
+TEST_F(subcommand_test, export_all_subcommands)
+{
+    std::vector<std::string> set_up_names{};
+    auto set_up = [&set_up_names](sharg::parser & sub_parser)
+    {
+        set_up_names.push_back(sub_parser.info.app_name);
+        clear_and_add_option(sub_parser);
+    };
+
+    auto parser = get_subcommand_parser({"--export-help", "json", "--all-subcommands"}, {"build", "search"});
+    clear_and_add_option(parser);
+    parser.set_subcommand_setup(set_up);
+
+    std::ostringstream stream{};
+    ASSERT_EQ(parser.parse(stream), sharg::parse_status::exported);
+    EXPECT_EQ(set_up_names, (std::vector<std::string>{"test_parser-build", "test_parser-search"}));
+    EXPECT_THROW(parser.get_sub_parser(), sharg::design_error);
+
+    // The descriptions are the elements of a JSON array.
+    std::string const output = stream.str();
+    size_t const top = output.find("\"title\": \"test_parser\"");
+    size_t const build = output.find("\"title\": \"test_parser-build\"");
+    size_t const search = output.find("\"title\": \"test_parser-search\"");
+    EXPECT_TRUE(output.starts_with("[\n{")) << output;
+    EXPECT_TRUE(output.ends_with("}\n]\n")) << output;
+    EXPECT_NE(top, std::string::npos) << output;
+    EXPECT_LT(top, build) << output;
+    EXPECT_LT(build, search) << output;
+    EXPECT_NE(search, std::string::npos) << output;
+    EXPECT_EQ(std::ranges::count(output, '['), std::ranges::count(output, ']')) << output;
+    EXPECT_NE(output.find("}\n,\n{"), std::string::npos) << output;
+
+    // The top-level help page lists the option.
+    parser = get_subcommand_parser({"-h"}, {"build"});
+    parser.set_subcommand_setup(set_up);
+    EXPECT_NE(get_parse_cout_on_exit(parser).find("    --all-subcommands\n"), std::string::npos);
+}
+
+TEST_F(subcommand_test, all_subcommands_without_export)
+{
+    auto parser = get_subcommand_parser({"--all-subcommands", "-h"}, {"build"});
+    clear_and_add_option(parser);
+    parser.set_subcommand_setup(clear_and_add_option);
+
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Option --all-subcommands can only be used together with --export-help.");
+}
+
+TEST_F(subcommand_test, all_subcommands_without_setup)
+{
+    // Without sharg::parser::set_subcommand_setup, --all-subcommands is not an option of the top-level parser.
+    auto parser = get_subcommand_parser({"--export-help", "json", "--all-subcommands"}, {"build"});
+    std::ostringstream stream{};
+    EXPECT_EQ(parser.parse(stream), sharg::parse_status::exported);
+    EXPECT_TRUE(stream.str().starts_with("{")) << stream.str();
+    EXPECT_EQ(stream.str().find("test_parser-build"), std::string::npos) << stream.str();
+}
@@ -0,0 +1,386 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <clocale>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sharg/std/charconv>
+#include <sharg/std/detail/charconv_float.hpp>
+
+// sharg/std/charconv only includes the shim if the standard library does not implement floating point charconv.
+// The shim is tested anyway; if the standard library implements it, the results can be compared against it.
+namespace shim = sharg::contrib::charconv_float;
+
+template <typename value_type>
+std::string shim_to_string(value_type const value)
+{
+    std::array<char, 64> buffer{};
+    auto res = shim::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    EXPECT_EQ(res.ec, std::errc{});
+    return std::string{buffer.data(), res.ptr};
+}
+
+template <typename value_type>
+struct parse_result
+{
+    value_type value;
+    std::ptrdiff_t consumed;
+    std::errc ec;
+};
+
+template <typename value_type>
+parse_result<value_type> shim_parse(std::string_view const str,
+                                    std::chars_format const fmt = std::chars_format::general,
+                                    value_type const initial = value_type{42})
+{
+    value_type value{initial};
+    auto res = shim::from_chars(str.data(), str.data() + str.size(), value, fmt);
+    return {value, res.ptr - str.data(), res.ec};
+}
+
+template <typename T>
+class charconv_float_shim_test : public ::testing::Test
+{};
+
+using real_types = ::testing::Types<float, double, long double>;
+
+TYPED_TEST_SUITE(charconv_float_shim_test, real_types, );
+
+// =============================================================================
+// to_chars
+// =============================================================================
+
+TYPED_TEST(charconv_float_shim_test, to_chars_special_values)
+{
+    using limits = std::numeric_limits<TypeParam>;
+
+    EXPECT_EQ(shim_to_string(TypeParam{0}), "0");
+    EXPECT_EQ(shim_to_string(-TypeParam{0}), "-0");
+    EXPECT_EQ(shim_to_string(limits::infinity()), "inf");
+    EXPECT_EQ(shim_to_string(-limits::infinity()), "-inf");
+    EXPECT_EQ(shim_to_string(limits::quiet_NaN()), "nan");
+    EXPECT_EQ(shim_to_string(-limits::quiet_NaN()), "-nan");
+}
+
+TYPED_TEST(charconv_float_shim_test, to_chars_shortest)
+{
+    EXPECT_EQ(shim_to_string(TypeParam{1}), "1");
+    EXPECT_EQ(shim_to_string(TypeParam{120.25}), "120.25");
+    EXPECT_EQ(shim_to_string(TypeParam{-0.5}), "-0.5");
+    EXPECT_EQ(shim_to_string(TypeParam{123000}), "123000");
+    EXPECT_EQ(shim_to_string(TypeParam{1e10}), "1e+10");
+    EXPECT_EQ(shim_to_string(static_cast<TypeParam>(0.001L)), "0.001");
+    EXPECT_EQ(shim_to_string(static_cast<TypeParam>(0.0001L)), "1e-04");
+    EXPECT_EQ(shim_to_string(TypeParam{1234567}), "1234567");
+    EXPECT_EQ(shim_to_string(static_cast<TypeParam>(1.5e30L)), "1.5e+30");
+}
+
+TYPED_TEST(charconv_float_shim_test, to_chars_value_too_large)
+{
+    std::array<char, 10> buffer{};
+
+    for (TypeParam const value : {TypeParam{120.25}, TypeParam{-1e30}, TypeParam{0.0625}, -TypeParam{0}})
+    {
+        std::string const expected = shim_to_string(value);
+
+        for (size_t size = 0; size < expected.size(); ++size)
+        {
+            auto res = shim::to_chars(buffer.data(), buffer.data() + size, value);
+            EXPECT_EQ(res.ec, std::errc::value_too_large) << expected << " with buffer size " << size;
+            EXPECT_EQ(res.ptr, buffer.data() + size);
+        }
+    }
+}
+
+TYPED_TEST(charconv_float_shim_test, to_chars_is_locale_independent)
+{
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") == nullptr)
+        GTEST_SKIP() << "Locale de_DE.UTF-8 is not available.";
+
+    EXPECT_EQ(shim_to_string(TypeParam{120.25}), "120.25");
+    std::setlocale(LC_NUMERIC, "C");
+}
+
+// =============================================================================
+// from_chars
+// =============================================================================
+
+TYPED_TEST(charconv_float_shim_test, from_chars_pattern)
+{
+    auto expect_parsed = [](std::string_view const str,
+                            std::chars_format const fmt,
+                            TypeParam const expected,
+                            std::ptrdiff_t const consumed)
+    {
+        auto [value, parsed, ec] = shim_parse<TypeParam>(str, fmt);
+        EXPECT_EQ(ec, std::errc{}) << str;
+        EXPECT_EQ(value, expected) << str;
+        EXPECT_EQ(parsed, consumed) << str;
+    };
+
+    expect_parsed("1.25", std::chars_format::general, TypeParam{1.25}, 4);
+    expect_parsed("-1.25e2xyz", std::chars_format::general, TypeParam{-125}, 7);
+    expect_parsed(".5", std::chars_format::general, TypeParam{0.5}, 2);
+    expect_parsed("5.", std::chars_format::general, TypeParam{5}, 2);
+    expect_parsed("1e", std::chars_format::general, TypeParam{1}, 1);
+    expect_parsed("1e+", std::chars_format::general, TypeParam{1}, 1);
+    expect_parsed("1e2", std::chars_format::fixed, TypeParam{1}, 1);
+    expect_parsed("1E+2", std::chars_format::scientific, TypeParam{100}, 4);
+    expect_parsed("1.8p1", std::chars_format::hex, TypeParam{3}, 5);
+    expect_parsed("0x1p3", std::chars_format::hex, TypeParam{0}, 1);
+    expect_parsed("1p", std::chars_format::hex, TypeParam{1}, 1);
+    expect_parsed("-0", std::chars_format::general, -TypeParam{0}, 2);
+    expect_parsed("infinity", std::chars_format::general, std::numeric_limits<TypeParam>::infinity(), 8);
+    expect_parsed("-INFinit", std::chars_format::general, -std::numeric_limits<TypeParam>::infinity(), 4);
+
+    auto nan = shim_parse<TypeParam>("nan(abc_1)");
+    EXPECT_TRUE(std::isnan(nan.value));
+    EXPECT_EQ(nan.consumed, 10);
+    EXPECT_EQ(nan.ec, std::errc{});
+
+    nan = shim_parse<TypeParam>("-nan(");
+    EXPECT_TRUE(std::isnan(nan.value));
+    EXPECT_TRUE(std::signbit(nan.value));
+    EXPECT_EQ(nan.consumed, 4);
+    EXPECT_EQ(nan.ec, std::errc{});
+}
+
+TYPED_TEST(charconv_float_shim_test, from_chars_invalid_argument)
+{
+    for (std::string_view const str : {"", "+1", "-", ".", "e3", "-e3", "x", "in", "na"})
+    {
+        auto [value, parsed, ec] = shim_parse<TypeParam>(str);
+        EXPECT_EQ(ec, std::errc::invalid_argument) << str;
+        EXPECT_EQ(value, TypeParam{42}) << str;
+        EXPECT_EQ(parsed, 0) << str;
+    }
+
+    // The exponent is required.
+    auto [value, parsed, ec] = shim_parse<TypeParam>("1.5", std::chars_format::scientific);
+    EXPECT_EQ(ec, std::errc::invalid_argument);
+    EXPECT_EQ(value, TypeParam{42});
+    EXPECT_EQ(parsed, 0);
+}
+
+TYPED_TEST(charconv_float_shim_test, from_chars_result_out_of_range)
+{
+    for (std::string_view const str : {"1e100000", "-1e100000", "1e-100000", "1p100000", "1p-100000"})
+    {
+        std::chars_format const fmt = str[1] == 'p' ? std::chars_format::hex : std::chars_format::general;
+        auto [value, parsed, ec] = shim_parse<TypeParam>(str, fmt);
+        EXPECT_EQ(ec, std::errc::result_out_of_range) << str;
+        EXPECT_EQ(value, TypeParam{42}) << str;
+        EXPECT_EQ(parsed, static_cast<std::ptrdiff_t>(str.size())) << str;
+    }
+}
+
+TYPED_TEST(charconv_float_shim_test, from_chars_does_not_read_past_last)
+{
+    std::string const str = "1.25e3";
+
+    // Only "1.2" may be parsed.
+    TypeParam value{};
+    auto res = shim::from_chars(str.data(), str.data() + 3, value);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(res.ptr, str.data() + 3);
+    EXPECT_EQ(value, TypeParam{12} / TypeParam{10});
+}
+
+TYPED_TEST(charconv_float_shim_test, from_chars_is_locale_independent)
+{
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") == nullptr)
+        GTEST_SKIP() << "Locale de_DE.UTF-8 is not available.";
+
+    auto [value, parsed, ec] = shim_parse<TypeParam>("120.25");
+    EXPECT_EQ(ec, std::errc{});
+    EXPECT_EQ(value, TypeParam{120.25});
+    EXPECT_EQ(parsed, 6);
+    std::setlocale(LC_NUMERIC, "C");
+}
+
+TYPED_TEST(charconv_float_shim_test, round_trip)
+{
+    std::mt19937_64 generator{0x5ea9a4};
+    std::uniform_real_distribution<TypeParam> mantissa{1, 10};
+    std::uniform_int_distribution<int> exponent{std::numeric_limits<TypeParam>::min_exponent10,
+                                                std::numeric_limits<TypeParam>::max_exponent10 - 1};
+
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        TypeParam const value = mantissa(generator) * std::pow(TypeParam{10}, exponent(generator));
+        std::string const str = shim_to_string(value);
+        auto [parsed_value, parsed, ec] = shim_parse<TypeParam>(str);
+        EXPECT_EQ(ec, std::errc{}) << str;
+        EXPECT_EQ(parsed_value, value) << str;
+        EXPECT_EQ(parsed, static_cast<std::ptrdiff_t>(str.size())) << str;
+    }
+}
+
+// =============================================================================
+// Comparison with the standard library for float and double
+// =============================================================================
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611
+template <typename value_type>
+void expect_same_as_stdlib(value_type const value)
+{
+    std::array<char, 64> buffer{};
+    auto res = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    std::string const expected{buffer.data(), res.ptr};
+    EXPECT_EQ(shim_to_string(value), expected);
+}
+
+template <typename value_type>
+void expect_same_as_stdlib(std::string_view const str, std::chars_format const fmt = std::chars_format::general)
+{
+    value_type expected{42};
+    auto res = std::from_chars(str.data(), str.data() + str.size(), expected, fmt);
+    auto [value, parsed, ec] = shim_parse<value_type>(str, fmt);
+
+    EXPECT_EQ(ec, res.ec) << str;
+    EXPECT_EQ(parsed, res.ptr - str.data()) << str;
+    if (std::isnan(expected))
+        EXPECT_TRUE(std::isnan(value)) << str;
+    else
+        EXPECT_EQ(std::bit_cast<typename shim::detail::binary_format<value_type>::bits_type>(value),
+                  std::bit_cast<typename shim::detail::binary_format<value_type>::bits_type>(expected))
+            << str;
+}
+
+template <typename T>
+class charconv_float_shim_stdlib_test : public ::testing::Test
+{};
+
+using ieee_types = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(charconv_float_shim_stdlib_test, ieee_types, );
+
+TYPED_TEST(charconv_float_shim_stdlib_test, boundaries)
+{
+    using limits = std::numeric_limits<TypeParam>;
+
+    for (TypeParam const value : {limits::min(),
+                                  limits::max(),
+                                  limits::denorm_min(),
+                                  limits::epsilon(),
+                                  std::nextafter(limits::min(), TypeParam{0}),
+                                  std::nextafter(limits::max(), TypeParam{0}),
+                                  TypeParam{1e23},
+                                  TypeParam{9007199254740993.0},
+                                  TypeParam{5e-324}})
+    {
+        expect_same_as_stdlib(value);
+        expect_same_as_stdlib(-value);
+    }
+
+    for (std::string_view const str : {"2.4703282292062327e-324",
+                                       "2.4703282292062328e-324",
+                                       "1.7976931348623158e308",
+                                       "1.7976931348623159e308",
+                                       "3.4028235e38",
+                                       "3.4028236e38",
+                                       "7e-46",
+                                       "1.00000005960464477550",
+                                       "1.000000059604644775391",
+                                       "9007199254740993",
+                                       "9007199254740993.0000000000000000000000001",
+                                       "0.000000000000000000000000000000000000000000001",
+                                       "00000000000000000000000000000000000000000000001"})
+    {
+        expect_same_as_stdlib<TypeParam>(str);
+    }
+}
+
+TYPED_TEST(charconv_float_shim_stdlib_test, bit_patterns)
+{
+    using bits_type = typename shim::detail::binary_format<TypeParam>::bits_type;
+    std::mt19937_64 generator{0x5ea9a4};
+
+    for (size_t i = 0; i < 100000; ++i)
+    {
+        TypeParam const value = std::bit_cast<TypeParam>(static_cast<bits_type>(generator()));
+        if (std::isnan(value))
+            continue;
+
+        expect_same_as_stdlib(value);
+
+        std::array<char, 1024> buffer{};
+        auto res = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        expect_same_as_stdlib<TypeParam>(std::string_view{buffer.data(), res.ptr});
+
+        res = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::hex);
+        expect_same_as_stdlib<TypeParam>(std::string_view{buffer.data(), res.ptr}, std::chars_format::hex);
+
+        // Many more digits than needed. The exact decimal value must be rounded correctly.
+        res = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::scientific, 40);
+        expect_same_as_stdlib<TypeParam>(std::string_view{buffer.data(), res.ptr});
+    }
+}
+
+TYPED_TEST(charconv_float_shim_stdlib_test, halfway_cases)
+{
+    using bits_type = typename shim::detail::binary_format<TypeParam>::bits_type;
+    std::mt19937_64 generator{0x5ea9a4};
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        TypeParam const value = std::abs(std::bit_cast<TypeParam>(static_cast<bits_type>(generator())));
+        if (!std::isfinite(value) || value == std::numeric_limits<TypeParam>::max())
+            continue;
+
+        // The exact midpoint between value and its successor, i.e. a tie.
+        long double const midpoint =
+            (static_cast<long double>(value)
+             + static_cast<long double>(std::nextafter(value, std::numeric_limits<TypeParam>::infinity())))
+            / 2;
+
+        std::array<char, 1024> buffer{};
+        auto res = std::to_chars(buffer.data(), buffer.data() + buffer.size(), midpoint, std::chars_format::scientific,
+                                 800);
+        std::string str{buffer.data(), res.ptr};
+        expect_same_as_stdlib<TypeParam>(str);
+
+        // Slightly above the midpoint.
+        str.insert(str.find('e'), "0000000000001");
+        expect_same_as_stdlib<TypeParam>(str);
+    }
+}
+
+// Compares every `stride`-th bit pattern of float, starting with `first`.
+void expect_floats_same_as_stdlib(uint64_t const first, uint64_t const stride)
+{
+    for (uint64_t bits = first; bits <= std::numeric_limits<uint32_t>::max(); bits += stride)
+    {
+        float const value = std::bit_cast<float>(static_cast<uint32_t>(bits));
+        if (std::isnan(value))
+            continue;
+
+        expect_same_as_stdlib(value);
+
+        std::array<char, 64> buffer{};
+        auto res = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        expect_same_as_stdlib<float>(std::string_view{buffer.data(), res.ptr});
+    }
+}
+
+// The stride is prime, such that all mantissa bits and exponents are covered.
+TEST(charconv_float_shim_stdlib_test, strided_floats)
+{
+    expect_floats_same_as_stdlib(0u, 4093u);
+    expect_floats_same_as_stdlib(1u, 65521u);
+}
+
+// Checks all floats. Takes a few minutes with optimisations.
+TEST(charconv_float_shim_stdlib_test, DISABLED_all_floats)
+{
+    expect_floats_same_as_stdlib(0u, 1u);
+}
+#endif